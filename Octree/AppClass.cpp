@@ -1,4 +1,5 @@
 #include "AppClass.h"
+#include <chrono>
 
 using namespace Simplex;
 
@@ -10,20 +11,39 @@ void Application::InitVariables(void)
 	uint uInstances = 1600;
 #endif
 
-	int nSquare = static_cast<int>(std::sqrt(uInstances));
-	m_uObjects = nSquare * nSquare;
-	uint uIndex = -1;
-	for (int i = 0; i < nSquare; i++)
+	//a snapshot brings back the entities and their octree without parsing a model per cube or building the tree
+	auto tStart = std::chrono::high_resolution_clock::now();
+	m_bSceneLoaded = m_sSceneSnapshot != "" && m_pEntityMngr->LoadSnapshot(m_sSceneSnapshot);
+	if (m_bSceneLoaded)
 	{
-		for (int j = 0; j < nSquare; j++)
+		m_uObjects = m_pEntityMngr->GetEntityCount();
+		//the settings the tree was saved with are kept, otherwise setting them below would rebuild it
+		if (m_pEntityMngr->GetOctree() != nullptr)
 		{
-			uIndex++;
-			m_pEntityMngr->AddEntity("Minecraft\\Cube.obj");
-			vector3 v3Position = vector3(glm::sphericalRand(32.0f)); 
-			matrix4 m4Position = glm::translate(v3Position);
-			m_pEntityMngr->SetModelMatrix(m4Position);
+			m_uOctantLevels = m_pEntityMngr->GetOctreeLevels();
+			m_uOctantIdealCount = m_pEntityMngr->GetOctreeIdealCount();
 		}
 	}
+	else
+	{
+		int nSquare = static_cast<int>(std::sqrt(uInstances));
+		m_uObjects = nSquare * nSquare;
+		uint uIndex = -1;
+		for (int i = 0; i < nSquare; i++)
+		{
+			for (int j = 0; j < nSquare; j++)
+			{
+				uIndex++;
+				m_pEntityMngr->AddEntity("Minecraft\\Cube.obj");
+				vector3 v3Position = vector3(glm::sphericalRand(32.0f)); 
+				matrix4 m4Position = glm::translate(v3Position);
+				m_pEntityMngr->SetModelMatrix(m4Position);
+				m_pEntityMngr->SetStatic(true); //the cubes do not move after this, their pairs are only tested again if they do
+			}
+		}
+	}
+	auto tEnd = std::chrono::high_resolution_clock::now();
+	m_fSceneLoadTime = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
 
 	m_pCameraMngr->SetPositionTargetAndUp(
 			vector3(0.0f, 0.0f, 100.0f), 
@@ -31,47 +51,85 @@ void Application::InitVariables(void)
 			AXIS_Y);					
 
 	m_pLightMngr->SetPosition(vector3(0.0f, 3.0f, 13.0f), 1); 
-	m_uOctantLevels = 0;
-	m_pRoot = new MyOctant(m_uOctantLevels, 5);
+	//the octree settings come from the config file, with the tuner on they are replaced on the first update
+	m_pEntityMngr->SetOctreeIdealCount(m_uOctantIdealCount);
+	m_pEntityMngr->SetOctreeLevels(m_uOctantLevels);
+	m_pEntityMngr->SetOctreeAutoTune(m_bOctreeAutoTune);
+	m_pEntityMngr->SetOctreeBuildBudget(m_fOctreeBuildBudget);
+	//the bodies bounce inside a box a bit larger than the sphere the cubes start in
+	m_pEntityMngr->SetWorldBounds(vector3(-40.0f), vector3(40.0f));
 	m_pEntityMngr->Update();
 }
 
 void Application::Update(void)
 {
+	MY_PROFILE_ZONE("Application::Update");
 	m_pSystem->Update();
 	ArcBall();
 	CameraRotation();
-	m_pEntityMngr->Update();
-	m_pEntityMngr->AddEntityToRenderList(-1, true);
+
+	//the models the loader read are made here, where the OpenGL context is, and handed to their entities under the lock
+	if (m_pEntityMngr->FinalizeAssets(m_fAssetBudget) > 0)
+	{
+		std::unique_lock<std::mutex> lock = m_pSimulation->Lock();
+		m_pEntityMngr->AttachAssets();
+	}
+
+	//Without its thread the simulation steps once per frame, either way the frame draws the latest snapshot
+	m_pSimulation->SetOctreeDisplay(showOctree, m_uOctantID);
+	if (!m_pSimulation->IsRunning())
+		m_pSimulation->Step();
+
+	//the entities of the snapshot are not deleted while the frame adds them to the render list
+	MyEpochGuard guard(m_pEntityMngr->GetEntityEpoch());
+	m_pSnapshot = &m_pSimulation->AcquireSnapshot();
+	m_fCollisionTime = m_pSnapshot->fUpdateTime;
+
+	//the tuner may have picked other octree settings, they are the ones saved in the config file
+	if (m_bOctreeAutoTune)
+	{
+		m_uOctantLevels = m_pSnapshot->uOctreeLevels;
+		m_uOctantIdealCount = m_pSnapshot->uOctreeIdealCount;
+	}
+
+	MY_PROFILE_ZONE("Render list");
+	m_pSimulation->AddToRenderList(*m_pSnapshot, m_pSimulation->GetInterpolation(*m_pSnapshot), true);
 }
 
 void Application::Display(void)
 {
+	MY_PROFILE_ZONE("Application::Display");
 	ClearScreen();
 
+	//the octree belongs to the simulation, its wire cubes come with the snapshot
 	if (showOctree)
 	{
-		if (m_uOctantID == -1)
-		{
-			m_pRoot->Display();
-		}
-		else
+		for (matrix4 const& m4Octant : m_pSnapshot->lOctant)
 		{
-			m_pRoot->Display(m_uOctantID);
+			m_pMeshMngr->AddWireCubeToRenderList(m4Octant, C_YELLOW, RENDER_WIRE);
 		}
 	}
 
 	
 	m_pMeshMngr->AddSkyboxToRenderList();
-	m_uRenderCallCount = m_pMeshMngr->Render();
-	m_pMeshMngr->ClearRenderList();
+	{
+		MY_PROFILE_ZONE("MeshManager::Render");
+		m_uRenderCallCount = m_pMeshMngr->Render();
+		m_pMeshMngr->ClearRenderList();
+	}
 	
-	DrawGUI();
+	{
+		MY_PROFILE_ZONE("DrawGUI");
+		DrawGUI();
+	}
 	
+	MY_PROFILE_ZONE("Present");
 	m_pWindow->display();
 }
 
 void Application::Release(void)
 {
+	SafeDelete(m_pSimulation);
 	ShutdownGUI();
+	MyProfiler::ReleaseInstance();
 }
\ No newline at end of file
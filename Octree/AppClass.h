@@ -7,6 +7,9 @@
 #include "imgui\ImGuiObject.h"
 
 #include "MyOctant.h"
+#include "MyProfiler.h"
+#include "MySimulation.h"
+#include "MyObjFile.h"
 
 namespace Simplex
 {
@@ -18,8 +21,21 @@ public:
 	uint m_uOctantID = -1; 
 	uint m_uObjects = 0; 
 	uint m_uOctantLevels = 0; 
-	MyOctant* m_pRoot = nullptr;
+	uint m_uOctantIdealCount = 5; //entities per octant before it subdivides
+	bool m_bOctreeAutoTune = false; //does the tuner pick the octree levels and ideal count?
+	float m_fOctreeBuildBudget = 0.0f; //microseconds per update spent rebuilding the octree, 0 rebuilds it on a worker
 	bool showOctree = true; 
+	float m_fCollisionTime = 0.0f; //milliseconds spent by the entity manager update on the last frame
+	bool m_bMixedSizes = false; //are the entities scaled to a mix of sizes?
+	bool m_bDynamic = false; //do the entities move and bounce off each other?
+	uint m_uSpawned = 0; //cubes spawned with N that are still in the scene
+	MySimulation* m_pSimulation = nullptr; //runs the entity manager at a fixed step
+	MySimulationSnapshot const* m_pSnapshot = nullptr; //state of the simulation drawn on this frame
+	bool m_bSimulationThread = true; //does the simulation run on its own thread instead of in lockstep?
+	String m_sSceneSnapshot = ""; //binary scene loaded on startup instead of placing the cubes, empty to place them
+	bool m_bSceneLoaded = false; //did the scene come from the snapshot?
+	float m_fSceneLoadTime = 0.0f; //milliseconds InitVariables spent filling the scene
+	float m_fAssetBudget = 2000.0f; //microseconds per frame spent making the textures and meshes of the models loaded by workers
 
 private:
 	String m_sProgrammer = "Israel Anthony - israelanthonyjr@gmail.com";
@@ -29,6 +45,8 @@ private:
 	bool m_bGUI_Console = true; 
 	bool m_bGUI_Test = false; 
 	bool m_bGUI_Controller = false; 
+	bool m_bGUI_Profiler = false; //show the zone timeline and statistics?
+	bool m_bGUI_Counters = false; //show the counters of the collision pipeline?
 
 	uint m_uRenderCallCount = 0; 
 	uint m_uControllerCount = 0; 
@@ -91,6 +109,40 @@ public:
 	*/
 	void Run(void);
 
+	/*
+	USAGE: Runs the collision update on its own for a number of frames, with the entities drifting around their
+	starting positions, and writes the time and the counters of every frame to a JSON file; nothing is drawn
+	ARGUMENTS:
+	-	uint a_uFrames -> updates to run
+	-	uint a_uOctantLevels -> maximum level of the octree
+	-	String a_sFileName = "Octree_benchmark.json" -> path of the report
+	OUTPUT: could the report be written?
+	*/
+	bool RunBenchmark(uint a_uFrames, uint a_uOctantLevels, String a_sFileName = "Octree_benchmark.json");
+
+	/*
+	USAGE: Runs the collision update for a number of frames while reader threads keep querying the octree with
+	the concurrent box, ray and nearest queries; the levels of the octree change every so often so the readers
+	also see trees being swapped. Writes the update times and what the readers got to a JSON file
+	ARGUMENTS:
+	-	uint a_uFrames -> updates to run
+	-	uint a_uReaders -> reader threads
+	-	String a_sFileName = "Octree_stress.json" -> path of the report
+	OUTPUT: did every reader result hold up?
+	*/
+	bool RunStressTest(uint a_uFrames, uint a_uReaders, String a_sFileName = "Octree_stress.json");
+
+	/*
+	USAGE: Writes a grid OBJ of about the given number of vertices to the OBJ folder and loads it through the
+	model, through the fast path, and through the fast path with a cold then a warm model cache; then times the
+	parse alone on one thread and on every core. The times go to a JSON file
+	ARGUMENTS:
+	-	uint a_uVertices -> vertices of the grid
+	-	String a_sFileName = "Octree_objbench.json" -> path of the report
+	OUTPUT: did every load give a model, the parses the same triangles and the cache the same bounds?
+	*/
+	bool RunObjBenchmark(uint a_uVertices, String a_sFileName = "Octree_objbench.json");
+
 	/*
 	USAGE: Destructor
 	*/
@@ -177,6 +229,11 @@ private:
 	ARGUMENTS: float a_fSpeed = 0.005f
 	*/
 	void CameraRotation(float a_fSpeed = 0.005f);
+
+	/*
+	USAGE: Rebuilds the octree of the entity manager around the current entities using m_uOctantLevels
+	*/
+	void RebuildOctree(void);
 #pragma endregion
 
 #pragma region Process Events
@@ -247,6 +304,16 @@ private:
 	*/
 	void DrawGUI(void);
 
+	/*
+	USAGE: Draws the profiler window, a timeline of the zones of a frame and their statistics over the history
+	*/
+	void DrawProfiler(void);
+
+	/*
+	USAGE: Draws the counters of the last collision update, how many pairs each stage discarded
+	*/
+	void DrawCollisionCounters(void);
+
 	/*
 	USAGE: Releases the GUI
 	*/
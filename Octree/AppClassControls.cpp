@@ -107,6 +107,10 @@ void Application::ProcessKeyReleased(sf::Event a_event)
 	case sf::Keyboard::F4:
 		m_pCameraMngr->SetCameraMode(CAM_ORTHO_X);
 		break;
+	case sf::Keyboard::F5:
+		//Save the scene, with SceneSnapshot in the config it is loaded back on the next start
+		m_pEntityMngr->SaveSnapshot(m_sSceneSnapshot != "" ? m_sSceneSnapshot : "Octree_scene.snap");
+		break;
 	case sf::Keyboard::F:
 		bFPSControl = !bFPSControl;
 		m_pCameraMngr->SetFPS(bFPSControl);
@@ -114,46 +118,115 @@ void Application::ProcessKeyReleased(sf::Event a_event)
 	case sf::Keyboard::U:
 		++m_uOctantID;
 		
-		if (m_uOctantID >= m_pRoot->GetOctantCount())
+		//the count comes from the snapshot, the tree belongs to the simulation and may be swapped at any time
+		if (m_pSnapshot == nullptr || m_uOctantID >= m_pSnapshot->uOctantCount)
 			m_uOctantID = - 1;
 		
 		break;
 	case sf::Keyboard::I:
 		--m_uOctantID;
 		
-		if (m_uOctantID >= m_pRoot->GetOctantCount())
+		if (m_pSnapshot == nullptr || m_uOctantID >= m_pSnapshot->uOctantCount)
 			m_uOctantID = - 1;
 		
 		break;
 	case sf::Keyboard::J:
+		//picking the levels by hand turns the tuner off
+		m_bOctreeAutoTune = false;
+		m_pEntityMngr->SetOctreeAutoTune(false);
 		if (m_uOctantLevels < 4)
 		{
-			m_uOctantID = -1; //Reset highlighted octant
-
-			m_pEntityMngr->ClearDimensionSetAll();
 			++m_uOctantLevels;
-
-			SafeDelete(m_pRoot);
-			m_pRoot = new MyOctant(m_uOctantLevels, 5);
+			RebuildOctree();
 
 		}
 		break;
 	case sf::Keyboard::K:
+		m_bOctreeAutoTune = false;
+		m_pEntityMngr->SetOctreeAutoTune(false);
 		if (m_uOctantLevels > 0)
 		{
-			m_uOctantID = -1; //Reset highlighted octant
-
-			m_pEntityMngr->ClearDimensionSetAll();
 			--m_uOctantLevels;
-
-			SafeDelete(m_pRoot);
-			m_pRoot = new MyOctant(m_uOctantLevels, 5);
+			RebuildOctree();
 
 		}
 		break;
 	case sf::Keyboard::Slash: 
 		showOctree = !showOctree;
 		break;
+	case sf::Keyboard::B:
+		//Cycle through the broadphases, the last one is the adaptive mode
+		m_pEntityMngr->SetBroadphase(static_cast<MY_BROADPHASE>((m_pEntityMngr->GetBroadphase() + 1) % BP_COUNT));
+		break;
+	case sf::Keyboard::M:
+		//Toggle between unit cubes and a mix of sizes, the octree smears big entities over many leaves
+		m_bMixedSizes = !m_bMixedSizes;
+		for (uint i = 0; i < m_pEntityMngr->GetEntityCount(); i++)
+		{
+			vector3 v3Position = vector3(m_pEntityMngr->GetModelMatrix(i)[3]);
+			float fScale = m_bMixedSizes ? std::pow(2.0f, glm::linearRand(-2.0f, 3.0f)) : 1.0f;
+			m_pEntityMngr->SetModelMatrix(glm::translate(v3Position) * glm::scale(vector3(fScale)), i);
+		}
+		RebuildOctree();
+		break;
+	case sf::Keyboard::V:
+		//Toggle the motion of the cubes, moving they wake up and push each other around
+		m_bDynamic = !m_bDynamic;
+		for (uint i = 0; i < m_pEntityMngr->GetEntityCount(); i++)
+		{
+			if (m_bDynamic)
+			{
+				//the bigger cubes of the mixed sizes are heavier
+				float fScale = glm::length(vector3(m_pEntityMngr->GetModelMatrix(i)[0]));
+				m_pEntityMngr->AddBody(glm::sphericalRand(8.0f), fScale * fScale * fScale, i);
+			}
+			else
+				m_pEntityMngr->RemoveBody(i);
+			m_pEntityMngr->SetStatic(!m_bDynamic, i);
+		}
+		break;
+	case sf::Keyboard::N:
+		//Spawn a burst of cubes, or despawn the last burst with shift; they are queued for the next step
+		if (m_bModifier)
+		{
+			for (uint i = 0; i < 100 && m_uSpawned > 0; i++)
+			{
+				m_pEntityMngr->QueueDespawn("Spawned_" + std::to_string(--m_uSpawned));
+				--m_uObjects;
+			}
+		}
+		else
+		{
+			for (uint i = 0; i < 100; i++)
+			{
+				m_pEntityMngr->QueueSpawnAsync("Minecraft\\Cube.obj", "Spawned_" + std::to_string(m_uSpawned++),
+					glm::translate(vector3(glm::sphericalRand(32.0f))));
+				++m_uObjects;
+			}
+		}
+		break;
+	case sf::Keyboard::O:
+		//Toggle the octree tuner, turning it on times the configurations right away
+		m_bOctreeAutoTune = !m_bOctreeAutoTune;
+		m_pEntityMngr->SetOctreeAutoTune(m_bOctreeAutoTune);
+		m_uOctantID = -1;
+		break;
+	case sf::Keyboard::P:
+		m_bGUI_Profiler = !m_bGUI_Profiler;
+		break;
+	case sf::Keyboard::C:
+		m_bGUI_Counters = !m_bGUI_Counters;
+		break;
+	case sf::Keyboard::T:
+		//Capture the zones to a trace file until pressed again
+		if (MyProfiler::GetInstance()->IsCapturing())
+			MyProfiler::GetInstance()->StopCapture();
+		else
+		{
+			static uint uCapture = 0;
+			MyProfiler::GetInstance()->StartCapture("Octree_trace_" + std::to_string(uCapture++) + ".json");
+		}
+		break;
 	case sf::Keyboard::LShift:
 	case sf::Keyboard::RShift:
 		m_bModifier = false;
@@ -164,6 +237,13 @@ void Application::ProcessKeyReleased(sf::Event a_event)
 	gui.io.KeyCtrl = a_event.key.control;
 	gui.io.KeyShift = a_event.key.shift;
 }
+void Application::RebuildOctree(void)
+{
+	m_uOctantID = -1; //Reset highlighted octant
+
+	//The octree is rebuilt on a worker, the dimensions of the entities switch over when the new tree is published
+	m_pEntityMngr->SetOctreeLevels(m_uOctantLevels);
+}
 //Joystick
 void Application::ProcessJoystickConnected(uint nController)
 {
@@ -37,9 +37,18 @@ void Application::DrawGUI(void)
 			ImGui::TextColored(v4Color, m_sProgrammer.c_str());
 			ImGui::Text("FrameRate: %.2f [FPS] -> %.3f [ms/frame]\n",
 				ImGui::GetIO().Framerate, 1000.0f / ImGui::GetIO().Framerate);
-			ImGui::Text("Levels in Octree: %d\n", m_uOctantLevels);
+			ImGui::Text("Levels in Octree: %d, %d entities per octant%s\n", m_uOctantLevels, m_uOctantIdealCount,
+				m_bOctreeAutoTune ? " (tuned)" : "");
 			//ImGui::Text("Octants: %d\n", m_pRoot->GetOctantCount());
 			ImGui::Text("Objects: %d\n", m_uObjects);
+			ImGui::Text("Scene: %s in %.1f [ms]\n", m_bSceneLoaded ? "loaded" : "placed", m_fSceneLoadTime);
+			ImGui::Text("Models loading: %u\n", m_pEntityMngr->GetLoadingAssetCount());
+			ImGui::Text("Broadphase: %s -> %.3f [ms/update]\n", m_pSnapshot->sBroadphase.c_str(), m_fCollisionTime);
+			ImGui::Text("Pairs: %d cached -> %d tested\n", m_pSnapshot->uCachedPairs, m_pSnapshot->uNarrowphaseCount);
+			ImGui::Text("Active entities: %d\n", m_pSnapshot->uActiveCount);
+			ImGui::Text("Moving bodies: %d\n", m_pSnapshot->uBodyCount);
+			ImGui::Text("Simulation: %s, step %llu, %u dropped\n", m_pSimulation->IsRunning() ? "threaded" : "lockstep",
+				m_pSnapshot->uStep, m_pSnapshot->uDroppedSteps);
 			ImGui::Separator();
 			ImGui::Text("Control:\n");
 			ImGui::Text("   WASD: Movement\n");
@@ -47,25 +56,207 @@ void Application::DrawGUI(void)
 			ImGui::Text("	 F2: Orthographic X\n");
 			ImGui::Text("	 F3: Orthographic Y\n");
 			ImGui::Text("	 F4: Orthographic Z\n");
+			ImGui::Text("	 F5: Save scene snapshot\n");
 			ImGui::Separator();
 			ImGui::Text("	  U: Increment Octant display\n");
 			ImGui::Text("      I: Decrement Octant display\n");
 			ImGui::Separator();
 			ImGui::Text("	  J: Increment Octree subdivision\n");
 			ImGui::Text("	  K: Decrement Octree subdivision\n");
+			ImGui::Text("	  O: Toggle Octree tuning\n");
 			ImGui::Separator();
 			ImGui::Text("	  /: Enable/Disable Octree Visual\n");
+			ImGui::Text("	  B: Cycle broadphase\n");
+			ImGui::Text("	  M: Toggle mixed entity sizes\n");
+			ImGui::Text("	  V: Toggle moving entities\n");
+			ImGui::Text("	  N: Spawn 100 cubes, shift despawns\n");
+			ImGui::Text("	  P: Toggle profiler\n");
+			ImGui::Text("	  C: Toggle collision counters\n");
+			ImGui::Text("	  T: Start/Stop trace capture\n");
 			ImGui::TextColored(ImColor(255, 255, 0), "Octree\n");
 		}
 		ImGui::End();
 	}
 
+	//Profiler Window
+	if (m_bGUI_Profiler)
+		DrawProfiler();
+
+	//Collision Counters Window
+	if (m_bGUI_Counters)
+		DrawCollisionCounters();
+
 	// Rendering
 	ImGui::Render();
 
 	ImDrawData* pData = ImGui::GetDrawData();
 	RenderDrawLists(pData);
 }
+void Application::DrawCollisionCounters(void)
+{
+	MyCollisionStats const& stats = m_pSnapshot->Stats;
+
+	ImGui::SetNextWindowPos(ImVec2(350, 1), ImGuiSetCond_FirstUseEver);
+	ImGui::SetNextWindowSize(ImVec2(360, 330), ImGuiSetCond_FirstUseEver);
+	ImGui::Begin("Collision Counters", &m_bGUI_Counters);
+	{
+		ImGui::Text("Entities: %u -> %u active\n", stats.uEntityCount, stats.uActiveCount);
+		ImGui::Separator();
+		ImGui::Text("Broadphase: %s\n", m_pSnapshot->sBroadphase.c_str());
+		ImGui::Text("Sharing no leaf or cell: %llu\n", stats.uSpatialCulled);
+		ImGui::Text("Candidate pairs: %u\n", stats.Broadphase.uCandidatePairs);
+		ImGui::Text("Culled by layers: %u\n", stats.Broadphase.uLayerCulled);
+		ImGui::Text("Bounds tests: %u\n", stats.Broadphase.uBoundsTests);
+		ImGui::Text("Duplicates: %u\n", stats.Broadphase.uDuplicatePairs);
+		ImGui::Text("Nodes visited: %u\n", stats.Broadphase.uNodesVisited);
+		ImGui::Text("Pairs reported: %u\n", stats.uPairsReported);
+		ImGui::Separator();
+		ImGui::Text("Narrowphase tests: %u (%u cached)\n", stats.uNarrowphaseTests, stats.uCachedResults);
+		ImGui::Text("Contacts: %u\n", stats.uContacts);
+
+		if (stats.uLeafCount > 0)
+		{
+			ImGui::Separator();
+			ImGui::Text("Leaves: %u, %.2f leaves per entity\n", stats.uLeafCount, stats.fDuplication);
+			ImGui::Text("Splits: %u, %u kept whole, %.0f pair tests saved\n", stats.uSplitOctants, stats.uKeptOctants, stats.fSplitSaving);
+			float fBucket[MyCollisionStats::LEAF_BUCKETS];
+			for (uint i = 0; i < MyCollisionStats::LEAF_BUCKETS; i++)
+				fBucket[i] = static_cast<float>(stats.lLeafHistogram[i]);
+			ImGui::PlotHistogram("##leaves", fBucket, MyCollisionStats::LEAF_BUCKETS, 0, "leaves by entities held: 1, 2+, 4+ ... 32+",
+				0.0f, FLT_MAX, ImVec2(ImGui::GetContentRegionAvailWidth(), 80));
+		}
+
+		//The budget slices the octree rebuilds over the updates, the old tree is used until the new one is done
+		ImGui::Separator();
+		if (ImGui::SliderFloat("Rebuild budget", &m_fOctreeBuildBudget, 0.0f, 2000.0f, m_fOctreeBuildBudget > 0.0f ? "%.0f us/update" : "worker thread"))
+		{
+			std::unique_lock<std::mutex> lock = m_pSimulation->Lock();
+			m_pEntityMngr->SetOctreeBuildBudget(m_fOctreeBuildBudget);
+		}
+		if (m_pSnapshot->fOctreeBuildProgress >= 0.0f)
+			ImGui::ProgressBar(m_pSnapshot->fOctreeBuildProgress, ImVec2(-1, 0), m_fOctreeBuildBudget > 0.0f ? nullptr : "rebuilding on the worker");
+		else
+			ImGui::Text("Rebuild: idle\n");
+
+		std::vector<MyOctreeTrial> const& lTrial = m_pSnapshot->lTrial;
+		if (!lTrial.empty())
+		{
+			//The tuner keeps its trials cheapest first, the first one is in use
+			ImGui::Separator();
+			ImGui::Text("Octree tuning: %u configurations%s\n", static_cast<uint>(lTrial.size()), m_bOctreeAutoTune ? "" : " (off)");
+			for (uint i = 0; i < lTrial.size() && i < 5; i++)
+			{
+				ImGui::Text("%s%u levels, %2u ideal: %.3f + %.3f [ms], %u leaves\n", i == 0 ? "> " : "  ", lTrial[i].uLevels,
+					lTrial[i].uIdealCount, lTrial[i].fBuildTime, lTrial[i].fQueryTime, lTrial[i].uLeafCount);
+			}
+		}
+
+		MyMemoryReport const& memory = m_pSnapshot->Memory;
+		if (memory.uNodeCount > 0)
+		{
+			ImGui::Separator();
+			ImGui::Text("Memory: %.1f KB, %.1f bytes per entity\n", memory.GetTotal() / 1024.0f, memory.GetBytesPerEntity());
+			ImGui::Text("Nodes: %u, %.1f KB\n", memory.uNodeCount, memory.uNodeBytes / 1024.0f);
+			ImGui::Text("Entity indices: %.1f KB\n", memory.uIndexBytes / 1024.0f);
+			ImGui::Text("Slack: %.1f KB\n", memory.uSlackBytes / 1024.0f);
+			ImGui::Text("Dimension arrays: %.1f KB\n", memory.uDimensionBytes / 1024.0f);
+			ImGui::Text("Auxiliary: %.1f KB\n", memory.uAuxiliaryBytes / 1024.0f);
+		}
+	}
+	ImGui::End();
+}
+void Application::DrawProfiler(void)
+{
+	MyProfiler* pProfiler = MyProfiler::GetInstance();
+	static int nFrameAge = 0; //frame shown in the timeline, 0 is the last one
+
+	ImGui::SetNextWindowPos(ImVec2(1, 400), ImGuiSetCond_FirstUseEver);
+	ImGui::SetNextWindowSize(ImVec2(560, 420), ImGuiSetCond_FirstUseEver);
+	ImGui::Begin("Profiler", &m_bGUI_Profiler);
+	{
+		uint uFrames = pProfiler->GetFrameCount();
+		if (uFrames == 0)
+		{
+#if MY_PROFILE
+			ImGui::Text("Waiting for the first frame\n");
+#else
+			ImGui::Text("The zones are compiled out, build with MY_PROFILE=1\n");
+#endif
+			ImGui::End();
+			return;
+		}
+
+		//Frame times, oldest on the left
+		float fFrameTime[MyProfiler::FRAME_HISTORY];
+		for (uint i = 0; i < uFrames; i++)
+		{
+			MyProfiler::Frame const& frame = pProfiler->GetFrame(uFrames - 1 - i);
+			fFrameTime[i] = (frame.uEnd - frame.uStart) / 1000000.0f;
+		}
+		ImGui::PlotHistogram("##frames", fFrameTime, uFrames, 0, "frame [ms]", 0.0f, FLT_MAX, ImVec2(ImGui::GetContentRegionAvailWidth(), 60));
+		ImGui::SliderInt("Frames ago", &nFrameAge, 0, uFrames - 1);
+		nFrameAge = std::min(nFrameAge, static_cast<int>(uFrames) - 1);
+
+		//Timeline of the selected frame, one row per depth and thread
+		MyProfiler::Frame const& frame = pProfiler->GetFrame(nFrameAge);
+		uint uRows = 1;
+		for (uint i = 0; i < frame.lEvent.size(); i++)
+		{
+			if (frame.lEvent[i].eType == PE_ZONE)
+				uRows = std::max(uRows, frame.lEvent[i].uThread * 8 + frame.lEvent[i].uDepth + 1);
+		}
+
+		const float fRowHeight = 18.0f;
+		float fWidth = ImGui::GetContentRegionAvailWidth();
+		float fScale = fWidth / std::max(1.0f, static_cast<float>(frame.uEnd - frame.uStart));
+		ImVec2 v2Origin = ImGui::GetCursorScreenPos();
+		ImDrawList* pDrawList = ImGui::GetWindowDrawList();
+		for (uint i = 0; i < frame.lEvent.size(); i++)
+		{
+			MyProfileEvent const& event = frame.lEvent[i];
+			if (event.eType != PE_ZONE)
+				continue;
+
+			uint uRow = event.uThread * 8 + event.uDepth;
+			ImVec2 v2Min(v2Origin.x + (event.uStart - frame.uStart) * fScale, v2Origin.y + uRow * fRowHeight);
+			ImVec2 v2Max(std::max(v2Min.x + 1.0f, v2Origin.x + (event.uEnd - frame.uStart) * fScale), v2Min.y + fRowHeight - 1.0f);
+
+			//the color comes from the name so a zone keeps it from frame to frame
+			int nHash = static_cast<int>(std::hash<String>()(event.sName) & 0x7FFFFF);
+			ImU32 uColor = ImColor(96 + (nHash & 0x7F), 96 + ((nHash >> 8) & 0x7F), 96 + ((nHash >> 16) & 0x7F));
+			pDrawList->AddRectFilled(v2Min, v2Max, uColor);
+			if (v2Max.x - v2Min.x > 40.0f)
+				pDrawList->AddText(ImVec2(v2Min.x + 2.0f, v2Min.y + 2.0f), ImColor(0, 0, 0), event.sName);
+			if (ImGui::IsMouseHoveringRect(v2Min, v2Max))
+				ImGui::SetTooltip("%s: %.3f [ms]", event.sName, (event.uEnd - event.uStart) / 1000000.0f);
+		}
+		ImGui::Dummy(ImVec2(fWidth, uRows * fRowHeight));
+
+		//Statistics of every zone over the history
+		std::vector<MyProfiler::ZoneStats> lStats;
+		pProfiler->GetZoneStats(lStats);
+		ImGui::Separator();
+		ImGui::Columns(4, "zones");
+		ImGui::Text("Zone"); ImGui::NextColumn();
+		ImGui::Text("Min [ms]"); ImGui::NextColumn();
+		ImGui::Text("Avg [ms]"); ImGui::NextColumn();
+		ImGui::Text("P99 [ms]"); ImGui::NextColumn();
+		ImGui::Separator();
+		for (uint i = 0; i < lStats.size(); i++)
+		{
+			ImGui::Text("%s", lStats[i].sName.c_str()); ImGui::NextColumn();
+			ImGui::Text("%.3f", lStats[i].fMin); ImGui::NextColumn();
+			ImGui::Text("%.3f", lStats[i].fAverage); ImGui::NextColumn();
+			ImGui::Text("%.3f", lStats[i].fP99); ImGui::NextColumn();
+		}
+		ImGui::Columns(1);
+		if (pProfiler->IsCapturing())
+			ImGui::TextColored(ImColor(255, 0, 0), "Capturing to %s\n", pProfiler->GetCaptureName().c_str());
+		if (pProfiler->GetDroppedCount() > 0)
+			ImGui::TextColored(ImColor(255, 0, 0), "Dropped zones: %llu\n", pProfiler->GetDroppedCount());
+	}
+	ImGui::End();
+}
 void Application::RenderDrawLists(ImDrawData* draw_data)
 {
 	// Avoid rendering when minimized, scale coordinates for retina displays (screen coordinates != framebuffer coordinates)
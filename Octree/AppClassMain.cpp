@@ -1,4 +1,6 @@
 #include "AppClass.h"
+#include <chrono>
+#include <random>
 
 using namespace Simplex;
 
@@ -77,6 +79,9 @@ void Application::Run(void)
 	Init();
 
 	m_bRunning = true;
+	MY_PROFILE_THREAD("Main");
+	if (m_bSimulationThread)
+		m_pSimulation->Start();
 	sf::Vector2i pos = m_pWindow->getPosition();
 	sf::Vector2u size = m_pWindow->getSize();
 	while (m_bRunning)
@@ -122,8 +127,12 @@ void Application::Run(void)
 				ProcessKeyPressed(appEvent);
 				break;
 			case sf::Event::KeyReleased:
+			{
+				//the keys edit the entity manager, the edits land between two steps of the simulation
+				std::unique_lock<std::mutex> lock = m_pSimulation->Lock();
 				ProcessKeyReleased(appEvent);
 				break;
+			}
 			case sf::Event::TextEntered:
 				if (appEvent.text.unicode > 0 && appEvent.text.unicode < 0x10000)
 					ImGui::GetIO().AddInputCharacter(appEvent.text.unicode);
@@ -157,11 +166,351 @@ void Application::Run(void)
 
 		Update();
 		Display();
+		MY_PROFILE_FRAME();
 	}
 
+	m_pSimulation->Stop();
 	WriteConfig();
 }
 
+bool Application::RunBenchmark(uint a_uFrames, uint a_uOctantLevels, String a_sFileName)
+{
+	Init();
+	MY_PROFILE_THREAD("Main");
+
+	FILE* pFile;
+	fopen_s(&pFile, a_sFileName.c_str(), "w");
+	if (!pFile)
+		return false;
+
+	//the levels asked for are the ones measured, the tuner stays off
+	m_bOctreeAutoTune = false;
+	m_pEntityMngr->SetOctreeAutoTune(false);
+	m_uOctantLevels = a_uOctantLevels;
+	RebuildOctree();
+
+	//The entities drift around where InitVariables placed them so every update has pairs to look at
+	uint uEntities = m_pEntityMngr->GetEntityCount();
+	std::vector<matrix4> lStart(uEntities);
+	for (uint i = 0; i < uEntities; i++)
+		lStart[i] = m_pEntityMngr->GetModelMatrix(i);
+
+	fprintf(pFile, "{\n\"entities\": %u,\n\"broadphase\": \"%s\",\n\"octreeLevels\": %u,\n\"sceneLoadMs\": %.4f,\n\"frames\": [",
+		uEntities, m_pEntityMngr->GetBroadphaseName().c_str(), a_uOctantLevels, m_fSceneLoadTime);
+
+	float fTotal = 0.0f;
+	float fWorst = 0.0f;
+	for (uint uFrame = 0; uFrame < a_uFrames; uFrame++)
+	{
+		for (uint i = 0; i < uEntities; i++)
+		{
+			float fPhase = uFrame * 0.05f + i;
+			matrix4 m4World = lStart[i];
+			m4World[3] += vector4(std::sin(fPhase), std::cos(fPhase * 1.3f), std::sin(fPhase * 0.7f), 0.0f);
+			m_pEntityMngr->SetModelMatrix(m4World, i);
+		}
+
+		auto tStart = std::chrono::high_resolution_clock::now();
+		m_pEntityMngr->Update();
+		auto tEnd = std::chrono::high_resolution_clock::now();
+		float fTime = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+		fTotal += fTime;
+		fWorst = std::max(fWorst, fTime);
+
+		MyCollisionStats const& stats = m_pEntityMngr->GetCollisionStats();
+		fprintf(pFile, "%s\n{\"ms\": %.4f, \"active\": %u, \"spatialCulled\": %llu, \"candidates\": %u, \"layerCulled\": %u, "
+			"\"boundsTests\": %u, \"duplicates\": %u, \"nodesVisited\": %u, \"pairs\": %u, \"narrowphaseTests\": %u, "
+			"\"cached\": %u, \"contacts\": %u, \"leaves\": %u, \"leavesPerEntity\": %.3f, \"splits\": %u, \"keptWhole\": %u, "
+			"\"splitSaving\": %.1f, \"leafHistogram\": [",
+			uFrame == 0 ? "" : ",", fTime, stats.uActiveCount, stats.uSpatialCulled, stats.Broadphase.uCandidatePairs,
+			stats.Broadphase.uLayerCulled, stats.Broadphase.uBoundsTests, stats.Broadphase.uDuplicatePairs,
+			stats.Broadphase.uNodesVisited, stats.uPairsReported, stats.uNarrowphaseTests, stats.uCachedResults,
+			stats.uContacts, stats.uLeafCount, stats.fDuplication, stats.uSplitOctants, stats.uKeptOctants, stats.fSplitSaving);
+		for (uint i = 0; i < MyCollisionStats::LEAF_BUCKETS; i++)
+			fprintf(pFile, "%s%u", i == 0 ? "" : ", ", stats.lLeafHistogram[i]);
+		fprintf(pFile, "]}");
+
+		MY_PROFILE_FRAME();
+	}
+
+	//Traversal cost, a box query and a ray toward the origin from every entity
+	float fQuery = 0.0f;
+	float fRaycast = 0.0f;
+	std::vector<uint> lFound;
+	for (uint i = 0; i < uEntities; i++)
+	{
+		vector3 v3Position = vector3(m_pEntityMngr->GetModelMatrix(i)[3]);
+		lFound.clear();
+		auto tStart = std::chrono::high_resolution_clock::now();
+		m_pEntityMngr->QueryAABB(v3Position - vector3(2.0f), v3Position + vector3(2.0f), lFound);
+		auto tEnd = std::chrono::high_resolution_clock::now();
+		fQuery += std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+
+		uint uHit = 0;
+		float fDistance = 0.0f;
+		vector3 v3Direction = glm::length(v3Position) > 0.0f ? -glm::normalize(v3Position) : AXIS_X;
+		tStart = std::chrono::high_resolution_clock::now();
+		m_pEntityMngr->Raycast(v3Position, v3Direction, 100.0f, uHit, fDistance);
+		tEnd = std::chrono::high_resolution_clock::now();
+		fRaycast += std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+	}
+
+	//Memory held by the structure after the last update, in bytes
+	MyMemoryReport memory;
+	m_pEntityMngr->GetMemoryReport(memory);
+	fprintf(pFile, "\n],\n\"memory\": {\"nodes\": %u, \"nodeBytes\": %zu, \"indexBytes\": %zu, \"slackBytes\": %zu, "
+		"\"dimensionBytes\": %zu, \"auxiliaryBytes\": %zu, \"totalBytes\": %zu, \"bytesPerEntity\": %.2f},",
+		memory.uNodeCount, memory.uNodeBytes, memory.uIndexBytes, memory.uSlackBytes, memory.uDimensionBytes,
+		memory.uAuxiliaryBytes, memory.GetTotal(), memory.GetBytesPerEntity());
+	fprintf(pFile, "\n\"queryMs\": %.4f,\n\"raycastMs\": %.4f,", fQuery, fRaycast);
+	fprintf(pFile, "\n\"averageMs\": %.4f,\n\"worstMs\": %.4f\n}\n", a_uFrames > 0 ? fTotal / a_uFrames : 0.0f, fWorst);
+	fclose(pFile);
+	return true;
+}
+
+bool Application::RunStressTest(uint a_uFrames, uint a_uReaders, String a_sFileName)
+{
+	Init();
+	MY_PROFILE_THREAD("Main");
+
+	FILE* pFile;
+	fopen_s(&pFile, a_sFileName.c_str(), "w");
+	if (!pFile)
+		return false;
+
+	m_bOctreeAutoTune = false;
+	m_pEntityMngr->SetOctreeAutoTune(false);
+	m_pEntityMngr->SetBroadphase(BP_OCTREE);
+	m_pEntityMngr->Update();
+	m_pEntityMngr->SetConcurrentQueries(true);
+
+	//the entity count stays the same so every index a reader gets has to be below it
+	uint uEntities = m_pEntityMngr->GetEntityCount();
+	std::vector<matrix4> lStart(uEntities);
+	for (uint i = 0; i < uEntities; i++)
+		lStart[i] = m_pEntityMngr->GetModelMatrix(i);
+
+	//what each reader got, written by the reader and read once it has stopped
+	struct ReaderStats
+	{
+		unsigned long long uQueries = 0;
+		unsigned long long uFound = 0;
+		unsigned long long uHits = 0;
+		unsigned long long uInvalid = 0;
+	};
+	std::vector<ReaderStats> lReader(a_uReaders);
+	std::atomic<bool> bReading(true);
+	std::vector<std::thread> lThread;
+	for (uint uReader = 0; uReader < a_uReaders; uReader++)
+	{
+		lThread.push_back(std::thread([this, uReader, uEntities, &lReader, &bReading]()
+		{
+			MY_PROFILE_THREAD("Reader");
+			std::mt19937 random(uReader + 1);
+			std::uniform_real_distribution<float> position(-40.0f, 40.0f);
+			ReaderStats stats;
+			std::vector<uint> lFound;
+			while (bReading)
+			{
+				//a box, a ray toward the origin and the 8 closest entities around a random point
+				vector3 v3Point(position(random), position(random), position(random));
+				lFound.clear();
+				m_pEntityMngr->QueryAABBConcurrent(v3Point - vector3(4.0f), v3Point + vector3(4.0f), lFound);
+				for (uint i = 0; i < lFound.size(); i++)
+				{
+					if (lFound[i] >= uEntities || (i > 0 && lFound[i] <= lFound[i - 1]))
+						++stats.uInvalid;
+				}
+				stats.uFound += lFound.size();
+
+				uint uHit = 0;
+				float fDistance = 0.0f;
+				if (glm::length(v3Point) > 0.0f && m_pEntityMngr->RaycastConcurrent(v3Point, -v3Point, 100.0f, uHit, fDistance))
+				{
+					++stats.uHits;
+					if (uHit >= uEntities || fDistance < 0.0f || fDistance > 100.0f)
+						++stats.uInvalid;
+				}
+
+				lFound.clear();
+				m_pEntityMngr->QueryNearestConcurrent(v3Point, 8, lFound);
+				if (lFound.size() > 8)
+					++stats.uInvalid;
+				for (uint i = 0; i < lFound.size(); i++)
+				{
+					if (lFound[i] >= uEntities || std::count(lFound.begin(), lFound.end(), lFound[i]) > 1)
+						++stats.uInvalid;
+				}
+
+				stats.uQueries += 3;
+			}
+			lReader[uReader] = stats;
+		}));
+	}
+
+	//the writer drifts the entities and changes the levels every 50 updates, the readers go on meanwhile
+	float fTotal = 0.0f;
+	float fWorst = 0.0f;
+	for (uint uFrame = 0; uFrame < a_uFrames; uFrame++)
+	{
+		for (uint i = 0; i < uEntities; i++)
+		{
+			float fPhase = uFrame * 0.05f + i;
+			matrix4 m4World = lStart[i];
+			m4World[3] += vector4(std::sin(fPhase), std::cos(fPhase * 1.3f), std::sin(fPhase * 0.7f), 0.0f);
+			m_pEntityMngr->SetModelMatrix(m4World, i);
+		}
+		if (uFrame % 50 == 49)
+			m_pEntityMngr->SetOctreeLevels(1 + (uFrame / 50) % 4);
+
+		auto tStart = std::chrono::high_resolution_clock::now();
+		m_pEntityMngr->Update();
+		auto tEnd = std::chrono::high_resolution_clock::now();
+		float fTime = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+		fTotal += fTime;
+		fWorst = std::max(fWorst, fTime);
+		MY_PROFILE_FRAME();
+	}
+
+	bReading = false;
+	for (std::thread& thread : lThread)
+		thread.join();
+	m_pEntityMngr->SetConcurrentQueries(false);
+
+	ReaderStats total;
+	fprintf(pFile, "{\n\"entities\": %u,\n\"frames\": %u,\n\"readers\": [", uEntities, a_uFrames);
+	for (uint uReader = 0; uReader < a_uReaders; uReader++)
+	{
+		ReaderStats const& stats = lReader[uReader];
+		fprintf(pFile, "%s\n{\"queries\": %llu, \"found\": %llu, \"rayHits\": %llu, \"invalid\": %llu}",
+			uReader == 0 ? "" : ",", stats.uQueries, stats.uFound, stats.uHits, stats.uInvalid);
+		total.uQueries += stats.uQueries;
+		total.uInvalid += stats.uInvalid;
+	}
+	fprintf(pFile, "\n],\n\"queries\": %llu,\n\"invalid\": %llu,", total.uQueries, total.uInvalid);
+	fprintf(pFile, "\n\"averageMs\": %.4f,\n\"worstMs\": %.4f\n}\n", a_uFrames > 0 ? fTotal / a_uFrames : 0.0f, fWorst);
+	fclose(pFile);
+	return total.uInvalid == 0;
+}
+
+bool Application::RunObjBenchmark(uint a_uVertices, String a_sFileName)
+{
+	Init();
+	MY_PROFILE_THREAD("Main");
+
+	FILE* pFile;
+	fopen_s(&pFile, a_sFileName.c_str(), "w");
+	if (!pFile)
+		return false;
+
+	//a wavy grid with every attribute, cut in groups of rows with a material switch every other group
+	uint uSide = std::max(2u, static_cast<uint>(std::sqrt(static_cast<float>(a_uVertices))));
+	String sModel = "ObjBenchmark.obj";
+	String sPath = m_pSystem->m_pFolder->GetFolderRoot() + m_pSystem->m_pFolder->GetFolderData() +
+		m_pSystem->m_pFolder->GetFolderMOBJ() + sModel;
+	FILE* pObj;
+	fopen_s(&pObj, sPath.c_str(), "w");
+	if (!pObj)
+	{
+		fclose(pFile);
+		return false;
+	}
+	fprintf(pObj, "# grid of %u x %u vertices\n", uSide, uSide);
+	for (uint y = 0; y < uSide; y++)
+	{
+		for (uint x = 0; x < uSide; x++)
+		{
+			fprintf(pObj, "v %.6f %.6f %.6f\n", x * 0.1f, std::sin(x * 0.3f) * std::cos(y * 0.2f), y * 0.1f);
+			fprintf(pObj, "vt %.6f %.6f\n", x / (uSide - 1.0f), y / (uSide - 1.0f));
+			fprintf(pObj, "vn 0.000000 1.000000 0.000000\n");
+		}
+	}
+	for (uint y = 1; y < uSide; y++)
+	{
+		if (y % 64 == 1)
+		{
+			fprintf(pObj, "g Rows%u\n", y / 64);
+			fprintf(pObj, "usemtl %s\n", (y / 64) % 2 == 0 ? "Floor_SG" : "Wall_SG");
+		}
+		for (uint x = 1; x < uSide; x++)
+		{
+			uint a = (y - 1) * uSide + x, b = a + 1, c = b + uSide, d = a + uSide;
+			fprintf(pObj, "f %u/%u/%u %u/%u/%u %u/%u/%u %u/%u/%u\n", a, a, a, b, b, b, c, c, c, d, d, d);
+		}
+	}
+	fclose(pObj);
+
+	//loads through the model and through the fast path, with the fast path setting put back after
+	bool bFastPath = MyObjFile::GetFastPath();
+	Model* pModel = new Model();
+	auto tStart = std::chrono::high_resolution_clock::now();
+	bool bModelLoaded = pModel->Load(sModel) != "";
+	auto tEnd = std::chrono::high_resolution_clock::now();
+	float fModelLoad = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+	SafeDelete(pModel);
+
+	bool bCache = MyObjFile::GetCache();
+	MyObjFile::SetFastPath(true);
+	MyObjFile::SetCache(false);
+	pModel = new Model();
+	tStart = std::chrono::high_resolution_clock::now();
+	bool bFastLoaded = MyObjFile::LoadModel(pModel, sModel) != "";
+	tEnd = std::chrono::high_resolution_clock::now();
+	float fFastLoad = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+	SafeDelete(pModel);
+
+	//with the cache, the first load parses and writes it and the second one reads it back
+	MyObjFile::SetCache(true);
+	float lCacheLoad[2] = {};
+	MyObjBounds lBounds[2];
+	remove((sPath + ".cache").c_str());
+	for (uint i = 0; i < 2; i++)
+	{
+		pModel = new Model();
+		tStart = std::chrono::high_resolution_clock::now();
+		bFastLoaded = MyObjFile::LoadModel(pModel, sModel, &lBounds[i]) != "" && bFastLoaded;
+		tEnd = std::chrono::high_resolution_clock::now();
+		lCacheLoad[i] = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+		SafeDelete(pModel);
+	}
+	MyObjFile::SetFastPath(bFastPath);
+	MyObjFile::SetCache(bCache);
+
+	//the parse alone, on one thread then on every core, has to give the same triangles
+	MyObjFile single;
+	tStart = std::chrono::high_resolution_clock::now();
+	bool bParsed = single.Load(sPath, 1);
+	tEnd = std::chrono::high_resolution_clock::now();
+	float fParseSingle = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+
+	MyObjFile parallel;
+	tStart = std::chrono::high_resolution_clock::now();
+	bParsed = parallel.Load(sPath) && bParsed;
+	tEnd = std::chrono::high_resolution_clock::now();
+	float fParseParallel = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+
+	std::vector<MyObjCorner> const& lSingle = single.GetCornerList();
+	std::vector<MyObjCorner> const& lParallel = parallel.GetCornerList();
+	bool bSame = bParsed && lSingle.size() == lParallel.size() && single.GetPositionList() == parallel.GetPositionList() &&
+		single.GetGroupList().size() == parallel.GetGroupList().size() && lBounds[0].bValid && lBounds[1].bValid &&
+		lBounds[0].v3Min == lBounds[1].v3Min && lBounds[0].v3Max == lBounds[1].v3Max;
+	for (uint i = 0; i < lSingle.size() && bSame; i++)
+	{
+		bSame = lSingle[i].nPosition == lParallel[i].nPosition && lSingle[i].nUV == lParallel[i].nUV &&
+			lSingle[i].nNormal == lParallel[i].nNormal;
+	}
+
+	fprintf(pFile, "{\n\"vertices\": %u,\n\"triangles\": %u,\n\"threads\": %u,", uSide * uSide,
+		static_cast<uint>(lSingle.size() / 3), std::max(1u, std::thread::hardware_concurrency()));
+	fprintf(pFile, "\n\"modelLoadMs\": %.4f,\n\"fastLoadMs\": %.4f,", fModelLoad, fFastLoad);
+	fprintf(pFile, "\n\"coldCacheLoadMs\": %.4f,\n\"warmCacheLoadMs\": %.4f,", lCacheLoad[0], lCacheLoad[1]);
+	fprintf(pFile, "\n\"parseSingleMs\": %.4f,\n\"parseParallelMs\": %.4f,", fParseSingle, fParseParallel);
+	fprintf(pFile, "\n\"loaded\": %s,\n\"same\": %s\n}\n", bModelLoaded && bFastLoaded ? "true" : "false",
+		bSame ? "true" : "false");
+	fclose(pFile);
+	return bModelLoaded && bFastLoaded && bSame;
+}
+
 void Application::ClearScreen(vector4 a_v4ClearColor)
 {
 	if (a_v4ClearColor != vector4(-1.0f))
@@ -248,6 +597,8 @@ void Application::Init(String a_sApplicationName, uint a_uWidth, uint a_uHeight,
 
 	InitVariables();
 
+	m_pSimulation = new MySimulation(m_pEntityMngr);
+
 	bInitializated = true;
 }
 
@@ -362,6 +713,59 @@ void Application::ReadConfig(void)
 			sscanf_s(reader.m_sLine.c_str(), "AmbientPower: %f", &fValue);
 			m_pLightMngr->SetIntensity(fValue, 0);
 		}
+		else if (sWord == "SimulationThread:")
+		{
+			int nValue;
+			sscanf_s(reader.m_sLine.c_str(), "SimulationThread: %d", &nValue);
+			m_bSimulationThread = nValue != 0;
+		}
+		else if (sWord == "OctreeAutoTune:")
+		{
+			int nValue;
+			sscanf_s(reader.m_sLine.c_str(), "OctreeAutoTune: %d", &nValue);
+			m_bOctreeAutoTune = nValue != 0;
+		}
+		else if (sWord == "OctreeLevels:")
+		{
+			int nValue;
+			sscanf_s(reader.m_sLine.c_str(), "OctreeLevels: %d", &nValue);
+			m_uOctantLevels = static_cast<uint>(nValue);
+		}
+		else if (sWord == "OctreeIdealCount:")
+		{
+			int nValue;
+			sscanf_s(reader.m_sLine.c_str(), "OctreeIdealCount: %d", &nValue);
+			m_uOctantIdealCount = static_cast<uint>(std::max(nValue, 1));
+		}
+		else if (sWord == "OctreeBuildBudget:")
+		{
+			float fValue;
+			sscanf_s(reader.m_sLine.c_str(), "OctreeBuildBudget: %f", &fValue);
+			m_fOctreeBuildBudget = std::max(fValue, 0.0f);
+		}
+		else if (sWord == "SceneSnapshot:")
+		{
+			sscanf_s(reader.m_sLine.c_str(), "SceneSnapshot: %s", zsTemp, nLenght);
+			m_sSceneSnapshot = zsTemp;
+		}
+		else if (sWord == "FastOBJ:")
+		{
+			int nValue;
+			sscanf_s(reader.m_sLine.c_str(), "FastOBJ: %d", &nValue);
+			MyObjFile::SetFastPath(nValue != 0);
+		}
+		else if (sWord == "ModelCache:")
+		{
+			int nValue;
+			sscanf_s(reader.m_sLine.c_str(), "ModelCache: %d", &nValue);
+			MyObjFile::SetCache(nValue != 0);
+		}
+		else if (sWord == "AssetBudget:")
+		{
+			float fValue;
+			sscanf_s(reader.m_sLine.c_str(), "AssetBudget: %f", &fValue);
+			m_fAssetBudget = std::max(fValue, 0.0f);
+		}
 		else if (sWord == "Data:")
 		{
 			sscanf_s(reader.m_sLine.c_str(), "Data: %s", zsTemp, nLenght);
@@ -444,6 +848,29 @@ void Application::WriteConfig(void)
 	fprintf(pFile, "\n\nBackground: [%.3f,%.3f,%.3f,%.3f]",
 		m_v4ClearColor.r, m_v4ClearColor.g, m_v4ClearColor.b, m_v4ClearColor.a);
 
+	fprintf(pFile, "\n\n# Simulation, 0 runs it in lockstep with the rendering");
+	fprintf(pFile, "\nSimulationThread: %d", m_bSimulationThread ? 1 : 0);
+
+	fprintf(pFile, "\n\n# Octree, with the tuner on the levels and ideal count are the ones it picked");
+	fprintf(pFile, "\nOctreeAutoTune: %d", m_bOctreeAutoTune ? 1 : 0);
+	fprintf(pFile, "\nOctreeLevels: %u", m_uOctantLevels);
+	fprintf(pFile, "\nOctreeIdealCount: %u", m_uOctantIdealCount);
+	fprintf(pFile, "\n# Microseconds per update spent rebuilding, 0 rebuilds on a worker thread");
+	fprintf(pFile, "\nOctreeBuildBudget: %.0f", m_fOctreeBuildBudget);
+
+	fprintf(pFile, "\n\n# Scene loaded on startup instead of placing the cubes, F5 saves the current one");
+	if (m_sSceneSnapshot != "")
+		fprintf(pFile, "\nSceneSnapshot: %s", m_sSceneSnapshot.c_str());
+	else
+		fprintf(pFile, "\n# SceneSnapshot: Octree_scene.snap");
+
+	fprintf(pFile, "\n\n# OBJ models, 1 parses them from a mapped file on every core, 0 leaves them to the model");
+	fprintf(pFile, "\nFastOBJ: %d", MyObjFile::GetFastPath() ? 1 : 0);
+	fprintf(pFile, "\n# 1 keeps a .cache next to each OBJ the fast path parses and reads it while the OBJ is unchanged");
+	fprintf(pFile, "\nModelCache: %d", MyObjFile::GetCache() ? 1 : 0);
+	fprintf(pFile, "\n# Microseconds per frame spent making the models the workers loaded, at least one texture or model is made");
+	fprintf(pFile, "\nAssetBudget: %.0f", m_fAssetBudget);
+
 	fprintf(pFile, "\n\n# Folders:");
 	fprintf(pFile, "\nData:		%s", m_pSystem->m_pFolder->GetFolderData().c_str());
 	fprintf(pFile, "\nBTO:		%s", m_pSystem->m_pFolder->GetFolderMBTO().c_str());
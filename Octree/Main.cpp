@@ -1,11 +1,45 @@
 #include "Main.h"
 
-int main(void)
+int main(int argc, char* argv[])
 {
 	using namespace Simplex;
 	Application* pApp = new Application();
 	pApp->Init("", RES_C_1920x1080_16x9_FULLHD, false, false);
-	pApp->Run();
+
+	//--capture N writes the zones of the first N frames to a trace file
+	//--benchmark N runs N collision updates without drawing and writes their counters, --levels L sets the octree depth
+	//--stress N runs N collision updates while --readers R threads query the octree concurrently
+	//--objbench V loads a grid OBJ of about V vertices through the model and through the fast parser
+	int nBenchmark = 0;
+	int nLevels = 3;
+	int nStress = 0;
+	int nReaders = 8;
+	int nObjVertices = 0;
+	for (int i = 1; i + 1 < argc; ++i)
+	{
+		if (String(argv[i]) == "--capture")
+			MyProfiler::GetInstance()->StartCapture("Octree_trace.json", std::max(1, std::atoi(argv[i + 1])));
+		else if (String(argv[i]) == "--benchmark")
+			nBenchmark = std::max(1, std::atoi(argv[i + 1]));
+		else if (String(argv[i]) == "--levels")
+			nLevels = std::max(0, std::atoi(argv[i + 1]));
+		else if (String(argv[i]) == "--stress")
+			nStress = std::max(1, std::atoi(argv[i + 1]));
+		else if (String(argv[i]) == "--readers")
+			nReaders = std::max(1, std::atoi(argv[i + 1]));
+		else if (String(argv[i]) == "--objbench")
+			nObjVertices = std::max(4, std::atoi(argv[i + 1]));
+	}
+
+	int nResult = 0;
+	if (nBenchmark > 0)
+		pApp->RunBenchmark(nBenchmark, nLevels);
+	else if (nStress > 0)
+		nResult = pApp->RunStressTest(nStress, nReaders) ? 0 : 1;
+	else if (nObjVertices > 0)
+		nResult = pApp->RunObjBenchmark(nObjVertices) ? 0 : 1;
+	else
+		pApp->Run();
 	SafeDelete(pApp);
-	return 0;
+	return nResult;
 }
\ No newline at end of file
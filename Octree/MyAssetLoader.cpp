@@ -0,0 +1,210 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyAssetLoader.h"
+#include "MyRigidBody.h"
+#include "MyProfiler.h"
+#include <chrono>
+using namespace Simplex;
+
+Simplex::MyAssetLoader::MyAssetLoader(uint a_uThreadCount)
+{
+	// The render thread has a core of its own, the workers take the rest
+	uint uCoreCount = std::max(std::thread::hardware_concurrency(), 2u);
+	m_uThreadCount = a_uThreadCount > 0 ? a_uThreadCount : uCoreCount - 1;
+	m_bStopping = false;
+	m_uLoading = 0;
+}
+
+Simplex::MyAssetLoader::~MyAssetLoader(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_bStopping = true;
+	}
+	m_Wake.notify_all();
+	for (std::thread& worker : m_lWorker)
+	{
+		worker.join();
+	}
+
+	for (auto& asset : m_mAsset)
+	{
+		SafeDelete(asset.second->pFile);
+		SafeDelete(asset.second);
+	}
+}
+
+MyAsset* Simplex::MyAssetLoader::Request(String a_sFileName)
+{
+	MyAsset*& pAsset = m_mAsset[a_sFileName];
+	if (pAsset != nullptr) { return pAsset; }
+
+	pAsset = new MyAsset();
+	pAsset->sFileName = a_sFileName;
+	++m_uLoading;
+	if (m_lWorker.empty())
+	{
+		for (uint i = 0; i < m_uThreadCount; i++)
+		{
+			m_lWorker.push_back(std::thread(&MyAssetLoader::Work, this));
+		}
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_lQueued.push_back(pAsset);
+	}
+	m_Wake.notify_one();
+	return pAsset;
+}
+
+uint Simplex::MyAssetLoader::Finalize(float a_fBudget)
+{
+	MY_PROFILE_ZONE("MyAssetLoader::Finalize");
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (MyAsset* pAsset : m_lRead)
+		{
+			pAsset->eState = AS_READ;
+			m_lMaking.push_back(pAsset);
+		}
+		m_lRead.clear();
+	}
+
+	// The oldest file is finished first so its entities get their model as soon as possible
+	auto tStart = std::chrono::high_resolution_clock::now();
+	while (!m_lMaking.empty())
+	{
+		MyAsset* pAsset = m_lMaking.front();
+		if (MakeStep(pAsset))
+		{
+			m_lMaking.pop_front();
+			m_lLanded.push_back(pAsset);
+			--m_uLoading;
+		}
+		if (std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - tStart).count() >= a_fBudget)
+			break;
+	}
+	return static_cast<uint>(m_lLanded.size());
+}
+
+void Simplex::MyAssetLoader::TakeLanded(std::vector<MyAsset*>& a_lAsset)
+{
+	a_lAsset.insert(a_lAsset.end(), m_lLanded.begin(), m_lLanded.end());
+	m_lLanded.clear();
+}
+
+uint Simplex::MyAssetLoader::GetLoadingCount(void)
+{
+	return m_uLoading;
+}
+
+void Simplex::MyAssetLoader::Work(void)
+{
+	MY_PROFILE_THREAD("Asset loader");
+	while (true)
+	{
+		MyAsset* pAsset = nullptr;
+		{
+			std::unique_lock<std::mutex> lock(m_Mutex);
+			m_Wake.wait(lock, [this]() { return m_bStopping || !m_lQueued.empty(); });
+			if (m_bStopping) { return; }
+
+			pAsset = m_lQueued.front();
+			m_lQueued.pop_front();
+		}
+
+		// Only files the fast path reads are read here, the others are left to Model::Load on the render thread
+		MyObjFile* pFile = new MyObjFile();
+		if (pFile->Read(pAsset->sFileName, pAsset->sName, pAsset->sFolder))
+		{
+			if (pFile->GetMaterialLibrary() != "")
+				ReadTextureNames(pAsset->sFolder + pFile->GetMaterialLibrary(), pAsset->lTexture);
+			pAsset->pFile = pFile;
+		}
+		else
+		{
+			SafeDelete(pFile);
+		}
+
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		m_lRead.push_back(pAsset);
+	}
+}
+
+bool Simplex::MyAssetLoader::MakeStep(MyAsset* a_pAsset)
+{
+	// Textures loaded now are found by the material library when the model loads it
+	TextureManager* pTextureMngr = TextureManager::GetInstance();
+	if (a_pAsset->uTexture < a_pAsset->lTexture.size())
+	{
+		MY_PROFILE_ZONE("Texture");
+		String const& sTexture = a_pAsset->lTexture[a_pAsset->uTexture++];
+		if (pTextureMngr->IdentifyTexure(sTexture) < 0)
+			pTextureMngr->LoadTexture(sTexture);
+		return false;
+	}
+
+	MY_PROFILE_ZONE("Model");
+	a_pAsset->pModel = new Model();
+	if (a_pAsset->pFile != nullptr)
+	{
+		MyObjBounds bounds = a_pAsset->pFile->GetBounds();
+		a_pAsset->pFile->MakeModel(a_pAsset->pModel, a_pAsset->sName, a_pAsset->sFolder);
+		a_pAsset->v3MinL = bounds.v3Min;
+		a_pAsset->v3MaxL = bounds.v3Max;
+		SafeDelete(a_pAsset->pFile);
+	}
+	else if (a_pAsset->pModel->Load(a_pAsset->sFileName) != "")
+	{
+		// The box comes out the same as the one the entity would make from the vertices
+		MyRigidBody rigidBody(a_pAsset->pModel->GetVertexList());
+		a_pAsset->v3MinL = rigidBody.GetMinLocal();
+		a_pAsset->v3MaxL = rigidBody.GetMaxLocal();
+	}
+
+	a_pAsset->eState = a_pAsset->pModel->GetName() != "" ? AS_READY : AS_FAILED;
+	if (a_pAsset->eState == AS_FAILED)
+		SafeDelete(a_pAsset->pModel);
+	return true;
+}
+
+void Simplex::MyAssetLoader::ReadTextureNames(String a_sFileName, std::vector<String>& a_lTexture)
+{
+	MyMappedFile file;
+	if (!file.Open(a_sFileName)) { return; }
+
+	char const* pCursor = file.GetData();
+	char const* pEnd = pCursor + file.GetSize();
+	while (pCursor < pEnd)
+	{
+		char const* pLineEnd = static_cast<char const*>(memchr(pCursor, '\n', pEnd - pCursor));
+		if (pLineEnd == nullptr)
+			pLineEnd = pEnd;
+		while (pCursor < pLineEnd && (*pCursor == ' ' || *pCursor == '\t'))
+		{
+			++pCursor;
+		}
+
+		// The texture is the last word of the line, the options of the map come before it
+		if (pLineEnd - pCursor > 4 && memcmp(pCursor, "map_", 4) == 0)
+		{
+			char const* pNameEnd = pLineEnd;
+			while (pNameEnd > pCursor && (pNameEnd[-1] == ' ' || pNameEnd[-1] == '\t' || pNameEnd[-1] == '\r'))
+			{
+				--pNameEnd;
+			}
+			char const* pName = pNameEnd;
+			while (pName > pCursor && pName[-1] != ' ' && pName[-1] != '\t')
+			{
+				--pName;
+			}
+			String sTexture(pName, pNameEnd);
+			if (pName > pCursor && std::find(a_lTexture.begin(), a_lTexture.end(), sTexture) == a_lTexture.end())
+				a_lTexture.push_back(sTexture);
+		}
+		pCursor = pLineEnd + 1;
+	}
+}
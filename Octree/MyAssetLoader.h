@@ -0,0 +1,137 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYASSETLOADER_H_
+#define __MYASSETLOADER_H_
+
+#include "MyObjFile.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Simplex
+{
+	// Where a model asked for to the loader is
+	enum MY_ASSET_STATE
+	{
+		AS_QUEUED = 0, // waiting for a worker or being read by one
+		AS_READ = 1, // read, its textures and meshes are being made on the render thread
+		AS_READY = 2, // model made, entities of that file get it right away
+		AS_FAILED = 3 // neither the fast path nor the model could load the file
+	};
+
+	// Model loaded once per file and shared by every entity made from it
+	struct MyAsset
+	{
+		String sFileName = "";
+		std::atomic<MY_ASSET_STATE> eState{ AS_QUEUED }; // only the render thread changes it, the thread updating reads it when it applies a spawn
+		MyObjFile* pFile = nullptr; // read by the worker, nullptr if the file is left to Model::Load; released once the model is made
+		String sName = ""; // name and folder for MyObjFile::MakeModel
+		String sFolder = "";
+		std::vector<String> lTexture; // textures named by the material library, made one by one before the meshes
+		uint uTexture = 0; // textures made so far
+		Model* pModel = nullptr; // not released by the loader, like the models of the entities
+		vector3 v3MinL = ZERO_V3; // box of the model in local space, valid once it is ready
+		vector3 v3MaxL = ZERO_V3;
+	};
+
+	// Loads models off the render thread: a pool of workers reads the files, from the model cache or by parsing them,
+	// and the render thread makes their textures and meshes, which need the OpenGL context, a little every frame
+	class MyAssetLoader
+	{
+		uint m_uThreadCount = 0; // workers started on the first request
+		std::vector<std::thread> m_lWorker;
+		std::mutex m_Mutex; // guards the two lists the workers share with the render thread and m_bStopping
+		std::condition_variable m_Wake; // signaled when a file is queued or the workers have to stop
+		std::deque<MyAsset*> m_lQueued; // files waiting for a worker
+		std::vector<MyAsset*> m_lRead; // files read by a worker, waiting for the render thread
+		bool m_bStopping = false;
+
+		std::map<String, MyAsset*> m_mAsset; // every file asked for, by file name; render thread only
+		std::deque<MyAsset*> m_lMaking; // files whose textures and meshes are being made, oldest first
+		std::vector<MyAsset*> m_lLanded; // files made, or that failed, since TakeLanded was last called
+		uint m_uLoading = 0; // files asked for that are not ready nor failed
+
+	public:
+		/*
+		USAGE: Constructor, no thread is started until a file is asked for
+		ARGUMENTS:
+		- uint a_uThreadCount = 0 -> workers to read files with, 0 for one per core but the render thread's
+		OUTPUT: class object
+		*/
+		MyAssetLoader(uint a_uThreadCount = 0);
+
+		/*
+		USAGE: Destructor, stops the workers once they finish the file they are reading; the models made stay alive
+		*/
+		~MyAssetLoader(void);
+
+		/*
+		USAGE: Asks for a model, from the render thread; a file asked for before gives the same asset
+		ARGUMENTS:
+		- String a_sFileName -> file as Model::Load takes it
+		OUTPUT: asset of the file, ready right away if it was loaded before
+		*/
+		MyAsset* Request(String a_sFileName);
+
+		/*
+		USAGE: Makes the textures and meshes of the files the workers read, from the render thread; it goes on with the
+		next texture or model while it has time left, one always being made so the loads move even with no time
+		ARGUMENTS:
+		- float a_fBudget -> microseconds to spend
+		OUTPUT: files landed, made or failed, waiting for TakeLanded
+		*/
+		uint Finalize(float a_fBudget);
+
+		/*
+		USAGE: Takes the files that became ready or failed since the last call, from the render thread
+		ARGUMENTS:
+		- std::vector<MyAsset*>& a_lAsset -> list to append them to
+		*/
+		void TakeLanded(std::vector<MyAsset*>& a_lAsset);
+
+		/*
+		USAGE: Gets the number of files asked for that are neither ready nor failed
+		OUTPUT: files loading
+		*/
+		uint GetLoadingCount(void);
+
+	private:
+		/*
+		USAGE: Reads the files queued until the loader stops, on a worker thread
+		*/
+		void Work(void);
+
+		/*
+		USAGE: Makes one texture, or the model once every texture is made, of an asset that was read
+		ARGUMENTS:
+		- MyAsset* a_pAsset -> asset to go on with
+		OUTPUT: is the asset ready or failed?
+		*/
+		bool MakeStep(MyAsset* a_pAsset);
+
+		/*
+		USAGE: Lists the textures a material library names in its map_ lines
+		ARGUMENTS:
+		- String a_sFileName -> path of the library
+		- std::vector<String>& a_lTexture -> list to append them to, each one once
+		*/
+		static void ReadTextureNames(String a_sFileName, std::vector<String>& a_lTexture);
+
+		/*
+		USAGE: Copy constructor
+		*/
+		MyAssetLoader(MyAssetLoader const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyAssetLoader& operator=(MyAssetLoader const& a_pOther);
+	};
+}
+
+#endif //__MYASSETLOADER_H_
@@ -0,0 +1,156 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyBroadphase.h"
+using namespace Simplex;
+
+MyBroadphaseStats& Simplex::MyBroadphaseStats::operator+=(MyBroadphaseStats const& a_Other)
+{
+	uCandidatePairs += a_Other.uCandidatePairs;
+	uLayerCulled += a_Other.uLayerCulled;
+	uBoundsTests += a_Other.uBoundsTests;
+	uDuplicatePairs += a_Other.uDuplicatePairs;
+	uNodesVisited += a_Other.uNodesVisited;
+	return *this;
+}
+
+size_t Simplex::MyMemoryReport::GetTotal(void) const
+{
+	return uNodeBytes + uIndexBytes + uSlackBytes + uDimensionBytes + uAuxiliaryBytes;
+}
+
+float Simplex::MyMemoryReport::GetBytesPerEntity(void) const
+{
+	return uEntityCount == 0 ? 0.0f : GetTotal() / static_cast<float>(uEntityCount);
+}
+
+Simplex::MyBroadphase::~MyBroadphase(void)
+{
+}
+
+void Simplex::MyBroadphase::SetFilters(std::vector<uint> const& a_lCategory, std::vector<uint> const& a_lMask)
+{
+	m_lCategory = a_lCategory;
+	m_lMask = a_lMask;
+	m_bFilterChanged = true;
+}
+
+bool Simplex::MyBroadphase::Raycast(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float a_fMaxDistance, uint a_uMask,
+	uint& a_uEntity, float& a_fDistance)
+{
+	if (!ClipRay(a_v3Origin, a_v3Direction, a_fMaxDistance)) { return false; }
+
+	// Every entity hit by the clipped ray overlaps the box around it
+	vector3 v3End = a_v3Origin + a_v3Direction * a_fMaxDistance;
+	std::vector<uint> lCandidate;
+	QueryAABB(glm::min(a_v3Origin, v3End), glm::max(a_v3Origin, v3End), a_uMask, lCandidate);
+
+	vector3 v3InvDirection = 1.0f / a_v3Direction;
+	bool bHit = false;
+	for (uint i = 0; i < lCandidate.size(); i++)
+	{
+		float fDistance = 0.0f;
+		if (IsRayHittingBox(a_v3Origin, v3InvDirection, m_lMin[lCandidate[i]], m_lMax[lCandidate[i]], a_fMaxDistance, fDistance))
+		{
+			a_fMaxDistance = fDistance;
+			a_uEntity = lCandidate[i];
+			a_fDistance = fDistance;
+			bHit = true;
+		}
+	}
+	return bHit;
+}
+
+void Simplex::MyBroadphase::GetMemoryReport(MyMemoryReport& a_Report)
+{
+	a_Report.uEntityCount = m_uEntityCount;
+	a_Report.AddList(m_lMin, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lMax, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lCategory, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lMask, a_Report.uAuxiliaryBytes);
+}
+
+uint Simplex::MyBroadphase::GetEntityCount(void)
+{
+	return m_uEntityCount;
+}
+
+MyBroadphaseStats const& Simplex::MyBroadphase::GetStats(void)
+{
+	return m_Stats;
+}
+
+void Simplex::MyBroadphase::ResetStats(void)
+{
+	m_Stats = MyBroadphaseStats();
+}
+
+void Simplex::MyBroadphase::CopyBounds(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	m_uEntityCount = static_cast<uint>(a_lMin.size());
+	m_lMin = a_lMin;
+	m_lMax = a_lMax;
+	if (m_lCategory.size() != m_uEntityCount)
+	{
+		m_lCategory.assign(m_uEntityCount, 1);
+		m_lMask.assign(m_uEntityCount, 0xFFFFFFFF);
+		m_bFilterChanged = true;
+	}
+
+	m_v3SceneMin = ZERO_V3;
+	m_v3SceneMax = ZERO_V3;
+	if (m_uEntityCount == 0) { return; }
+
+	m_v3SceneMin = m_lMin[0];
+	m_v3SceneMax = m_lMax[0];
+	for (uint i = 1; i < m_uEntityCount; i++)
+	{
+		m_v3SceneMin = glm::min(m_v3SceneMin, m_lMin[i]);
+		m_v3SceneMax = glm::max(m_v3SceneMax, m_lMax[i]);
+	}
+}
+
+bool Simplex::MyBroadphase::ClipRay(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float& a_fMaxDistance)
+{
+	if (m_uEntityCount == 0) { return false; }
+
+	// Find where the ray leaves the scene box by casting it backwards from the far end
+	vector3 v3InvDirection = 1.0f / a_v3Direction;
+	float fEnter = 0.0f;
+	if (!IsRayHittingBox(a_v3Origin, v3InvDirection, m_v3SceneMin, m_v3SceneMax, a_fMaxDistance, fEnter)) { return false; }
+
+	vector3 v3T1 = (m_v3SceneMin - a_v3Origin) * v3InvDirection;
+	vector3 v3T2 = (m_v3SceneMax - a_v3Origin) * v3InvDirection;
+	vector3 v3Far = glm::max(v3T1, v3T2);
+	float fExit = std::min({ v3Far.x, v3Far.y, v3Far.z });
+	a_fMaxDistance = std::min(a_fMaxDistance, fExit);
+	return true;
+}
+
+bool Simplex::MyBroadphase::IsBoxOverlapping(vector3 const& a_v3MinA, vector3 const& a_v3MaxA,
+	vector3 const& a_v3MinB, vector3 const& a_v3MaxB)
+{
+	if (a_v3MaxA.x < a_v3MinB.x || a_v3MinA.x > a_v3MaxB.x) { return false; }
+	if (a_v3MaxA.y < a_v3MinB.y || a_v3MinA.y > a_v3MaxB.y) { return false; }
+	if (a_v3MaxA.z < a_v3MinB.z || a_v3MinA.z > a_v3MaxB.z) { return false; }
+	return true;
+}
+
+bool Simplex::MyBroadphase::IsRayHittingBox(vector3 const& a_v3Origin, vector3 const& a_v3InvDirection,
+	vector3 const& a_v3Min, vector3 const& a_v3Max, float a_fMaxDistance, float& a_fDistance)
+{
+	// Distances to the planes of each slab, a zero direction component gives infinities that the min/max discard
+	vector3 v3T1 = (a_v3Min - a_v3Origin) * a_v3InvDirection;
+	vector3 v3T2 = (a_v3Max - a_v3Origin) * a_v3InvDirection;
+	vector3 v3Near = glm::min(v3T1, v3T2);
+	vector3 v3Far = glm::max(v3T1, v3T2);
+
+	float fEnter = std::max({ v3Near.x, v3Near.y, v3Near.z, 0.0f });
+	float fExit = std::min({ v3Far.x, v3Far.y, v3Far.z, a_fMaxDistance });
+	if (fEnter > fExit) { return false; }
+
+	a_fDistance = fEnter;
+	return true;
+}
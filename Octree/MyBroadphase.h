@@ -0,0 +1,254 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYBROADPHASE_H_
+#define __MYBROADPHASE_H_
+
+#include "Simplex\Mesh\Model.h"
+
+namespace Simplex
+{
+	// Spatial structure used by the entity manager to find potentially colliding pairs
+	enum MY_BROADPHASE
+	{
+		BP_OCTREE = 0, // Octree leaves, pairs are reported from the first leaf both entities share
+		BP_HASHGRID = 1, // Uniform hashed grid
+		BP_SAP = 2, // Sweep and prune on the axis of greatest variance
+		BP_SAP_MULTIAXIS = 3, // Sweep and prune keeping the three axes sorted
+		BP_BVH = 4, // Dynamic bounding volume hierarchy with fattened boxes
+		BP_ADAPTIVE = 5, // Times the other broadphases over a warm-up window and keeps the cheapest
+		BP_COUNT
+	};
+
+	// Pair of entity indices that a broadphase found overlapping, uA is always smaller than uB
+	struct MyEntityPair
+	{
+		uint uA = 0;
+		uint uB = 0;
+	};
+
+	typedef std::vector<MyEntityPair> MyPairList;
+
+	// Work done by the queries of a broadphase, the hot loops count in locals and add them up when they return
+	struct MyBroadphaseStats
+	{
+		uint uCandidatePairs = 0; // entity pairs the structure put side by side: same leaf, cell, node or axis interval
+		uint uLayerCulled = 0; // candidates rejected by the collision layers, pairs of skipped groups included
+		uint uBoundsTests = 0; // box tests between two entities or an entity and the queried box
+		uint uDuplicatePairs = 0; // overlapping pairs dropped because another leaf reports them
+		uint uNodesVisited = 0; // octants, cells or tree nodes the queries went through
+
+		/*
+		USAGE: Adds the counters of another set
+		ARGUMENTS:
+		- MyBroadphaseStats const& a_Other -> counters to add
+		OUTPUT: this set
+		*/
+		MyBroadphaseStats& operator+=(MyBroadphaseStats const& a_Other);
+	};
+
+	// Bytes held by a spatial structure split by what they store, sizes are estimates of the heap blocks
+	struct MyMemoryReport
+	{
+		size_t uNodeBytes = 0; // octants, cells, tree nodes or endpoints
+		size_t uIndexBytes = 0; // entity indices stored by the nodes and the lists derived from them
+		size_t uSlackBytes = 0; // capacity of the containers past their size
+		size_t uDimensionBytes = 0; // dimension arrays the structure fills on the entities
+		size_t uAuxiliaryBytes = 0; // copies of the bounds and filters, lookup tables and scratch lists
+		uint uNodeCount = 0;
+		uint uEntityCount = 0;
+
+		/*
+		USAGE: Adds a list to a category, its unused capacity goes to the slack
+		ARGUMENTS:
+		- std::vector<T> const& a_lList -> list to account
+		- size_t& a_uCategory -> member of this report the used part goes to
+		*/
+		template <class T>
+		void AddList(std::vector<T> const& a_lList, size_t& a_uCategory)
+		{
+			a_uCategory += a_lList.size() * sizeof(T);
+			uSlackBytes += (a_lList.capacity() - a_lList.size()) * sizeof(T);
+		}
+
+		/*
+		USAGE: Gets the bytes of every category together
+		OUTPUT: total bytes
+		*/
+		size_t GetTotal(void) const;
+
+		/*
+		USAGE: Gets the total divided by the entities of the structure
+		OUTPUT: bytes per entity, 0 without entities
+		*/
+		float GetBytesPerEntity(void) const;
+	};
+
+	// Interface of the spatial structures, entities are identified by their index in the bounds lists
+	class MyBroadphase
+	{
+	protected:
+		uint m_uEntityCount = 0;
+		std::vector<vector3> m_lMin; // global minimum of every entity
+		std::vector<vector3> m_lMax; // global maximum of every entity
+		vector3 m_v3SceneMin = ZERO_V3; // minimum of the box around every entity
+		vector3 m_v3SceneMax = ZERO_V3; // maximum of the box around every entity
+		std::vector<uint> m_lCategory; // collision layers of every entity, one bit per layer
+		std::vector<uint> m_lMask; // collision layers every entity collides with
+		bool m_bFilterChanged = true; // the filters changed since the structure last looked at them
+		MyBroadphaseStats m_Stats; // work of the queries since the last ResetStats
+
+	public:
+		/*
+		USAGE: Destructor
+		*/
+		virtual ~MyBroadphase(void);
+
+		/*
+		USAGE: Builds the structure from scratch
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		virtual void Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) = 0;
+
+		/*
+		USAGE: Updates the structure with the new bounds of the entities, reusing the work of the last update
+		when the structure allows it
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		virtual void Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) = 0;
+
+		/*
+		USAGE: Sets the collision filters of the entities, to be called before Build or Update whenever they
+		change; entities without filters collide with every other one
+		ARGUMENTS:
+		- std::vector<uint> const& a_lCategory -> layers each entity belongs to
+		- std::vector<uint> const& a_lMask -> layers each entity collides with
+		*/
+		void SetFilters(std::vector<uint> const& a_lCategory, std::vector<uint> const& a_lMask);
+
+		/*
+		USAGE: Appends every pair of entities with overlapping bounds whose filters let them collide, the
+		filters are checked before the bounds
+		ARGUMENTS:
+		- MyPairList& a_lPairs -> list to append the pairs to
+		*/
+		virtual void QueryPairs(MyPairList& a_lPairs) = 0;
+
+		/*
+		USAGE: Appends every entity on the queried layers whose bounds overlap the box
+		ARGUMENTS:
+		- vector3 const& a_v3Min, a_v3Max -> queried box in global space
+		- uint a_uMask -> layers to report, entities whose category shares no bit with it are skipped
+		- std::vector<uint>& a_lEntities -> list to append the entity indices to
+		*/
+		virtual void QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities) = 0;
+
+		/*
+		USAGE: Finds the closest entity on the queried layers whose bounds are hit by the ray, by default it tests
+		the entities found by QueryAABB around the ray
+		ARGUMENTS:
+		- vector3 const& a_v3Origin -> origin of the ray
+		- vector3 const& a_v3Direction -> normalized direction of the ray
+		- float a_fMaxDistance -> length of the ray
+		- uint a_uMask -> layers the ray can hit
+		- uint& a_uEntity -> index of the entity hit
+		- float& a_fDistance -> distance along the ray to the hit
+		OUTPUT: was anything hit?
+		*/
+		virtual bool Raycast(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float a_fMaxDistance, uint a_uMask,
+			uint& a_uEntity, float& a_fDistance);
+
+		/*
+		USAGE: Gets a readable name of the structure
+		OUTPUT: name
+		*/
+		virtual String GetName(void) = 0;
+
+		/*
+		USAGE: Adds up the memory held by the structure, the base class accounts the copies of the bounds and the
+		filters; every structure reports through it so their layouts can be compared
+		ARGUMENTS:
+		- MyMemoryReport& a_Report -> report to add to
+		*/
+		virtual void GetMemoryReport(MyMemoryReport& a_Report);
+
+		/*
+		USAGE: Gets the number of entities of the last build or update
+		OUTPUT: entity count
+		*/
+		uint GetEntityCount(void);
+
+		/*
+		USAGE: Gets the work done by the queries since the last call to ResetStats
+		OUTPUT: counters
+		*/
+		MyBroadphaseStats const& GetStats(void);
+
+		/*
+		USAGE: Zeroes the counters, the entity manager calls it before every update
+		*/
+		void ResetStats(void);
+
+	protected:
+		/*
+		USAGE: Checks the filters of two entities, called on the hot loops of the queries so it is kept inline
+		ARGUMENTS:
+		- uint a_uA, a_uB -> indices of the entities
+		OUTPUT: is each one's category in the other's mask?
+		*/
+		bool IsPairPassing(uint a_uA, uint a_uB) const
+		{
+			return (m_lCategory[a_uA] & m_lMask[a_uB]) != 0 && (m_lCategory[a_uB] & m_lMask[a_uA]) != 0;
+		}
+
+		/*
+		USAGE: Copies the bounds of the entities and computes the box around all of them, entities without
+		filters get the default ones
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void CopyBounds(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax);
+
+		/*
+		USAGE: Shortens the ray so it ends where it leaves the box around every entity
+		ARGUMENTS:
+		- vector3 const& a_v3Origin -> origin of the ray
+		- vector3 const& a_v3Direction -> normalized direction of the ray
+		- float& a_fMaxDistance -> length of the ray, clipped on output
+		OUTPUT: does the ray reach the box?
+		*/
+		bool ClipRay(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float& a_fMaxDistance);
+
+		/*
+		USAGE: Checks if two boxes overlap, touching boxes count as overlapping
+		ARGUMENTS:
+		- vector3 const& a_v3MinA, a_v3MaxA -> first box
+		- vector3 const& a_v3MinB, a_v3MaxB -> second box
+		OUTPUT: are they overlapping?
+		*/
+		static bool IsBoxOverlapping(vector3 const& a_v3MinA, vector3 const& a_v3MaxA,
+			vector3 const& a_v3MinB, vector3 const& a_v3MaxB);
+
+		/*
+		USAGE: Intersects a ray with a box using the slab test
+		ARGUMENTS:
+		- vector3 const& a_v3Origin -> origin of the ray
+		- vector3 const& a_v3InvDirection -> one over each component of the direction of the ray
+		- vector3 const& a_v3Min, a_v3Max -> box
+		- float a_fMaxDistance -> length of the ray
+		- float& a_fDistance -> distance along the ray where it enters the box, 0 if it starts inside
+		OUTPUT: does the ray hit the box?
+		*/
+		static bool IsRayHittingBox(vector3 const& a_v3Origin, vector3 const& a_v3InvDirection,
+			vector3 const& a_v3Min, vector3 const& a_v3Max, float a_fMaxDistance, float& a_fDistance);
+	};
+}
+
+#endif //__MYBROADPHASE_H_
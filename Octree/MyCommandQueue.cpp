@@ -0,0 +1,117 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyCommandQueue.h"
+#include <thread>
+using namespace Simplex;
+
+Simplex::MyCommandQueue::MyCommandQueue(void)
+{
+	// One block up front covers the usual frame without touching the allocator
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	AddBlock();
+}
+
+Simplex::MyCommandQueue::~MyCommandQueue(void)
+{
+	for (uint i = 0; i < m_uBlockCount; i++)
+	{
+		delete[] m_pBlock[i];
+	}
+}
+
+void Simplex::MyCommandQueue::Push(MyCommand const& a_Command)
+{
+	uint uNode = TakeNode();
+	Node& node = GetNode(uNode);
+	node.Command = a_Command;
+
+	// Link in front of the head, retrying if another producer got there first
+	uint uHead = m_uHead.load(std::memory_order_relaxed);
+	do
+	{
+		node.uNext.store(uHead, std::memory_order_relaxed);
+	} while (!m_uHead.compare_exchange_weak(uHead, uNode, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void Simplex::MyCommandQueue::Drain(MyCommandList& a_lCommand)
+{
+	// Detach the whole list at once, the producers start a new one
+	uint uNode = m_uHead.exchange(NONE, std::memory_order_acquire);
+	if (uNode == NONE) { return; }
+
+	m_lOrder.clear();
+	for (; uNode != NONE; uNode = GetNode(uNode).uNext.load(std::memory_order_relaxed))
+	{
+		m_lOrder.push_back(uNode);
+	}
+
+	a_lCommand.reserve(a_lCommand.size() + m_lOrder.size());
+	for (uint i = static_cast<uint>(m_lOrder.size()); i > 0; i--)
+	{
+		a_lCommand.push_back(std::move(GetNode(m_lOrder[i - 1]).Command));
+	}
+
+	// The nodes are still linked newest to oldest, the whole list goes back in one exchange
+	GiveNodes(m_lOrder.front(), m_lOrder.back());
+}
+
+bool Simplex::MyCommandQueue::IsEmpty(void)
+{
+	return m_uHead.load(std::memory_order_relaxed) == NONE;
+}
+
+Simplex::MyCommandQueue::Node& Simplex::MyCommandQueue::GetNode(uint a_uIndex)
+{
+	return m_pBlock[a_uIndex / BLOCK_SIZE][a_uIndex % BLOCK_SIZE];
+}
+
+uint Simplex::MyCommandQueue::TakeNode(void)
+{
+	while (true)
+	{
+		uint64_t uFree = m_uFree.load(std::memory_order_acquire);
+		while (static_cast<uint>(uFree) != NONE)
+		{
+			uint uNode = static_cast<uint>(uFree);
+			uint64_t uNext = ((uFree >> 32) + 1) << 32 | GetNode(uNode).uNext.load(std::memory_order_relaxed);
+			if (m_uFree.compare_exchange_weak(uFree, uNext, std::memory_order_acquire, std::memory_order_acquire))
+			{
+				return uNode;
+			}
+		}
+
+		// Out of nodes, another producer may have added a block while this one waited for the lock
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		if (static_cast<uint>(m_uFree.load(std::memory_order_acquire)) != NONE) { continue; }
+		if (m_uBlockCount == MAX_BLOCKS)
+		{
+			std::this_thread::yield();
+			continue;
+		}
+		AddBlock();
+	}
+}
+
+void Simplex::MyCommandQueue::AddBlock(void)
+{
+	uint uFirst = m_uBlockCount * BLOCK_SIZE;
+	m_pBlock[m_uBlockCount] = new Node[BLOCK_SIZE];
+	m_uBlockCount++;
+	for (uint i = uFirst; i < uFirst + BLOCK_SIZE - 1; i++)
+	{
+		GetNode(i).uNext.store(i + 1, std::memory_order_relaxed);
+	}
+	GiveNodes(uFirst, uFirst + BLOCK_SIZE - 1);
+}
+
+void Simplex::MyCommandQueue::GiveNodes(uint a_uFirst, uint a_uLast)
+{
+	uint64_t uFree = m_uFree.load(std::memory_order_relaxed);
+	do
+	{
+		GetNode(a_uLast).uNext.store(static_cast<uint>(uFree), std::memory_order_relaxed);
+	} while (!m_uFree.compare_exchange_weak(uFree, (uFree >> 32) << 32 | a_uFirst, std::memory_order_release, std::memory_order_relaxed));
+}
@@ -0,0 +1,139 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYCOMMANDQUEUE_H_
+#define __MYCOMMANDQUEUE_H_
+
+#include "Simplex\Simplex.h"
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+namespace Simplex
+{
+	struct MyAsset;
+
+	// Kind of the edits deferred to the next update of the entity manager
+	enum MY_COMMAND
+	{
+		CMD_SPAWN = 0, // Makes an entity of the model and adds it, placed with the matrix
+		CMD_DESPAWN = 1, // Removes the entity
+		CMD_TRANSFORM = 2 // Sets the model matrix of the entity
+	};
+
+	// Edit of the entity list, entities are named by unique ID since indices change when entities are removed; a
+	// spawn holds what the entity is made of and gets its ID when it is applied, after the commands pushed before it
+	struct MyCommand
+	{
+		MY_COMMAND eType = CMD_TRANSFORM;
+		String sUniqueID = ""; // entity to edit, or the ID a spawn asks for
+		matrix4 m4ToWorld = IDENTITY_M4;
+		String sFileName = ""; // file the model of a spawn comes from
+		Model* pModel = nullptr; // loaded model of a spawn, nullptr while pAsset is being loaded
+		MyAsset* pAsset = nullptr; // model of a spawn still being loaded, the entity stands in with the box until it is ready
+		vector3 v3MinL = ZERO_V3; // box of the spawn in local space, of the model or of the stand in
+		vector3 v3MaxL = ZERO_V3;
+	};
+
+	typedef std::vector<MyCommand> MyCommandList;
+
+	// Multiple producer, single consumer list of commands; any thread pushes without locking, the entity manager
+	// takes everything pushed so far in one go. The nodes come from blocks kept for the life of the queue, a drain
+	// hands its nodes back so pushing allocates only when more commands are waiting than ever before
+	class MyCommandQueue
+	{
+		static constexpr uint BLOCK_SIZE = 256; // nodes allocated at once when none is free
+		static constexpr uint MAX_BLOCKS = 4096; // past this many nodes waiting a push waits for the next drain
+		static constexpr uint NONE = 0xFFFFFFFF; // index of no node, ends a list
+
+		struct Node
+		{
+			MyCommand Command;
+			std::atomic<uint> uNext{ NONE }; // a producer may read it while another producer relinks the node
+		};
+
+		Node* m_pBlock[MAX_BLOCKS] = {}; // node i lives in block i / BLOCK_SIZE, a block never moves once added
+		uint m_uBlockCount = 0; // blocks added so far, written under m_Mutex
+		std::mutex m_Mutex; // taken only to add a block
+
+		std::atomic<uint> m_uHead{ NONE }; // last command pushed, the list runs from the newest to the oldest
+		// First free node in the low half; every take bumps the high half, so a producer that read a node which was
+		// taken and given back meanwhile fails its exchange instead of following a stale link
+		std::atomic<uint64_t> m_uFree{ NONE };
+		std::vector<uint> m_lOrder; // scratch list of the consumer to put the commands back in push order
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyCommandQueue(void);
+
+		/*
+		USAGE: Destructor, the commands never taken are dropped with the blocks
+		*/
+		~MyCommandQueue(void);
+
+		/*
+		USAGE: Appends a command, safe from any thread
+		ARGUMENTS:
+		- MyCommand const& a_Command -> command to append
+		*/
+		void Push(MyCommand const& a_Command);
+
+		/*
+		USAGE: Takes every command pushed so far, to be called from a single thread
+		ARGUMENTS:
+		- MyCommandList& a_lCommand -> list to append the commands to, in the order they were pushed
+		*/
+		void Drain(MyCommandList& a_lCommand);
+
+		/*
+		USAGE: Asks if there is anything to take
+		OUTPUT: is it empty?
+		*/
+		bool IsEmpty(void);
+
+	private:
+		/*
+		USAGE: Gets a node by index
+		ARGUMENTS:
+		- uint a_uIndex -> index of the node
+		OUTPUT: node
+		*/
+		Node& GetNode(uint a_uIndex);
+
+		/*
+		USAGE: Takes a free node, adding a block when none is left
+		OUTPUT: index of the node
+		*/
+		uint TakeNode(void);
+
+		/*
+		USAGE: Allocates a block and frees all of its nodes, to be called under m_Mutex
+		*/
+		void AddBlock(void);
+
+		/*
+		USAGE: Gives back a list of nodes linked through uNext
+		ARGUMENTS:
+		- uint a_uFirst -> first node of the list
+		- uint a_uLast -> last node of the list, its link is overwritten
+		*/
+		void GiveNodes(uint a_uFirst, uint a_uLast);
+
+		/*
+		USAGE: Copy constructor
+		*/
+		MyCommandQueue(MyCommandQueue const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyCommandQueue& operator=(MyCommandQueue const& a_pOther);
+	};
+}
+
+#endif //__MYCOMMANDQUEUE_H_
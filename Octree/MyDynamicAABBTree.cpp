@@ -0,0 +1,453 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyDynamicAABBTree.h"
+using namespace Simplex;
+
+Simplex::MyDynamicAABBTree::MyDynamicAABBTree(void)
+{
+	m_uRoot = NULL_NODE;
+	m_uFreeList = NULL_NODE;
+	m_uEntityCount = 0;
+	m_uReinsertCount = 0;
+	m_fMargin = 0.1f;
+}
+
+void Simplex::MyDynamicAABBTree::SetMargin(float a_fMargin)
+{
+	m_fMargin = a_fMargin;
+}
+
+void Simplex::MyDynamicAABBTree::Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	CopyBounds(a_lMin, a_lMax);
+	m_uReinsertCount = 0;
+	Rebuild();
+}
+
+void Simplex::MyDynamicAABBTree::Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	// Adding or removing entities changes the indices, start over
+	if (a_lMin.size() != m_uEntityCount)
+	{
+		Build(a_lMin, a_lMax);
+		return;
+	}
+
+	CopyBounds(a_lMin, a_lMax);
+	m_uReinsertCount = 0;
+
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		Node& leaf = m_lNode[m_lEntityLeaf[i]];
+
+		// While the entity stays inside its fat box the tree does not change
+		if (glm::all(glm::greaterThanEqual(m_lMin[i], leaf.v3Min)) && glm::all(glm::lessThanEqual(m_lMax[i], leaf.v3Max)))
+		{
+			continue;
+		}
+
+		uint uLeaf = m_lEntityLeaf[i];
+		RemoveLeaf(uLeaf);
+		GetFatBox(i, m_lNode[uLeaf].v3Min, m_lNode[uLeaf].v3Max);
+		InsertLeaf(uLeaf);
+		m_uReinsertCount++;
+	}
+}
+
+void Simplex::MyDynamicAABBTree::QueryPairs(MyPairList& a_lPairs)
+{
+	if (m_uRoot == NULL_NODE) { return; }
+
+	MyBroadphaseStats stats;
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		// An entity that collides with no layer has no neighbors to look for
+		if (m_lMask[i] == 0) { continue; }
+
+		vector3 v3Min = m_lMin[i];
+		vector3 v3Max = m_lMax[i];
+
+		m_lStack.clear();
+		m_lStack.push_back(m_uRoot);
+		while (!m_lStack.empty())
+		{
+			Node const& node = m_lNode[m_lStack.back()];
+			m_lStack.pop_back();
+			stats.uNodesVisited++;
+
+			if (!IsBoxOverlapping(v3Min, v3Max, node.v3Min, node.v3Max)) { continue; }
+
+			if (!node.IsLeaf())
+			{
+				m_lStack.push_back(node.uChild1);
+				m_lStack.push_back(node.uChild2);
+				continue;
+			}
+
+			// Every pair is reported once, from its lowest index, after testing the tight boxes
+			uint j = node.uEntity;
+			if (j <= i) { continue; }
+			stats.uCandidatePairs++;
+			if (!IsPairPassing(i, j))
+			{
+				stats.uLayerCulled++;
+				continue;
+			}
+			stats.uBoundsTests++;
+			if (!IsBoxOverlapping(v3Min, v3Max, m_lMin[j], m_lMax[j])) { continue; }
+
+			MyEntityPair pair;
+			pair.uA = i;
+			pair.uB = j;
+			a_lPairs.push_back(pair);
+		}
+	}
+	m_Stats += stats;
+}
+
+void Simplex::MyDynamicAABBTree::QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities)
+{
+	if (m_uRoot == NULL_NODE) { return; }
+
+	MyBroadphaseStats stats;
+	m_lStack.clear();
+	m_lStack.push_back(m_uRoot);
+	while (!m_lStack.empty())
+	{
+		Node const& node = m_lNode[m_lStack.back()];
+		m_lStack.pop_back();
+		stats.uNodesVisited++;
+
+		if (!IsBoxOverlapping(a_v3Min, a_v3Max, node.v3Min, node.v3Max)) { continue; }
+
+		if (!node.IsLeaf())
+		{
+			m_lStack.push_back(node.uChild1);
+			m_lStack.push_back(node.uChild2);
+			continue;
+		}
+
+		stats.uCandidatePairs++;
+		if (!(m_lCategory[node.uEntity] & a_uMask))
+		{
+			stats.uLayerCulled++;
+			continue;
+		}
+		stats.uBoundsTests++;
+		if (IsBoxOverlapping(a_v3Min, a_v3Max, m_lMin[node.uEntity], m_lMax[node.uEntity]))
+		{
+			a_lEntities.push_back(node.uEntity);
+		}
+	}
+	m_Stats += stats;
+}
+
+bool Simplex::MyDynamicAABBTree::Raycast(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float a_fMaxDistance, uint a_uMask,
+	uint& a_uEntity, float& a_fDistance)
+{
+	if (m_uRoot == NULL_NODE) { return false; }
+
+	vector3 v3InvDirection = 1.0f / a_v3Direction;
+	bool bHit = false;
+
+	m_lStack.clear();
+	m_lStack.push_back(m_uRoot);
+	while (!m_lStack.empty())
+	{
+		Node const& node = m_lNode[m_lStack.back()];
+		m_lStack.pop_back();
+
+		// The ray is shortened to the closest hit so far, farther nodes are skipped
+		float fDistance = 0.0f;
+		if (!IsRayHittingBox(a_v3Origin, v3InvDirection, node.v3Min, node.v3Max, a_fMaxDistance, fDistance)) { continue; }
+
+		if (!node.IsLeaf())
+		{
+			m_lStack.push_back(node.uChild1);
+			m_lStack.push_back(node.uChild2);
+		}
+		else if ((m_lCategory[node.uEntity] & a_uMask) &&
+			IsRayHittingBox(a_v3Origin, v3InvDirection, m_lMin[node.uEntity], m_lMax[node.uEntity], a_fMaxDistance, fDistance))
+		{
+			a_fMaxDistance = fDistance;
+			a_uEntity = node.uEntity;
+			a_fDistance = fDistance;
+			bHit = true;
+		}
+	}
+	return bHit;
+}
+
+String Simplex::MyDynamicAABBTree::GetName(void)
+{
+	return "AABB Tree";
+}
+
+int Simplex::MyDynamicAABBTree::GetHeight(void)
+{
+	if (m_uRoot == NULL_NODE) { return 0; }
+	return m_lNode[m_uRoot].nHeight;
+}
+
+uint Simplex::MyDynamicAABBTree::GetReinsertCount(void)
+{
+	return m_uReinsertCount;
+}
+
+void Simplex::MyDynamicAABBTree::GetMemoryReport(MyMemoryReport& a_Report)
+{
+	MyBroadphase::GetMemoryReport(a_Report);
+	a_Report.uNodeCount += m_uEntityCount > 0 ? m_uEntityCount * 2 - 1 : 0;
+	a_Report.AddList(m_lNode, a_Report.uNodeBytes);
+	a_Report.AddList(m_lEntityLeaf, a_Report.uIndexBytes);
+	a_Report.AddList(m_lStack, a_Report.uAuxiliaryBytes);
+}
+
+void Simplex::MyDynamicAABBTree::Rebuild(void)
+{
+	m_lNode.clear();
+	m_uFreeList = NULL_NODE;
+	m_uRoot = NULL_NODE;
+	m_lEntityLeaf.resize(m_uEntityCount);
+
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		uint uLeaf = AllocateNode();
+		m_lNode[uLeaf].uEntity = i;
+		m_lNode[uLeaf].nHeight = 0;
+		GetFatBox(i, m_lNode[uLeaf].v3Min, m_lNode[uLeaf].v3Max);
+		m_lEntityLeaf[i] = uLeaf;
+		InsertLeaf(uLeaf);
+	}
+}
+
+uint Simplex::MyDynamicAABBTree::AllocateNode(void)
+{
+	if (m_uFreeList == NULL_NODE)
+	{
+		m_lNode.push_back(Node());
+		return static_cast<uint>(m_lNode.size()) - 1;
+	}
+
+	uint uNode = m_uFreeList;
+	m_uFreeList = m_lNode[uNode].uParent;
+	m_lNode[uNode] = Node();
+	return uNode;
+}
+
+void Simplex::MyDynamicAABBTree::FreeNode(uint a_uNode)
+{
+	m_lNode[a_uNode].uParent = m_uFreeList;
+	m_lNode[a_uNode].nHeight = -1;
+	m_uFreeList = a_uNode;
+}
+
+void Simplex::MyDynamicAABBTree::InsertLeaf(uint a_uLeaf)
+{
+	if (m_uRoot == NULL_NODE)
+	{
+		m_uRoot = a_uLeaf;
+		m_lNode[a_uLeaf].uParent = NULL_NODE;
+		return;
+	}
+
+	vector3 v3LeafMin = m_lNode[a_uLeaf].v3Min;
+	vector3 v3LeafMax = m_lNode[a_uLeaf].v3Max;
+
+	// Descend to the best sibling, pairing with a node costs the area of the new parent plus the growth of every ancestor
+	uint uIndex = m_uRoot;
+	while (!m_lNode[uIndex].IsLeaf())
+	{
+		Node const& node = m_lNode[uIndex];
+		float fArea = SurfaceArea(node.v3Min, node.v3Max);
+		float fCombinedArea = SurfaceArea(glm::min(node.v3Min, v3LeafMin), glm::max(node.v3Max, v3LeafMax));
+
+		float fCost = 2.0f * fCombinedArea; // cost of making a new parent for this node and the leaf
+		float fInheritance = 2.0f * (fCombinedArea - fArea); // minimum cost of pushing the leaf further down
+
+		float fChildCost[2];
+		uint uChild[2] = { node.uChild1, node.uChild2 };
+		for (uint i = 0; i < 2; i++)
+		{
+			Node const& child = m_lNode[uChild[i]];
+			float fChildCombined = SurfaceArea(glm::min(child.v3Min, v3LeafMin), glm::max(child.v3Max, v3LeafMax));
+			if (child.IsLeaf())
+			{
+				fChildCost[i] = fChildCombined + fInheritance;
+			}
+			else
+			{
+				fChildCost[i] = fChildCombined - SurfaceArea(child.v3Min, child.v3Max) + fInheritance;
+			}
+		}
+
+		if (fCost < fChildCost[0] && fCost < fChildCost[1]) { break; }
+
+		uIndex = fChildCost[0] < fChildCost[1] ? uChild[0] : uChild[1];
+	}
+
+	// Make a new parent for the sibling and the leaf
+	uint uSibling = uIndex;
+	uint uOldParent = m_lNode[uSibling].uParent;
+	uint uNewParent = AllocateNode();
+	m_lNode[uNewParent].uParent = uOldParent;
+	m_lNode[uNewParent].v3Min = glm::min(v3LeafMin, m_lNode[uSibling].v3Min);
+	m_lNode[uNewParent].v3Max = glm::max(v3LeafMax, m_lNode[uSibling].v3Max);
+	m_lNode[uNewParent].nHeight = m_lNode[uSibling].nHeight + 1;
+	m_lNode[uNewParent].uChild1 = uSibling;
+	m_lNode[uNewParent].uChild2 = a_uLeaf;
+	m_lNode[uSibling].uParent = uNewParent;
+	m_lNode[a_uLeaf].uParent = uNewParent;
+
+	if (uOldParent == NULL_NODE)
+	{
+		m_uRoot = uNewParent;
+	}
+	else if (m_lNode[uOldParent].uChild1 == uSibling)
+	{
+		m_lNode[uOldParent].uChild1 = uNewParent;
+	}
+	else
+	{
+		m_lNode[uOldParent].uChild2 = uNewParent;
+	}
+
+	Refit(m_lNode[a_uLeaf].uParent);
+}
+
+void Simplex::MyDynamicAABBTree::RemoveLeaf(uint a_uLeaf)
+{
+	if (a_uLeaf == m_uRoot)
+	{
+		m_uRoot = NULL_NODE;
+		return;
+	}
+
+	uint uParent = m_lNode[a_uLeaf].uParent;
+	uint uGrandParent = m_lNode[uParent].uParent;
+	uint uSibling = m_lNode[uParent].uChild1 == a_uLeaf ? m_lNode[uParent].uChild2 : m_lNode[uParent].uChild1;
+
+	if (uGrandParent == NULL_NODE)
+	{
+		m_uRoot = uSibling;
+		m_lNode[uSibling].uParent = NULL_NODE;
+		FreeNode(uParent);
+		return;
+	}
+
+	// The sibling takes the place of the parent
+	if (m_lNode[uGrandParent].uChild1 == uParent)
+	{
+		m_lNode[uGrandParent].uChild1 = uSibling;
+	}
+	else
+	{
+		m_lNode[uGrandParent].uChild2 = uSibling;
+	}
+	m_lNode[uSibling].uParent = uGrandParent;
+	FreeNode(uParent);
+
+	Refit(uGrandParent);
+}
+
+void Simplex::MyDynamicAABBTree::Refit(uint a_uNode)
+{
+	uint uIndex = a_uNode;
+	while (uIndex != NULL_NODE)
+	{
+		uIndex = Balance(uIndex);
+
+		Node& node = m_lNode[uIndex];
+		Node const& child1 = m_lNode[node.uChild1];
+		Node const& child2 = m_lNode[node.uChild2];
+		node.nHeight = 1 + std::max(child1.nHeight, child2.nHeight);
+		node.v3Min = glm::min(child1.v3Min, child2.v3Min);
+		node.v3Max = glm::max(child1.v3Max, child2.v3Max);
+
+		uIndex = node.uParent;
+	}
+}
+
+uint Simplex::MyDynamicAABBTree::Balance(uint a_uNode)
+{
+	Node& a = m_lNode[a_uNode];
+	if (a.IsLeaf() || a.nHeight < 2) { return a_uNode; }
+
+	uint uB = a.uChild1;
+	uint uC = a.uChild2;
+	int nBalance = m_lNode[uC].nHeight - m_lNode[uB].nHeight;
+
+	// Rotate the taller child up, it becomes the parent of this node
+	if (nBalance > 1 || nBalance < -1)
+	{
+		uint uUp = nBalance > 1 ? uC : uB; // child moving up
+		uint uStay = nBalance > 1 ? uB : uC; // child staying under this node
+		Node& up = m_lNode[uUp];
+		uint uF = up.uChild1;
+		uint uG = up.uChild2;
+
+		// Swap this node and the child moving up
+		up.uChild1 = a_uNode;
+		up.uParent = a.uParent;
+		a.uParent = uUp;
+
+		if (up.uParent == NULL_NODE)
+		{
+			m_uRoot = uUp;
+		}
+		else if (m_lNode[up.uParent].uChild1 == a_uNode)
+		{
+			m_lNode[up.uParent].uChild1 = uUp;
+		}
+		else
+		{
+			m_lNode[up.uParent].uChild2 = uUp;
+		}
+
+		// The taller grandchild stays with the node moving up, the other one comes down to this node
+		uint uKeep = m_lNode[uF].nHeight > m_lNode[uG].nHeight ? uF : uG;
+		uint uGive = uKeep == uF ? uG : uF;
+		up.uChild2 = uKeep;
+		if (nBalance > 1)
+		{
+			a.uChild2 = uGive;
+		}
+		else
+		{
+			a.uChild1 = uGive;
+		}
+		m_lNode[uGive].uParent = a_uNode;
+
+		Node const& stay = m_lNode[uStay];
+		Node const& give = m_lNode[uGive];
+		a.v3Min = glm::min(stay.v3Min, give.v3Min);
+		a.v3Max = glm::max(stay.v3Max, give.v3Max);
+		a.nHeight = 1 + std::max(stay.nHeight, give.nHeight);
+
+		Node const& keep = m_lNode[uKeep];
+		up.v3Min = glm::min(a.v3Min, keep.v3Min);
+		up.v3Max = glm::max(a.v3Max, keep.v3Max);
+		up.nHeight = 1 + std::max(a.nHeight, keep.nHeight);
+
+		return uUp;
+	}
+
+	return a_uNode;
+}
+
+void Simplex::MyDynamicAABBTree::GetFatBox(uint a_uEntity, vector3& a_v3Min, vector3& a_v3Max)
+{
+	vector3 v3Size = m_lMax[a_uEntity] - m_lMin[a_uEntity];
+	vector3 v3Margin = vector3(std::max({ v3Size.x, v3Size.y, v3Size.z, 0.01f }) * m_fMargin);
+	a_v3Min = m_lMin[a_uEntity] - v3Margin;
+	a_v3Max = m_lMax[a_uEntity] + v3Margin;
+}
+
+float Simplex::MyDynamicAABBTree::SurfaceArea(vector3 const& a_v3Min, vector3 const& a_v3Max)
+{
+	vector3 v3Size = a_v3Max - a_v3Min;
+	return 2.0f * (v3Size.x * v3Size.y + v3Size.y * v3Size.z + v3Size.z * v3Size.x);
+}
@@ -0,0 +1,192 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYDYNAMICAABBTREE_H_
+#define __MYDYNAMICAABBTREE_H_
+
+#include "MyBroadphase.h"
+
+namespace Simplex
+{
+	class MyDynamicAABBTree : public MyBroadphase
+	{
+		static constexpr uint NULL_NODE = (uint)-1;
+
+		// Node of the hierarchy, leaves hold one entity and a fattened box around it
+		struct Node
+		{
+			vector3 v3Min = ZERO_V3;
+			vector3 v3Max = ZERO_V3;
+			uint uParent = NULL_NODE; // next free node while the node is in the free list
+			uint uChild1 = NULL_NODE;
+			uint uChild2 = NULL_NODE;
+			int nHeight = -1; // 0 for leaves, -1 for free nodes
+			uint uEntity = NULL_NODE;
+
+			bool IsLeaf(void) const { return uChild1 == NULL_NODE; }
+		};
+
+		uint m_uRoot = NULL_NODE;
+		uint m_uFreeList = NULL_NODE;
+		uint m_uReinsertCount = 0; // leaves moved on the last update
+		float m_fMargin = 0.1f; // fraction of the entity size added on each side of its fat box
+
+		std::vector<Node> m_lNode; // node pool
+		std::vector<uint> m_lEntityLeaf; // leaf node of every entity
+		std::vector<uint> m_lStack; // traversal stack reused by the queries
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyDynamicAABBTree(void);
+
+		/*
+		USAGE: Sets the fraction of the entity size used to fatten its box, applied on the next reinsertion
+		ARGUMENTS:
+		- float a_fMargin -> margin as a fraction of the largest extent of the entity
+		*/
+		void SetMargin(float a_fMargin);
+
+		/*
+		USAGE: Inserts every entity into a new tree
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) override;
+
+		/*
+		USAGE: Updates the tree with the new bounds of the entities, only the entities that left their fat box
+		are reinserted
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) override;
+
+		/*
+		USAGE: Appends every pair of entities with overlapping bounds
+		ARGUMENTS:
+		- MyPairList& a_lPairs -> list to append the pairs to
+		*/
+		void QueryPairs(MyPairList& a_lPairs) override;
+
+		/*
+		USAGE: Appends every entity whose bounds overlap the box
+		ARGUMENTS:
+		- vector3 const& a_v3Min, a_v3Max -> queried box in global space
+		- uint a_uMask -> layers to report
+		- std::vector<uint>& a_lEntities -> list to append the entity indices to
+		*/
+		void QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities) override;
+
+		/*
+		USAGE: Finds the closest entity whose bounds are hit by the ray, skipping the nodes farther than the best hit
+		ARGUMENTS:
+		- vector3 const& a_v3Origin -> origin of the ray
+		- vector3 const& a_v3Direction -> normalized direction of the ray
+		- float a_fMaxDistance -> length of the ray
+		- uint a_uMask -> layers the ray can hit
+		- uint& a_uEntity -> index of the entity hit
+		- float& a_fDistance -> distance along the ray to the hit
+		OUTPUT: was anything hit?
+		*/
+		bool Raycast(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float a_fMaxDistance, uint a_uMask,
+			uint& a_uEntity, float& a_fDistance) override;
+
+		/*
+		USAGE: Gets a readable name of the structure
+		OUTPUT: name
+		*/
+		String GetName(void) override;
+
+		/*
+		USAGE: Adds up the memory held by the structure
+		ARGUMENTS:
+		- MyMemoryReport& a_Report -> report to add to
+		*/
+		void GetMemoryReport(MyMemoryReport& a_Report) override;
+
+		/*
+		USAGE: Gets the height of the tree
+		OUTPUT: height of the root, 0 if the tree has a single leaf
+		*/
+		int GetHeight(void);
+
+		/*
+		USAGE: Gets the number of leaves reinserted on the last update
+		OUTPUT: reinsertions
+		*/
+		uint GetReinsertCount(void);
+
+	private:
+		/*
+		USAGE: Removes every node and inserts all the entities again
+		*/
+		void Rebuild(void);
+
+		/*
+		USAGE: Takes a node from the free list, growing the pool if needed
+		OUTPUT: index of the node
+		*/
+		uint AllocateNode(void);
+
+		/*
+		USAGE: Returns the node to the free list
+		ARGUMENTS:
+		- uint a_uNode -> index of the node
+		*/
+		void FreeNode(uint a_uNode);
+
+		/*
+		USAGE: Inserts the leaf into the tree, descending to the sibling with the lowest surface area cost
+		ARGUMENTS:
+		- uint a_uLeaf -> index of the leaf
+		*/
+		void InsertLeaf(uint a_uLeaf);
+
+		/*
+		USAGE: Removes the leaf from the tree, its parent is freed and the sibling takes its place
+		ARGUMENTS:
+		- uint a_uLeaf -> index of the leaf
+		*/
+		void RemoveLeaf(uint a_uLeaf);
+
+		/*
+		USAGE: Refits the boxes and heights from the node up to the root, rotating unbalanced nodes
+		ARGUMENTS:
+		- uint a_uNode -> first node to refit
+		*/
+		void Refit(uint a_uNode);
+
+		/*
+		USAGE: Performs a left or right rotation if the node is unbalanced
+		ARGUMENTS:
+		- uint a_uNode -> index of the node
+		OUTPUT: index of the node now at that position of the tree
+		*/
+		uint Balance(uint a_uNode);
+
+		/*
+		USAGE: Computes the fat box of the entity
+		ARGUMENTS:
+		- uint a_uEntity -> index of the entity
+		- vector3& a_v3Min, a_v3Max -> output box
+		*/
+		void GetFatBox(uint a_uEntity, vector3& a_v3Min, vector3& a_v3Max);
+
+		/*
+		USAGE: Gets the surface area of the box, the cost used to guide the insertion
+		ARGUMENTS:
+		- vector3 const& a_v3Min, a_v3Max -> box
+		OUTPUT: surface area
+		*/
+		static float SurfaceArea(vector3 const& a_v3Min, vector3 const& a_v3Max);
+	};
+}
+
+#endif //__MYDYNAMICAABBTREE_H_
@@ -1,6 +1,8 @@
 #include "MyEntity.h"
+#include "MyObjFile.h"
 using namespace Simplex;
 std::map<String, MyEntity*> MyEntity::m_IDMap;
+std::recursive_mutex MyEntity::m_IDMutex;
 //  Accessors
 matrix4 Simplex::MyEntity::GetModelMatrix(void){ return m_m4ToWorld; }
 void Simplex::MyEntity::SetModelMatrix(matrix4 a_m4ToWorld)
@@ -8,26 +10,64 @@ void Simplex::MyEntity::SetModelMatrix(matrix4 a_m4ToWorld)
 	if (!m_bInMemory)
 		return;
 
+	//the model takes the matrix when it is drawn
 	m_m4ToWorld = a_m4ToWorld;
-	m_pModel->SetModelMatrix(m_m4ToWorld);
 	m_pRigidBody->SetModelMatrix(m_m4ToWorld);
 }
+void Simplex::MyEntity::Translate(vector3 a_v3Offset)
+{
+	if (!m_bInMemory)
+		return;
+
+	m_m4ToWorld[3] += vector4(a_v3Offset, 0.0f);
+	m_pRigidBody->Translate(a_v3Offset);
+}
 Model* Simplex::MyEntity::GetModel(void){return m_pModel;}
+void Simplex::MyEntity::SetModel(Model* a_pModel, vector3 a_v3MinL, vector3 a_v3MaxL)
+{
+	if (!m_bInMemory)
+		return;
+
+	//the box of the placeholder is replaced, the body is kept so its place in the broadphases is too
+	m_pModel = a_pModel;
+	m_pRigidBody->SetLocalBounds(a_v3MinL, a_v3MaxL);
+	m_bLoading = false;
+}
+bool Simplex::MyEntity::IsLoading(void) { return m_bLoading; }
 MyRigidBody* Simplex::MyEntity::GetRigidBody(void){	return m_pRigidBody; }
 bool Simplex::MyEntity::IsInitialized(void){ return m_bInMemory; }
 String Simplex::MyEntity::GetUniqueID(void) { return m_sUniqueID; }
+String Simplex::MyEntity::GetFileName(void) { return m_sFileName; }
 void Simplex::MyEntity::SetAxisVisible(bool a_bSetAxis) { m_bSetAxis = a_bSetAxis; }
+void Simplex::MyEntity::SetStatic(bool a_bStatic) { m_bStatic = a_bStatic; }
+bool Simplex::MyEntity::IsStatic(void) { return m_bStatic; }
+void Simplex::MyEntity::SetCollisionFilter(uint a_uCategory, uint a_uMask)
+{
+	m_uCategory = a_uCategory;
+	m_uCollisionMask = a_uMask;
+}
+uint Simplex::MyEntity::GetCategory(void) { return m_uCategory; }
+uint Simplex::MyEntity::GetCollisionMask(void) { return m_uCollisionMask; }
+bool Simplex::MyEntity::IsFilterPassing(MyEntity* const a_pOther)
+{
+	return (m_uCategory & a_pOther->m_uCollisionMask) != 0 && (a_pOther->m_uCategory & m_uCollisionMask) != 0;
+}
 //  MyEntity
 void Simplex::MyEntity::Init(void)
 {
 	m_pMeshMngr = MeshManager::GetInstance();
 	m_bInMemory = false;
 	m_bSetAxis = false;
+	m_bStatic = false;
+	m_bLoading = false;
+	m_uCategory = 1;
+	m_uCollisionMask = 0xFFFFFFFF;
 	m_pModel = nullptr;
 	m_pRigidBody = nullptr;
 	m_DimensionArray = nullptr;
 	m_m4ToWorld = IDENTITY_M4;
 	m_sUniqueID = "";
+	m_sFileName = "";
 	m_nDimensionCount = 0;
 }
 void Simplex::MyEntity::Swap(MyEntity& other)
@@ -39,7 +79,12 @@ void Simplex::MyEntity::Swap(MyEntity& other)
 	std::swap(m_pMeshMngr, other.m_pMeshMngr);
 	std::swap(m_bInMemory, other.m_bInMemory);
 	std::swap(m_sUniqueID, other.m_sUniqueID);
+	std::swap(m_sFileName, other.m_sFileName);
 	std::swap(m_bSetAxis, other.m_bSetAxis);
+	std::swap(m_bStatic, other.m_bStatic);
+	std::swap(m_bLoading, other.m_bLoading);
+	std::swap(m_uCategory, other.m_uCategory);
+	std::swap(m_uCollisionMask, other.m_uCollisionMask);
 	std::swap(m_nDimensionCount, other.m_nDimensionCount);
 	std::swap(m_DimensionArray, other.m_DimensionArray);
 }
@@ -55,34 +100,70 @@ void Simplex::MyEntity::Release(void)
 		m_DimensionArray = nullptr;
 	}
 	SafeDelete(m_pRigidBody);
-	m_IDMap.erase(m_sUniqueID);
+	ReleaseUniqueID();
 }
 //The big 3
 Simplex::MyEntity::MyEntity(String a_sFileName, String a_sUniqueID)
 {
 	Init();
 	m_pModel = new Model();
-	m_pModel->Load(a_sFileName);
+	MyObjBounds bounds;
+	MyObjFile::LoadModel(m_pModel, a_sFileName, &bounds);
+	m_sFileName = a_sFileName;
 	//if the model is loaded
 	if (m_pModel->GetName() != "")
 	{
-		GenUniqueID(a_sUniqueID);
-		m_sUniqueID = a_sUniqueID;
-		m_IDMap[a_sUniqueID] = this;
-		m_pRigidBody = new MyRigidBody(m_pModel->GetVertexList()); //generate a rigid body
+		RegisterUniqueID(a_sUniqueID);
+		//generate a rigid body, from the bounds of the file if it was read or cached here
+		if (bounds.bValid)
+			m_pRigidBody = new MyRigidBody(std::vector<vector3>{ bounds.v3Min, bounds.v3Max });
+		else
+			m_pRigidBody = new MyRigidBody(m_pModel->GetVertexList());
+		m_bInMemory = true; //mark this entity as viable
+	}
+}
+Simplex::MyEntity::MyEntity(Model* a_pModel, String a_sFileName, vector3 a_v3MinL, vector3 a_v3MaxL, String a_sUniqueID)
+{
+	Init();
+	m_pModel = a_pModel;
+	m_sFileName = a_sFileName;
+	//if the model is loaded
+	if (m_pModel != nullptr && m_pModel->GetName() != "")
+	{
+		RegisterUniqueID(a_sUniqueID);
+		//the box holds the extremes of the vertices, so the rigid body comes out the same
+		m_pRigidBody = new MyRigidBody(std::vector<vector3>{ a_v3MinL, a_v3MaxL });
 		m_bInMemory = true; //mark this entity as viable
 	}
 }
+Simplex::MyEntity::MyEntity(String a_sFileName, vector3 a_v3MinL, vector3 a_v3MaxL, String a_sUniqueID)
+{
+	Init();
+	m_sFileName = a_sFileName;
+	RegisterUniqueID(a_sUniqueID);
+	//the box stands in for the model until it lands
+	m_pRigidBody = new MyRigidBody(std::vector<vector3>{ a_v3MinL, a_v3MaxL });
+	m_bLoading = true;
+	m_bInMemory = true; //mark this entity as viable
+}
 Simplex::MyEntity::MyEntity(MyEntity const& other)
 {
 	m_bInMemory = other.m_bInMemory;
+	m_bLoading = other.m_bLoading;
 	m_pModel = other.m_pModel;
 	//generate a new rigid body we do not share the same rigid body as we do the model
-	m_pRigidBody = new MyRigidBody(m_pModel->GetVertexList()); 
+	if (m_pModel != nullptr)
+		m_pRigidBody = new MyRigidBody(m_pModel->GetVertexList());
+	else if (other.m_pRigidBody != nullptr)
+		m_pRigidBody = new MyRigidBody(std::vector<vector3>{ other.m_pRigidBody->GetMinLocal(), other.m_pRigidBody->GetMaxLocal() });
 	m_m4ToWorld = other.m_m4ToWorld;
 	m_pMeshMngr = other.m_pMeshMngr;
 	m_sUniqueID = other.m_sUniqueID;
+	m_sFileName = other.m_sFileName;
 	m_bSetAxis = other.m_bSetAxis;
+	m_bStatic = other.m_bStatic;
+	m_uCategory = other.m_uCategory;
+	m_uCollisionMask = other.m_uCollisionMask;
 	m_nDimensionCount = other.m_nDimensionCount;
 	m_DimensionArray = other.m_DimensionArray;
 
@@ -106,8 +187,14 @@ void Simplex::MyEntity::AddToRenderList(bool a_bDrawRigidBody)
 	if (!m_bInMemory)
 		return;
 
-	//draw model
-	m_pModel->AddToRenderList();
+	//draw model, or the box standing in for it
+	if (m_pModel != nullptr)
+	{
+		m_pModel->SetModelMatrix(m_m4ToWorld);
+		m_pModel->AddToRenderList();
+	}
+	else
+		AddPlaceholderToRenderList(m_m4ToWorld);
 	
 	//draw rigid body
 	if(a_bDrawRigidBody)
@@ -116,15 +203,45 @@ void Simplex::MyEntity::AddToRenderList(bool a_bDrawRigidBody)
 	if (m_bSetAxis)
 		m_pMeshMngr->AddAxisToRenderList(m_m4ToWorld);
 }
+void Simplex::MyEntity::AddToRenderList(matrix4 a_m4ToWorld, vector3 a_v3MinG, vector3 a_v3MaxG, bool a_bColliding, bool a_bDrawRigidBody)
+{
+	//if not in memory return
+	if (!m_bInMemory)
+		return;
+
+	//draw model, or the box standing in for it
+	if (m_pModel != nullptr)
+	{
+		m_pModel->SetModelMatrix(a_m4ToWorld);
+		m_pModel->AddToRenderList();
+	}
+	else
+		AddPlaceholderToRenderList(a_m4ToWorld);
+
+	//draw rigid body
+	if (a_bDrawRigidBody)
+		m_pRigidBody->AddToRenderList(a_m4ToWorld, a_v3MinG, a_v3MaxG, a_bColliding);
+
+	if (m_bSetAxis)
+		m_pMeshMngr->AddAxisToRenderList(a_m4ToWorld);
+}
+void Simplex::MyEntity::AddPlaceholderToRenderList(matrix4 a_m4ToWorld)
+{
+	vector3 v3Size = m_pRigidBody->GetMaxLocal() - m_pRigidBody->GetMinLocal();
+	matrix4 m4Box = a_m4ToWorld * glm::translate(m_pRigidBody->GetCenterLocal()) * glm::scale(v3Size);
+	m_pMeshMngr->AddWireCubeToRenderList(m4Box, C_ORANGE, RENDER_WIRE);
+}
 MyEntity* Simplex::MyEntity::GetEntity(String a_sUniqueID)
 {
 	//look the entity based on the unique id
+	std::lock_guard<std::recursive_mutex> lock(m_IDMutex);
 	auto entity = m_IDMap.find(a_sUniqueID);
 	//if not found return nullptr, if found return it
 	return entity == m_IDMap.end() ? nullptr : entity->second;
 }
 void Simplex::MyEntity::GenUniqueID(String& a_sUniqueID)
 {
+	std::lock_guard<std::recursive_mutex> lock(m_IDMutex);
 	static uint index = 0;
 	String sName = a_sUniqueID;
 	MyEntity* pEntity = GetEntity(a_sUniqueID);
@@ -137,6 +254,22 @@ void Simplex::MyEntity::GenUniqueID(String& a_sUniqueID)
 	}
 	return;
 }
+void Simplex::MyEntity::ReleaseUniqueID(void)
+{
+	//a removed entity already gave up its id, which may belong to another entity by now
+	std::lock_guard<std::recursive_mutex> lock(m_IDMutex);
+	auto entity = m_IDMap.find(m_sUniqueID);
+	if (entity != m_IDMap.end() && entity->second == this)
+		m_IDMap.erase(entity);
+}
+void Simplex::MyEntity::RegisterUniqueID(String a_sUniqueID)
+{
+	//the name is picked and taken at once so no other thread takes it in between
+	std::lock_guard<std::recursive_mutex> lock(m_IDMutex);
+	GenUniqueID(a_sUniqueID);
+	m_sUniqueID = a_sUniqueID;
+	m_IDMap[a_sUniqueID] = this;
+}
 void Simplex::MyEntity::AddDimension(uint a_uDimension)
 {
 	//we need to check that this dimension is not already allocated in the list
@@ -197,6 +330,10 @@ void Simplex::MyEntity::ClearDimensionSet(void)
 	}
 	m_nDimensionCount = 0;
 }
+uint Simplex::MyEntity::GetDimensionCount(void)
+{
+	return m_nDimensionCount;
+}
 bool Simplex::MyEntity::IsInDimension(uint a_uDimension)
 {
 	//see if the entry is in the set
@@ -244,6 +381,10 @@ bool Simplex::MyEntity::IsColliding(MyEntity* const other)
 	if (!SharesDimension(other))
 		return false;
 
+	//entities on layers that ignore each other never collide
+	if (!IsFilterPassing(other))
+		return false;
+
 	return m_pRigidBody->IsColliding(other->GetRigidBody());
 }
 void Simplex::MyEntity::ClearCollisionList(void)
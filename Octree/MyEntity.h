@@ -6,16 +6,30 @@ Date: 2017/07
 #define __MYENTITY_H_
 
 #include "MyRigidBody.h"
+#include <mutex>
 
 namespace Simplex
 {
 
+//Motion state of an entity, decides which pairs the entity manager processes on each update
+enum MY_MOTION_STATE
+{
+	MS_STATIC = 0, //declared static, its pairs are only processed on the updates it is moved
+	MS_SLEEPING = 1, //has not moved for a while, its pairs keep their cached results
+	MS_AWAKE = 2 //moved recently, its pairs are processed on every update
+};
+
 //System Class
 class MyEntity
 {
 	bool m_bInMemory = false; 
 	bool m_bSetAxis = false; 
+	bool m_bStatic = false; //is the entity declared as not moving?
+	bool m_bLoading = false; //is the model still being loaded? a box stands in for it until it lands
+	uint m_uCategory = 1; //collision layers the entity belongs to, one bit per layer
+	uint m_uCollisionMask = 0xFFFFFFFF; //collision layers the entity collides with
 	String m_sUniqueID = ""; 
+	String m_sFileName = ""; //file the model was loaded from
 
 	uint m_nDimensionCount = 0; 
 	uint* m_DimensionArray = nullptr; 
@@ -27,6 +41,7 @@ class MyEntity
 	MeshManager* m_pMeshMngr = nullptr; 
 
 	static std::map<String, MyEntity*> m_IDMap; 
+	static std::recursive_mutex m_IDMutex; //guards the map, entities are made on the render thread and removed on the simulation's
 
 public:
 	/*
@@ -38,6 +53,29 @@ public:
 	*/
 	MyEntity(String a_sFileName, String a_sUniqueID = "NA");
 	/*
+	Usage: Constructor that shares a model already loaded, the rigid body is made from the local box instead of
+	the vertices so nothing is read from the model
+	Arguments:
+	-	Model* a_pModel -> loaded model, nullptr makes an entity that is not initialized
+	-	String a_sFileName -> file the model was loaded from
+	-	vector3 a_v3MinL -> minimum of the model in local space
+	-	vector3 a_v3MaxL -> maximum of the model in local space
+	-	String a_sUniqueID -> Name wanted as identifier, if not available will generate one
+	Output: class object instance
+	*/
+	MyEntity(Model* a_pModel, String a_sFileName, vector3 a_v3MinL, vector3 a_v3MaxL, String a_sUniqueID = "NA");
+	/*
+	Usage: Constructor for an entity whose model is still being loaded, it collides and is drawn as the box given
+	until SetModel is called
+	Arguments:
+	-	String a_sFileName -> file the model is being loaded from
+	-	vector3 a_v3MinL -> minimum of the box standing in for the model, in local space
+	-	vector3 a_v3MaxL -> maximum of the box standing in for the model, in local space
+	-	String a_sUniqueID -> Name wanted as identifier, if not available will generate one
+	Output: class object instance
+	*/
+	MyEntity(String a_sFileName, vector3 a_v3MinL, vector3 a_v3MaxL, String a_sUniqueID = "NA");
+	/*
 	Usage: Copy Constructor
 	Arguments: class object to copy
 	Output: class object instance
@@ -74,12 +112,33 @@ public:
 	*/
 	void SetModelMatrix(matrix4 a_m4ToWorld);
 	/*
+	USAGE: Moves the entity, the model matrix and the rigid body are translated instead of recomputed
+	ARGUMENTS: vector3 a_v3Offset -> displacement in global space
+	OUTPUT: ---
+	*/
+	void Translate(vector3 a_v3Offset);
+	/*
 	USAGE: Gets the model associated with this entity
 	ARGUMENTS: ---
 	OUTPUT: Model
 	*/
 	Model* GetModel(void);
 	/*
+	USAGE: Gives the entity the model it was waiting for, the rigid body takes the box of the model
+	ARGUMENTS:
+	-	Model* a_pModel -> loaded model
+	-	vector3 a_v3MinL -> minimum of the model in local space
+	-	vector3 a_v3MaxL -> maximum of the model in local space
+	OUTPUT: ---
+	*/
+	void SetModel(Model* a_pModel, vector3 a_v3MinL, vector3 a_v3MaxL);
+	/*
+	USAGE: Asks if the entity is still waiting for its model
+	ARGUMENTS: ---
+	OUTPUT: is it loading?
+	*/
+	bool IsLoading(void);
+	/*
 	USAGE: Gets the Rigid Body associated with this entity
 	ARGUMENTS: ---
 	OUTPUT: Rigid Body
@@ -98,6 +157,18 @@ public:
 	*/
 	void AddToRenderList(bool a_bDrawRigidBody = false);
 	/*
+	USAGE: Adds the entity to the render list at a state copied from another thread, the model is only touched
+	here so the simulation can keep moving the entity meanwhile
+	ARGUMENTS:
+	-	matrix4 a_m4ToWorld -> model matrix to draw it with
+	-	vector3 a_v3MinG -> minimum of the global bounds
+	-	vector3 a_v3MaxG -> maximum of the global bounds
+	-	bool a_bColliding -> is it colliding?
+	-	bool a_bDrawRigidBody = false -> draw the rigid body too?
+	OUTPUT: ---
+	*/
+	void AddToRenderList(matrix4 a_m4ToWorld, vector3 a_v3MinG, vector3 a_v3MaxG, bool a_bColliding, bool a_bDrawRigidBody = false);
+	/*
 	USAGE: Tells if this entity is colliding with the incoming one
 	ARGUMENTS: MyEntity* const other -> inspected entity
 	OUTPUT: are they colliding?
@@ -116,18 +187,69 @@ public:
 	*/
 	void GenUniqueID(String& a_sUniqueID);
 	/*
+	USAGE: Gives up the unique ID of this entity so another one can take it, GetEntity no longer finds it
+	ARGUMENTS: ---
+	OUTPUT: ---
+	*/
+	void ReleaseUniqueID(void);
+	/*
 	USAGE: Gets the Unique ID name of this model
 	ARGUMENTS: ---
 	OUTPUT: ---
 	*/
 	String GetUniqueID(void);
 	/*
+	USAGE: Gets the file the model of this entity was loaded from
+	ARGUMENTS: ---
+	OUTPUT: file name
+	*/
+	String GetFileName(void);
+	/*
 	USAGE: Sets the visibility of the axis of this MyEntity
 	ARGUMENTS: bool a_bSetAxis = true -> axis visible?
 	OUTPUT: ---
 	*/
 	void SetAxisVisible(bool a_bSetAxis = true);
 	/*
+	USAGE: Declares the MyEntity as static, static entities never fall asleep as they are not expected to move
+	ARGUMENTS: bool a_bStatic = true -> is it static?
+	OUTPUT: ---
+	*/
+	void SetStatic(bool a_bStatic = true);
+	/*
+	USAGE: Asks if the MyEntity is declared as static
+	ARGUMENTS: ---
+	OUTPUT: is it static?
+	*/
+	bool IsStatic(void);
+	/*
+	USAGE: Sets the collision layers of the MyEntity, two entities are only tested if each one's category is in
+	the other's mask
+	ARGUMENTS:
+	-	uint a_uCategory -> layers the entity belongs to, one bit per layer
+	-	uint a_uMask -> layers the entity collides with
+	OUTPUT: ---
+	*/
+	void SetCollisionFilter(uint a_uCategory, uint a_uMask);
+	/*
+	USAGE: Gets the collision layers the MyEntity belongs to
+	ARGUMENTS: ---
+	OUTPUT: category bits
+	*/
+	uint GetCategory(void);
+	/*
+	USAGE: Gets the collision layers the MyEntity collides with
+	ARGUMENTS: ---
+	OUTPUT: mask bits
+	*/
+	uint GetCollisionMask(void);
+	/*
+	USAGE: Asks if the collision filters of both entities let them collide
+	ARGUMENTS: MyEntity* const a_pOther -> queried entity
+	OUTPUT: can they collide?
+	*/
+	bool IsFilterPassing(MyEntity* const a_pOther);
+	/*
 	USAGE: Will set a dimension to the MyEntity
 	ARGUMENTS: uint a_uDimension -> dimension to set
 	OUTPUT: ---
@@ -152,6 +274,12 @@ public:
 	*/
 	bool IsInDimension(uint a_uDimension);
 	/*
+	USAGE: Gets the number of dimensions the entity is in
+	ARGUMENTS: ---
+	OUTPUT: dimension count
+	*/
+	uint GetDimensionCount(void);
+	/*
 	USAGE: Asks if this entity shares a dimension with the incoming one
 	ARGUMENTS: MyEntity* const a_pOther -> queried entity
 	OUTPUT: shares at least one dimension?
@@ -178,6 +306,18 @@ private:
 	Usage: Allocates member fields
 	*/
 	void Init(void);
+
+	/*
+	Usage: Takes a unique ID based on the name provided and registers the entity under it
+	Arguments: String a_sUniqueID -> desired name
+	*/
+	void RegisterUniqueID(String a_sUniqueID);
+
+	/*
+	Usage: Adds the box standing in for a model still being loaded to the render list
+	Arguments: matrix4 a_m4ToWorld -> model matrix to draw it with
+	*/
+	void AddPlaceholderToRenderList(matrix4 a_m4ToWorld);
 };
 } 
 
@@ -1,4 +1,11 @@
 #include "MyEntityManager.h"
+#include "MyProfiler.h"
+#include "MySceneFile.h"
+#include "MyObjFile.h"
+#include "MyOctreeTuner.h"
+#include <chrono>
+#include <algorithm>
+#include <unordered_map>
 using namespace Simplex;
 //  MyEntityManager
 Simplex::MyEntityManager* Simplex::MyEntityManager::m_pInstance = nullptr;
@@ -6,6 +13,44 @@ void Simplex::MyEntityManager::Init(void)
 {
 	m_uEntityCount = 0;
 	m_mEntityArray = nullptr;
+	m_eBroadphase = BP_OCTREE;
+	m_eStrategy = BP_COUNT;
+	m_fBroadphaseTime = 0.0f;
+	m_bFilterChanged = true;
+
+	MySweepAndPrune* pMultiAxis = new MySweepAndPrune();
+	pMultiAxis->SetMultiAxis(true);
+	m_pBroadphase[BP_OCTREE] = new MyOctreeBroadphase();
+	m_pBroadphase[BP_HASHGRID] = new MySpatialHashGrid();
+	m_pBroadphase[BP_SAP] = new MySweepAndPrune();
+	m_pBroadphase[BP_SAP_MULTIAXIS] = pMultiAxis;
+	m_pBroadphase[BP_BVH] = new MyDynamicAABBTree();
+
+	m_pPairCache = new MyPairCache();
+	m_pMotion = new MyMotionSystem();
+	m_pCommandQueue = new MyCommandQueue();
+	m_pEntityEpoch = new MyEpoch();
+	m_pAssetLoader = new MyAssetLoader();
+	m_lLanded.clear();
+	m_bReindexed = true;
+	m_uNarrowphaseCount = 0;
+	m_Stats = MyCollisionStats();
+
+	m_uAdaptiveMask = (1 << BP_ADAPTIVE) - 1;
+	m_uAdaptiveTrial = BP_ADAPTIVE;
+	m_uAdaptiveFrame = 0;
+	m_uAdaptiveEntityCount = 0;
+	m_eAdaptiveStrategy = BP_OCTREE;
+	for (uint i = 0; i < BP_ADAPTIVE; i++)
+	{
+		m_fAdaptiveTime[i] = 0.0f;
+	}
+
+	m_bOctreeAutoTune = false;
+	m_uTuneEntityCount = 0;
+	m_fTuneSpread = 0.0f;
+	m_lOctreeTrial.clear();
+	m_pOctreeTuner = nullptr;
 }
 void Simplex::MyEntityManager::Release(void)
 {
@@ -16,6 +61,22 @@ void Simplex::MyEntityManager::Release(void)
 	}
 	m_uEntityCount = 0;
 	m_mEntityArray = nullptr;
+	for (uint i = 0; i < BP_ADAPTIVE; i++)
+	{
+		SafeDelete(m_pBroadphase[i]);
+	}
+	SafeDelete(m_pPairCache);
+	SafeDelete(m_pMotion);
+	SafeDelete(m_pOctreeTuner);
+	m_lLoading.clear();
+	//the spawns never applied made no entity, their models stay alive like the ones of the entities
+	m_lCommand.clear();
+	SafeDelete(m_pCommandQueue);
+	//no snapshot is drawn anymore, the entities retired are deleted with it
+	SafeDelete(m_pEntityEpoch);
+	//the models it made stay alive like the ones of the entities
+	SafeDelete(m_pAssetLoader);
+	m_lLanded.clear();
 }
 Simplex::MyEntityManager* Simplex::MyEntityManager::GetInstance()
 {
@@ -123,6 +184,7 @@ void Simplex::MyEntityManager::SetModelMatrix(matrix4 a_m4ToWorld, String a_sUni
 	if (pTemp)
 	{
 		pTemp->SetModelMatrix(a_m4ToWorld);
+		m_pMotion->SetPosition(GetEntityIndex(a_sUniqueID), vector3(a_m4ToWorld[3]));
 	}
 }
 void Simplex::MyEntityManager::SetAxisVisibility(bool a_bVisibility, uint a_uIndex)
@@ -158,6 +220,7 @@ void Simplex::MyEntityManager::SetModelMatrix(matrix4 a_m4ToWorld, uint a_uIndex
 		a_uIndex = m_uEntityCount - 1;
 
 	m_mEntityArray[a_uIndex]->SetModelMatrix(a_m4ToWorld);
+	m_pMotion->SetPosition(a_uIndex, vector3(a_m4ToWorld[3]));
 }
 //The big 3
 Simplex::MyEntityManager::MyEntityManager(){Init();}
@@ -167,21 +230,849 @@ Simplex::MyEntityManager::~MyEntityManager(){Release();};
 // other methods
 void Simplex::MyEntityManager::Update(void)
 {
-	//Clear all collisions
+	MY_PROFILE_ZONE("MyEntityManager::Update");
+	//the adaptive mode runs whichever strategy it is timing or has chosen
+	MY_BROADPHASE eStrategy = m_eBroadphase == BP_ADAPTIVE ? m_eAdaptiveStrategy : m_eBroadphase;
+	MyBroadphase* pBroadphase = m_pBroadphase[eStrategy];
+
+	//the entities removed before the last snapshot was published are deleted once no one draws them
+	m_pEntityEpoch->Collect();
+
+	//the edits queued since the last update land here, before anything reads the entity list
+	ApplyCommands();
+
+	//the bodies move before the bounds are read so the broadphase sees where they are now
+	StepMotion();
+	GatherBounds();
+	UpdateMotionStates();
+
+	//the tuner times the configurations on a copy of the scene a slice per update, the octree keeps its settings meanwhile
+	if (m_bOctreeAutoTune)
+		StepOctreeTuner();
+	else
+		SafeDelete(m_pOctreeTuner);
+
+	m_Stats = MyCollisionStats();
+	m_Stats.uEntityCount = m_uEntityCount;
+	m_Stats.uActiveCount = static_cast<uint>(m_lActiveList.size());
+
+	//a rebuild of the octree keeps going, and gets swapped in, while the scene rests or another strategy is in use
+	bool bResting = m_lActiveList.empty() && eStrategy == m_eStrategy && !m_bReindexed;
+	MyOctreeBroadphase* pOctree = static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE]);
+	if (pOctree->IsBuilding() && (bResting || eStrategy != BP_OCTREE))
+		pOctree->Update(m_lMinGlobal, m_lMaxGlobal);
+
+	//with every entity at rest the pairs keep their cached results and there is nothing to report
+	if (bResting)
+	{
+		m_lEventList.clear();
+		m_uNarrowphaseCount = 0;
+		m_fBroadphaseTime = 0.0f;
+		GatherOctreeStats();
+		return;
+	}
+
+	m_lPairList.clear();
+
+	{
+		MY_PROFILE_ZONE("Broadphase");
+		auto tStart = std::chrono::high_resolution_clock::now();
+		pBroadphase->ResetStats();
+		//the filters are only sent when they change, or to a structure that has not seen them yet
+		if (eStrategy != m_eStrategy || m_bFilterChanged)
+			pBroadphase->SetFilters(m_lCategory, m_lMask);
+		m_bFilterChanged = false;
+		//a structure that sat out the last updates has not seen the latest changes, build it from scratch
+		if (eStrategy != m_eStrategy)
+			pBroadphase->Build(m_lMinGlobal, m_lMaxGlobal);
+		else
+			pBroadphase->Update(m_lMinGlobal, m_lMaxGlobal);
+		//with few entities active it is cheaper to query around them than to list every pair
+		MyBroadphaseStats managerStats;
+		bool bQueryActive = m_lActiveList.size() * 4 < m_uEntityCount;
+		if (bQueryActive)
+			QueryActivePairs(pBroadphase, managerStats);
+		else
+			pBroadphase->QueryPairs(m_lPairList);
+		auto tEnd = std::chrono::high_resolution_clock::now();
+		m_fBroadphaseTime = std::chrono::duration<float, std::milli>(tEnd - tStart).count();
+
+		m_Stats.Broadphase = pBroadphase->GetStats();
+		m_Stats.Broadphase += managerStats;
+		m_Stats.uPairsReported = static_cast<uint>(m_lPairList.size());
+		//the pairs the structure looked at are the ones the leaves or cells did not rule out
+		unsigned long long uAllPairs = m_uEntityCount > 1 ? (unsigned long long)m_uEntityCount * (m_uEntityCount - 1) / 2 : 0;
+		if (!bQueryActive && uAllPairs > m_Stats.Broadphase.uCandidatePairs)
+			m_Stats.uSpatialCulled = uAllPairs - m_Stats.Broadphase.uCandidatePairs;
+		MY_PROFILE_COUNTER("Active entities", m_lActiveList.size());
+		MY_PROFILE_COUNTER("Pairs found", m_lPairList.size());
+		MY_PROFILE_COUNTER("Nodes visited", m_Stats.Broadphase.uNodesVisited);
+	}
+	m_eStrategy = eStrategy;
+	GatherOctreeStats();
+
+	//check collisions only on the pairs found by the broadphase, the colliding lists persist between updates
+	CheckPairList();
+
+	//the contacts push the bodies apart, the entities follow on the next update
+	{
+		MY_PROFILE_ZONE("ResolveContacts");
+		m_pMotion->ResolveContacts(m_lEventList, m_lMinGlobal, m_lMaxGlobal);
+	}
+
+	if (m_eBroadphase == BP_ADAPTIVE)
+		StepAdaptive(m_fBroadphaseTime);
+}
+void Simplex::MyEntityManager::CheckPairList(void)
+{
+	MY_PROFILE_ZONE("Narrowphase");
+	m_lEventList.clear();
+	m_uNarrowphaseCount = 0;
+
+	//adding or removing entities shifts the indices, even when as many are added as removed, so the cached pairs
+	//no longer name the same entities
+	if (m_bReindexed)
+	{
+		m_pPairCache->Clear(m_lEventList);
+		for (uint i = 0; i < m_uEntityCount; i++)
+		{
+			m_mEntityArray[i]->ClearCollisionList();
+		}
+		m_bReindexed = false;
+	}
+
+	m_pPairCache->BeginFrame();
+	uint uProcessed = 0;
+	for (uint i = 0; i < m_lPairList.size(); i++)
+	{
+		uint uA = m_lPairList[i].uA;
+		uint uB = m_lPairList[i].uB;
+
+		//pairs between entities at rest are not looked at, their cache entries stay as they are
+		if (!m_lActive[uA] && !m_lActive[uB])
+			continue;
+		++uProcessed;
+
+		MyRigidBody* pRigidBodyA = m_mEntityArray[uA]->GetRigidBody();
+		MyRigidBody* pRigidBodyB = m_mEntityArray[uB]->GetRigidBody();
+
+		bool bNew = false;
+		MyPairCache::Entry& entry = m_pPairCache->Touch(uA, uB, bNew);
+
+		//the narrowphase only depends on the bounds, reuse the cached result while neither entity moves
+		bool bColliding = entry.bColliding;
+		if (bNew || m_lMoved[uA] || m_lMoved[uB])
+		{
+			bColliding = pRigidBodyA->IsIntersecting(pRigidBodyB);
+			++m_uNarrowphaseCount;
+		}
+
+		if (bColliding)
+			++m_Stats.uContacts;
+
+		MyCollisionEvent event;
+		event.uA = uA;
+		event.uB = uB;
+		if (bColliding && !entry.bColliding)
+		{
+			event.eType = CE_BEGIN;
+			m_lEventList.push_back(event);
+			pRigidBodyA->AddCollisionWith(pRigidBodyB);
+			pRigidBodyB->AddCollisionWith(pRigidBodyA);
+		}
+		else if (bColliding)
+		{
+			event.eType = CE_STAY;
+			m_lEventList.push_back(event);
+		}
+		else if (entry.bColliding)
+		{
+			event.eType = CE_END;
+			m_lEventList.push_back(event);
+			pRigidBodyA->RemoveCollisionWith(pRigidBodyB);
+			pRigidBodyB->RemoveCollisionWith(pRigidBodyA);
+		}
+		entry.bColliding = bColliding;
+	}
+
+	//pairs the broadphase stopped reporting are dropped, the colliding ones end
+	uint uFirstEnd = static_cast<uint>(m_lEventList.size());
+	m_pPairCache->EndFrame(m_lActive, m_lEventList);
+	for (uint i = uFirstEnd; i < m_lEventList.size(); i++)
+	{
+		MyRigidBody* pRigidBodyA = m_mEntityArray[m_lEventList[i].uA]->GetRigidBody();
+		MyRigidBody* pRigidBodyB = m_mEntityArray[m_lEventList[i].uB]->GetRigidBody();
+		pRigidBodyA->RemoveCollisionWith(pRigidBodyB);
+		pRigidBodyB->RemoveCollisionWith(pRigidBodyA);
+	}
+
+	//the cache is up to date with the current bounds
+	std::fill(m_lMoved.begin(), m_lMoved.end(), 0);
+	m_Stats.uNarrowphaseTests = m_uNarrowphaseCount;
+	m_Stats.uCachedResults = uProcessed - m_uNarrowphaseCount;
+	MY_PROFILE_COUNTER("Pairs tested", m_uNarrowphaseCount);
+	MY_PROFILE_COUNTER("Contacts", m_Stats.uContacts);
+}
+void Simplex::MyEntityManager::GatherOctreeStats(void)
+{
+	MyOctreeBroadphase* pOctree = static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE]);
+	if (m_eStrategy != BP_OCTREE)
+	{
+		m_Stats.uLeafCount = 0;
+		std::fill(m_Stats.lLeafHistogram, m_Stats.lLeafHistogram + MyCollisionStats::LEAF_BUCKETS, 0);
+		m_Stats.fDuplication = 0.0f;
+		m_Stats.uSplitOctants = 0;
+		m_Stats.uKeptOctants = 0;
+		m_Stats.fSplitSaving = 0.0f;
+		return;
+	}
+
+	m_Stats.uLeafCount = pOctree->GetLeafCount();
+	pOctree->GetLeafHistogram(m_Stats.lLeafHistogram, MyCollisionStats::LEAF_BUCKETS);
+	m_Stats.fDuplication = pOctree->GetDuplicationFactor();
+	pOctree->GetSplitStats(m_Stats.uSplitOctants, m_Stats.uKeptOctants, m_Stats.fSplitSaving);
+}
+void Simplex::MyEntityManager::ApplyCommands(void)
+{
+	if (m_pCommandQueue->IsEmpty())
+		return;
+
+	MY_PROFILE_ZONE("ApplyCommands");
+	m_lCommand.clear();
+	m_pCommandQueue->Drain(m_lCommand);
+	MY_PROFILE_COUNTER("Commands", m_lCommand.size());
+
+	//indices past the entity count are the spawns of this batch, they are appended once every command is read
+	std::vector<MyEntity*> lSpawn;
+	std::vector<uint> lDespawn;
+	std::vector<char> lDespawned(m_uEntityCount, 0);
+	m_lEdit.clear();
+
+	//the unique IDs are looked up in a map made for the whole batch, the first time a despawn or transform needs it
+	std::unordered_map<String, uint> mIndex;
+	bool bIndexed = false;
+	auto Find = [&](String const& a_sUniqueID)
+	{
+		if (!bIndexed)
+		{
+			mIndex.reserve(m_uEntityCount + lSpawn.size());
+			for (uint uIndex = 0; uIndex < m_uEntityCount + lSpawn.size(); uIndex++)
+			{
+				if (!lDespawned[uIndex])
+					mIndex[uIndex < m_uEntityCount ? m_mEntityArray[uIndex]->GetUniqueID() : lSpawn[uIndex - m_uEntityCount]->GetUniqueID()] = uIndex;
+			}
+			bIndexed = true;
+		}
+		return mIndex.find(a_sUniqueID);
+	};
+
+	for (uint i = 0; i < m_lCommand.size(); i++)
+	{
+		MyCommand const& command = m_lCommand[i];
+		if (command.eType == CMD_SPAWN)
+		{
+			MyEntity* pEntity = SpawnEntity(command);
+			if (pEntity == nullptr)
+				continue;
+			uint uIndex = m_uEntityCount + static_cast<uint>(lSpawn.size());
+			lSpawn.push_back(pEntity);
+			lDespawned.push_back(0);
+			if (bIndexed)
+				mIndex[pEntity->GetUniqueID()] = uIndex;
+			continue;
+		}
+
+		auto entry = Find(command.sUniqueID);
+		if (entry == mIndex.end())
+			continue;
+
+		uint uIndex = entry->second;
+		if (command.eType == CMD_TRANSFORM)
+		{
+			m_lEdit.push_back(std::make_pair(uIndex, i));
+			continue;
+		}
+
+		//the id is let go right away so a spawn later in the batch gets it instead of a new one
+		lDespawned[uIndex] = 1;
+		lDespawn.push_back(uIndex);
+		mIndex.erase(entry);
+		(uIndex < m_uEntityCount ? m_mEntityArray[uIndex] : lSpawn[uIndex - m_uEntityCount])->ReleaseUniqueID();
+	}
+
+	AppendEntities(lSpawn);
+	for (std::pair<uint, uint> const& edit : m_lEdit)
+	{
+		if (!lDespawned[edit.first])
+			SetModelMatrix(m_lCommand[edit.second].m4ToWorld, edit.first);
+	}
+	RemoveEntities(lDespawn);
+}
+MyEntity* Simplex::MyEntityManager::SpawnEntity(MyCommand const& a_Command)
+{
+	//a model that landed since the spawn was pushed is used right away, one that failed spawns nothing
+	MyEntity* pEntity = nullptr;
+	MyAsset* pAsset = a_Command.pAsset;
+	if (a_Command.pModel != nullptr)
+		pEntity = new MyEntity(a_Command.pModel, a_Command.sFileName, a_Command.v3MinL, a_Command.v3MaxL, a_Command.sUniqueID);
+	else if (pAsset->eState == AS_READY)
+		pEntity = new MyEntity(pAsset->pModel, a_Command.sFileName, pAsset->v3MinL, pAsset->v3MaxL, a_Command.sUniqueID);
+	else if (pAsset->eState == AS_FAILED)
+		return nullptr;
+	else //the entity stands in with a box and AttachAssets gives it the model
+		pEntity = new MyEntity(a_Command.sFileName, a_Command.v3MinL, a_Command.v3MaxL, a_Command.sUniqueID);
+
+	if (!pEntity->IsInitialized())
+	{
+		SafeDelete(pEntity);
+		return nullptr;
+	}
+	if (pEntity->IsLoading())
+		m_lLoading.push_back(std::make_pair(pEntity, pAsset));
+	pEntity->SetModelMatrix(a_Command.m4ToWorld);
+	return pEntity;
+}
+void Simplex::MyEntityManager::AppendEntities(std::vector<MyEntity*> const& a_lEntity)
+{
+	if (a_lEntity.empty())
+		return;
+
+	//create a new array with room for all of them
+	PEntity* tempArray = new PEntity[m_uEntityCount + a_lEntity.size()];
+	for (uint i = 0; i < m_uEntityCount; ++i)
+	{
+		tempArray[i] = m_mEntityArray[i];
+	}
+	for (uint i = 0; i < a_lEntity.size(); ++i)
+	{
+		tempArray[m_uEntityCount + i] = a_lEntity[i];
+	}
+	//if there was an older array delete
+	if (m_mEntityArray)
+	{
+		delete[] m_mEntityArray;
+	}
+	m_mEntityArray = tempArray;
+	m_uEntityCount += static_cast<uint>(a_lEntity.size());
+	m_bReindexed = true;
+}
+void Simplex::MyEntityManager::RemoveEntities(std::vector<uint>& a_lIndex)
+{
+	if (a_lIndex.empty())
+		return;
+
+	//from the highest index down the last entity is never one waiting to be removed
+	std::sort(a_lIndex.begin(), a_lIndex.end(), std::greater<uint>());
+	a_lIndex.erase(std::unique(a_lIndex.begin(), a_lIndex.end()), a_lIndex.end());
+	m_pMotion->Resize(m_uEntityCount);
+	uint uCount = m_uEntityCount;
+	for (uint uIndex : a_lIndex)
+	{
+		m_pMotion->RemoveEntity(uIndex);
+		std::swap(m_mEntityArray[uIndex], m_mEntityArray[uCount - 1]);
+		--uCount;
+		RetireEntity(m_mEntityArray[uCount]);
+	}
+
+	PEntity* tempArray = uCount > 0 ? new PEntity[uCount] : nullptr;
+	for (uint i = 0; i < uCount; ++i)
+	{
+		tempArray[i] = m_mEntityArray[i];
+	}
+	delete[] m_mEntityArray;
+	m_mEntityArray = tempArray;
+	m_uEntityCount = uCount;
+	m_bReindexed = true;
+}
+void Simplex::MyEntityManager::RetireEntity(MyEntity* a_pEntity)
+{
+	//the id is free right away so a spawn can take it, a snapshot being drawn may still point at the entity
+	a_pEntity->ReleaseUniqueID();
+	if (a_pEntity->IsLoading())
+	{
+		for (uint i = 0; i < m_lLoading.size(); ++i)
+		{
+			if (m_lLoading[i].first != a_pEntity)
+				continue;
+			m_lLoading[i] = m_lLoading.back();
+			m_lLoading.pop_back();
+			break;
+		}
+	}
+	m_pEntityEpoch->Retire([a_pEntity]() { delete a_pEntity; });
+}
+void Simplex::MyEntityManager::StepMotion(void)
+{
+	MY_PROFILE_ZONE("StepMotion");
+	m_pMotion->Resize(m_uEntityCount);
+	if (m_pMotion->GetBodyCount() == 0)
+		return;
+
+	m_pMotion->Integrate(MOTION_STEP);
+	m_pMotion->WriteBack(m_mEntityArray);
+	MY_PROFILE_COUNTER("Bodies", m_pMotion->GetBodyCount());
+}
+void Simplex::MyEntityManager::GatherBounds(void)
+{
+	MY_PROFILE_ZONE("GatherBounds");
+	//entities added or removed make every entity new to the pair cache, the indices may hold other entities
+	bool bResized = m_bReindexed || m_lMoved.size() != m_uEntityCount;
+	if (bResized)
+	{
+		m_lMoved.assign(m_uEntityCount, 1);
+		m_lIdleFrames.assign(m_uEntityCount, 0);
+		m_lMinGlobal.resize(m_uEntityCount);
+		m_lMaxGlobal.resize(m_uEntityCount);
+		m_lCategory.resize(m_uEntityCount);
+		m_lMask.resize(m_uEntityCount);
+		m_bFilterChanged = true;
+	}
 	for (uint i = 0; i < m_uEntityCount; i++)
 	{
-		m_mEntityArray[i]->ClearCollisionList();
+		//an entity with new filters has its pairs looked at again, the ones now filtered end
+		//an entity not in memory is on no layer, so every broadphase leaves it out of the pairs and the queries
+		MyEntity* pEntity = m_mEntityArray[i];
+		bool bInMemory = pEntity->IsInitialized();
+		uint uCategory = bInMemory ? pEntity->GetCategory() : 0;
+		uint uMask = bInMemory ? pEntity->GetCollisionMask() : 0;
+		if (uCategory != m_lCategory[i] || uMask != m_lMask[i])
+		{
+			m_lCategory[i] = uCategory;
+			m_lMask[i] = uMask;
+			m_lMoved[i] = 1;
+			m_bFilterChanged = true;
+		}
+		if (!bInMemory)
+			continue;
+
+		//only the rigid bodies whose model matrix changed need to be read
+		MyRigidBody* pRigidBody = pEntity->GetRigidBody();
+		if (!bResized && !pRigidBody->IsDirty())
+			continue;
+		pRigidBody->ClearDirty();
+
+		vector3 v3Min = pRigidBody->GetMinGlobal();
+		vector3 v3Max = pRigidBody->GetMaxGlobal();
+		if (v3Min != m_lMinGlobal[i] || v3Max != m_lMaxGlobal[i])
+		{
+			m_lMoved[i] = 1;
+		}
+		m_lMinGlobal[i] = v3Min;
+		m_lMaxGlobal[i] = v3Max;
 	}
+}
+void Simplex::MyEntityManager::UpdateMotionStates(void)
+{
+	m_lActive.resize(m_uEntityCount);
+	m_lActiveList.clear();
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		if (m_lMoved[i])
+			m_lIdleFrames[i] = 0;
+		else if (m_lIdleFrames[i] < SLEEP_DELAY)
+			++m_lIdleFrames[i];
 
-	//check collisions
-	for (uint i = 0; i < m_uEntityCount - 1; i++)
+		//static entities are only active on the updates they are moved, the rest stay awake for a while after moving
+		bool bActive = m_lMoved[i] || (!m_mEntityArray[i]->IsStatic() && m_lIdleFrames[i] < SLEEP_DELAY);
+		m_lActive[i] = bActive;
+		if (bActive)
+			m_lActiveList.push_back(i);
+	}
+}
+void Simplex::MyEntityManager::QueryActivePairs(MyBroadphase* a_pBroadphase, MyBroadphaseStats& a_Stats)
+{
+	for (uint i = 0; i < m_lActiveList.size(); i++)
 	{
-		for (uint j = i + 1; j < m_uEntityCount; j++)
+		uint uEntity = m_lActiveList[i];
+		m_lQueryList.clear();
+		//the query only reports the layers this entity collides with, the other direction is checked below
+		a_pBroadphase->QueryAABB(m_lMinGlobal[uEntity], m_lMaxGlobal[uEntity], m_lMask[uEntity], m_lQueryList);
+
+		for (uint j = 0; j < m_lQueryList.size(); j++)
 		{
-			m_mEntityArray[i]->IsColliding(m_mEntityArray[j]);
+			uint uOther = m_lQueryList[j];
+			//a pair of active entities is reported by its lowest index
+			if (uOther == uEntity)
+				continue;
+			if (m_lActive[uOther] && uOther < uEntity)
+			{
+				++a_Stats.uDuplicatePairs;
+				continue;
+			}
+			if (!(m_lCategory[uEntity] & m_lMask[uOther]))
+			{
+				++a_Stats.uLayerCulled;
+				continue;
+			}
+
+			MyEntityPair pair;
+			pair.uA = std::min(uEntity, uOther);
+			pair.uB = std::max(uEntity, uOther);
+			m_lPairList.push_back(pair);
 		}
 	}
 }
+Simplex::MyEventList const& Simplex::MyEntityManager::GetCollisionEvents(void) { return m_lEventList; }
+Simplex::uint Simplex::MyEntityManager::GetCachedPairCount(void) { return m_pPairCache->GetPairCount(); }
+Simplex::uint Simplex::MyEntityManager::GetNarrowphaseCount(void) { return m_uNarrowphaseCount; }
+Simplex::MyCollisionStats const& Simplex::MyEntityManager::GetCollisionStats(void) { return m_Stats; }
+void Simplex::MyEntityManager::GetMemoryReport(MyMemoryReport& a_Report)
+{
+	a_Report = MyMemoryReport();
+	if (m_eStrategy == BP_COUNT)
+		return;
+	m_pBroadphase[m_eStrategy]->GetMemoryReport(a_Report);
+}
+Simplex::uint Simplex::MyEntityManager::GetActiveCount(void) { return static_cast<uint>(m_lActiveList.size()); }
+Simplex::MY_MOTION_STATE Simplex::MyEntityManager::GetMotionState(uint a_uIndex)
+{
+	//if the list is empty return
+	if (m_uEntityCount == 0)
+		return MS_STATIC;
+
+	// if out of bounds
+	if (a_uIndex >= m_uEntityCount)
+		a_uIndex = m_uEntityCount - 1;
+
+	if (m_mEntityArray[a_uIndex]->IsStatic())
+		return MS_STATIC;
+	if (a_uIndex < m_lIdleFrames.size() && m_lIdleFrames[a_uIndex] >= SLEEP_DELAY)
+		return MS_SLEEPING;
+	return MS_AWAKE;
+}
+void Simplex::MyEntityManager::SetStatic(bool a_bStatic, uint a_uIndex)
+{
+	//if the list is empty return
+	if (m_uEntityCount == 0)
+		return;
+
+	//if the index is larger than the number of entries we are asking for the last one
+	if (a_uIndex >= m_uEntityCount)
+		a_uIndex = m_uEntityCount - 1;
+
+	m_mEntityArray[a_uIndex]->SetStatic(a_bStatic);
+}
+void Simplex::MyEntityManager::AddBody(vector3 a_v3Velocity, float a_fMass, uint a_uIndex)
+{
+	//if the list is empty return
+	if (m_uEntityCount == 0)
+		return;
+
+	//if the index is larger than the number of entries we are asking for the last one
+	if (a_uIndex >= m_uEntityCount)
+		a_uIndex = m_uEntityCount - 1;
+
+	m_pMotion->Resize(m_uEntityCount);
+	vector3 v3Position = vector3(m_mEntityArray[a_uIndex]->GetModelMatrix()[3]);
+	m_pMotion->AddBody(a_uIndex, v3Position, a_v3Velocity, a_fMass);
+}
+void Simplex::MyEntityManager::RemoveBody(uint a_uIndex)
+{
+	//if the list is empty return
+	if (m_uEntityCount == 0)
+		return;
+
+	//if the index is larger than the number of entries we are asking for the last one
+	if (a_uIndex >= m_uEntityCount)
+		a_uIndex = m_uEntityCount - 1;
+
+	m_pMotion->RemoveBody(a_uIndex);
+}
+Simplex::uint Simplex::MyEntityManager::GetBodyCount(void) { return m_pMotion->GetBodyCount(); }
+void Simplex::MyEntityManager::SetVelocity(vector3 a_v3Velocity, uint a_uIndex)
+{
+	//if the list is empty return
+	if (m_uEntityCount == 0)
+		return;
+
+	//if the index is larger than the number of entries we are asking for the last one
+	if (a_uIndex >= m_uEntityCount)
+		a_uIndex = m_uEntityCount - 1;
+
+	m_pMotion->SetVelocity(a_uIndex, a_v3Velocity);
+}
+Simplex::vector3 Simplex::MyEntityManager::GetVelocity(uint a_uIndex)
+{
+	//if the list is empty return
+	if (m_uEntityCount == 0)
+		return ZERO_V3;
+
+	//if the index is larger than the number of entries we are asking for the last one
+	if (a_uIndex >= m_uEntityCount)
+		a_uIndex = m_uEntityCount - 1;
+
+	return m_pMotion->GetVelocity(a_uIndex);
+}
+void Simplex::MyEntityManager::ApplyForce(vector3 a_v3Force, uint a_uIndex)
+{
+	//if the list is empty return
+	if (m_uEntityCount == 0)
+		return;
+
+	//if the index is larger than the number of entries we are asking for the last one
+	if (a_uIndex >= m_uEntityCount)
+		a_uIndex = m_uEntityCount - 1;
+
+	m_pMotion->ApplyForce(a_uIndex, a_v3Force);
+}
+void Simplex::MyEntityManager::SetGravity(vector3 a_v3Gravity) { m_pMotion->SetGravity(a_v3Gravity); }
+void Simplex::MyEntityManager::SetWorldBounds(vector3 a_v3Min, vector3 a_v3Max) { m_pMotion->SetWorldBounds(a_v3Min, a_v3Max); }
+float Simplex::MyEntityManager::GetTimeStep(void) { return MOTION_STEP; }
+void Simplex::MyEntityManager::SetStatic(bool a_bStatic, String a_sUniqueID)
+{
+	//Get the entity
+	MyEntity* pTemp = MyEntity::GetEntity(a_sUniqueID);
+	//if the entity exists
+	if (pTemp)
+	{
+		pTemp->SetStatic(a_bStatic);
+	}
+}
+void Simplex::MyEntityManager::SetCollisionFilter(uint a_uCategory, uint a_uMask, uint a_uIndex)
+{
+	//if the list is empty return
+	if (m_uEntityCount == 0)
+		return;
+
+	//if the index is larger than the number of entries we are asking for the last one
+	if (a_uIndex >= m_uEntityCount)
+		a_uIndex = m_uEntityCount - 1;
+
+	m_mEntityArray[a_uIndex]->SetCollisionFilter(a_uCategory, a_uMask);
+}
+void Simplex::MyEntityManager::SetCollisionFilter(uint a_uCategory, uint a_uMask, String a_sUniqueID)
+{
+	//Get the entity
+	MyEntity* pTemp = MyEntity::GetEntity(a_sUniqueID);
+	//if the entity exists
+	if (pTemp)
+	{
+		pTemp->SetCollisionFilter(a_uCategory, a_uMask);
+	}
+}
+void Simplex::MyEntityManager::SetBroadphase(MY_BROADPHASE a_eBroadphase)
+{
+	if (a_eBroadphase == BP_ADAPTIVE && m_eBroadphase != BP_ADAPTIVE)
+		StartAdaptive();
+	m_eBroadphase = a_eBroadphase;
+}
+Simplex::MY_BROADPHASE Simplex::MyEntityManager::GetBroadphase(void) { return m_eBroadphase; }
+Simplex::MY_BROADPHASE Simplex::MyEntityManager::GetActiveStrategy(void) { return m_eStrategy; }
+Simplex::String Simplex::MyEntityManager::GetBroadphaseName(void)
+{
+	if (m_eBroadphase != BP_ADAPTIVE)
+		return m_pBroadphase[m_eBroadphase]->GetName();
+
+	String sName = "Adaptive: " + m_pBroadphase[m_eAdaptiveStrategy]->GetName();
+	if (m_uAdaptiveTrial != BP_ADAPTIVE)
+		sName += " (timing)";
+	return sName;
+}
+void Simplex::MyEntityManager::SetAdaptiveStrategies(uint a_uMask)
+{
+	m_uAdaptiveMask = a_uMask & ((1 << BP_ADAPTIVE) - 1);
+	if (m_eBroadphase == BP_ADAPTIVE)
+		StartAdaptive();
+}
+void Simplex::MyEntityManager::StartAdaptive(void)
+{
+	for (uint i = 0; i < BP_ADAPTIVE; i++)
+	{
+		m_fAdaptiveTime[i] = 0.0f;
+	}
+	m_uAdaptiveFrame = 0;
+	m_uAdaptiveEntityCount = m_uEntityCount;
+
+	//time the enabled strategies in order, with none enabled fall back to the octree
+	m_uAdaptiveTrial = 0;
+	while (m_uAdaptiveTrial < BP_ADAPTIVE && !(m_uAdaptiveMask & (1 << m_uAdaptiveTrial)))
+		++m_uAdaptiveTrial;
+	m_eAdaptiveStrategy = m_uAdaptiveTrial < BP_ADAPTIVE ? static_cast<MY_BROADPHASE>(m_uAdaptiveTrial) : BP_OCTREE;
+}
+void Simplex::MyEntityManager::StepAdaptive(float a_fTime)
+{
+	++m_uAdaptiveFrame;
+
+	//once chosen, the strategy is kept until the scene changes size or the period runs out
+	if (m_uAdaptiveTrial == BP_ADAPTIVE)
+	{
+		if (m_uAdaptiveFrame >= ADAPTIVE_PERIOD || m_uEntityCount != m_uAdaptiveEntityCount)
+			StartAdaptive();
+		return;
+	}
+
+	//the first update of a trial builds the structure from scratch, it is not counted
+	if (m_uAdaptiveFrame > 1)
+		m_fAdaptiveTime[m_uAdaptiveTrial] += a_fTime;
+	if (m_uAdaptiveFrame <= ADAPTIVE_WINDOW)
+		return;
+
+	//move on to the next enabled strategy
+	m_uAdaptiveFrame = 0;
+	do
+	{
+		++m_uAdaptiveTrial;
+	} while (m_uAdaptiveTrial < BP_ADAPTIVE && !(m_uAdaptiveMask & (1 << m_uAdaptiveTrial)));
+
+	if (m_uAdaptiveTrial < BP_ADAPTIVE)
+	{
+		m_eAdaptiveStrategy = static_cast<MY_BROADPHASE>(m_uAdaptiveTrial);
+		return;
+	}
+
+	//every strategy had its window, keep the cheapest
+	uint uBest = BP_ADAPTIVE;
+	for (uint i = 0; i < BP_ADAPTIVE; i++)
+	{
+		if (!(m_uAdaptiveMask & (1 << i)))
+			continue;
+		if (uBest == BP_ADAPTIVE || m_fAdaptiveTime[i] < m_fAdaptiveTime[uBest])
+			uBest = i;
+	}
+	m_eAdaptiveStrategy = static_cast<MY_BROADPHASE>(uBest);
+}
+void Simplex::MyEntityManager::QueryAABB(vector3 a_v3Min, vector3 a_v3Max, std::vector<uint>& a_lEntities, uint a_uMask)
+{
+	if (m_eStrategy == BP_COUNT)
+		return;
+
+	m_pBroadphase[m_eStrategy]->QueryAABB(a_v3Min, a_v3Max, a_uMask, a_lEntities);
+}
+bool Simplex::MyEntityManager::Raycast(vector3 a_v3Origin, vector3 a_v3Direction, float a_fMaxDistance, uint& a_uIndex, float& a_fDistance, uint a_uMask)
+{
+	if (m_eStrategy == BP_COUNT)
+		return false;
+
+	return m_pBroadphase[m_eStrategy]->Raycast(a_v3Origin, glm::normalize(a_v3Direction), a_fMaxDistance, a_uMask, a_uIndex, a_fDistance);
+}
+void Simplex::MyEntityManager::SetConcurrentQueries(bool a_bConcurrent)
+{
+	static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->SetSharedView(a_bConcurrent);
+}
+void Simplex::MyEntityManager::QueryAABBConcurrent(vector3 a_v3Min, vector3 a_v3Max, std::vector<uint>& a_lEntities, uint a_uMask)
+{
+	//only the octree is read, the broadphase array never changes after Init
+	static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->QueryAABBShared(a_v3Min, a_v3Max, a_uMask, a_lEntities);
+}
+bool Simplex::MyEntityManager::RaycastConcurrent(vector3 a_v3Origin, vector3 a_v3Direction, float a_fMaxDistance, uint& a_uIndex, float& a_fDistance, uint a_uMask)
+{
+	return static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->RaycastShared(a_v3Origin, glm::normalize(a_v3Direction), a_fMaxDistance, a_uMask, a_uIndex, a_fDistance);
+}
+void Simplex::MyEntityManager::QueryNearestConcurrent(vector3 a_v3Point, uint a_uCount, std::vector<uint>& a_lEntities, uint a_uMask)
+{
+	static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->QueryNearestShared(a_v3Point, a_uCount, a_uMask, a_lEntities);
+}
+void Simplex::MyEntityManager::SetOctreeLevels(uint a_uLevels)
+{
+	MyOctreeBroadphase* pOctree = static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE]);
+	pOctree->SetMaxLevel(a_uLevels);
+
+	//build it right away so it can be displayed even when another broadphase is in use
+	GatherBounds();
+	pOctree->SetFilters(m_lCategory, m_lMask);
+	pOctree->Update(m_lMinGlobal, m_lMaxGlobal);
+}
+void Simplex::MyEntityManager::SetOctreeIdealCount(uint a_uIdealCount)
+{
+	MyOctreeBroadphase* pOctree = static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE]);
+	pOctree->SetIdealEntityCount(a_uIdealCount);
+
+	GatherBounds();
+	pOctree->SetFilters(m_lCategory, m_lMask);
+	pOctree->Update(m_lMinGlobal, m_lMaxGlobal);
+}
+uint Simplex::MyEntityManager::GetOctreeLevels(void)
+{
+	return static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->GetMaxLevel();
+}
+uint Simplex::MyEntityManager::GetOctreeIdealCount(void)
+{
+	return static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->GetIdealEntityCount();
+}
+void Simplex::MyEntityManager::SetOctreeBuildBudget(float a_fBudget)
+{
+	static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->SetBuildBudget(a_fBudget);
+}
+float Simplex::MyEntityManager::GetOctreeBuildBudget(void)
+{
+	return static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->GetBuildBudget();
+}
+float Simplex::MyEntityManager::GetOctreeBuildProgress(void)
+{
+	return static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->GetBuildProgress();
+}
+void Simplex::MyEntityManager::SetOctreeAutoTune(bool a_bAutoTune)
+{
+	if (a_bAutoTune && !m_bOctreeAutoTune)
+		m_uTuneEntityCount = 0;
+	m_bOctreeAutoTune = a_bAutoTune;
+}
+bool Simplex::MyEntityManager::GetOctreeAutoTune(void) { return m_bOctreeAutoTune; }
+void Simplex::MyEntityManager::TuneOctree(void) { m_uTuneEntityCount = 0; }
+std::vector<Simplex::MyOctreeTrial> const& Simplex::MyEntityManager::GetOctreeTrials(void) { return m_lOctreeTrial; }
+bool Simplex::MyEntityManager::IsOctreeTuneStale(void)
+{
+	if (m_uEntityCount == 0)
+		return false;
+	if (m_uTuneEntityCount == 0)
+		return true;
+
+	float fCountChange = std::abs(static_cast<float>(m_uEntityCount) - m_uTuneEntityCount) / m_uTuneEntityCount;
+	if (fCountChange > TUNE_COUNT_CHANGE)
+		return true;
+
+	//a scene spreading out or gathering in changes how many entities share each octant
+	float fSpread = GetSceneSpread();
+	return m_fTuneSpread > 0.0f && std::abs(fSpread - m_fTuneSpread) / m_fTuneSpread > TUNE_SPREAD_CHANGE;
+}
+void Simplex::MyEntityManager::StepOctreeTuner(void)
+{
+	MY_PROFILE_ZONE("TuneOctree");
+	MyOctreeBroadphase* pOctree = static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE]);
+	if (m_pOctreeTuner == nullptr)
+	{
+		if (!IsOctreeTuneStale())
+			return;
+		//the scene the tuning starts on is the one it is tuned for, TuneOctree during it tunes again afterwards
+		m_pOctreeTuner = new MyOctreeTuner(m_lMinGlobal, m_lMaxGlobal, pOctree->GetMaxLevel(), pOctree->GetIdealEntityCount());
+		m_uTuneEntityCount = m_uEntityCount;
+		m_fTuneSpread = GetSceneSpread();
+	}
+
+	//the tuner shares the budget of the sliced rebuilds, a worker rebuild leaves the update its own share
+	float fBudget = pOctree->GetBuildBudget() > 0.0f ? pOctree->GetBuildBudget() : TUNE_BUDGET;
+	if (!m_pOctreeTuner->Step(fBudget))
+		return;
+
+	//the winner is set like any other settings change, the octree rebuilds on the worker or within the budget
+	m_lOctreeTrial = m_pOctreeTuner->GetTrials();
+	SafeDelete(m_pOctreeTuner);
+	MyOctreeTrial const& best = m_lOctreeTrial.front();
+	pOctree->SetMaxLevel(best.uLevels);
+	pOctree->SetIdealEntityCount(best.uIdealCount);
+	pOctree->SetFilters(m_lCategory, m_lMask);
+	pOctree->Update(m_lMinGlobal, m_lMaxGlobal);
+	MY_PROFILE_COUNTER("Octree levels", best.uLevels);
+	MY_PROFILE_COUNTER("Octree ideal count", best.uIdealCount);
+}
+float Simplex::MyEntityManager::GetSceneSpread(void)
+{
+	if (m_lMinGlobal.empty())
+		return 0.0f;
+
+	vector3 v3Min = m_lMinGlobal[0];
+	vector3 v3Max = m_lMaxGlobal[0];
+	for (uint i = 1; i < m_lMinGlobal.size(); i++)
+	{
+		v3Min = glm::min(v3Min, m_lMinGlobal[i]);
+		v3Max = glm::max(v3Max, m_lMaxGlobal[i]);
+	}
+	return glm::length(v3Max - v3Min);
+}
+Simplex::MyOctant* Simplex::MyEntityManager::GetOctree(void)
+{
+	return static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE])->GetOctree();
+}
 void Simplex::MyEntityManager::AddEntity(String a_sFileName, String a_sUniqueID)
 {
 	//Create a temporal entity to store the object
@@ -208,6 +1099,7 @@ void Simplex::MyEntityManager::AddEntity(String a_sFileName, String a_sUniqueID)
 		m_mEntityArray = tempArray;
 		//add one entity to the count
 		++m_uEntityCount;
+		m_bReindexed = true;
 	}
 }
 void Simplex::MyEntityManager::RemoveEntity(uint a_uIndex)
@@ -220,11 +1112,16 @@ void Simplex::MyEntityManager::RemoveEntity(uint a_uIndex)
 	if (a_uIndex >= m_uEntityCount)
 		a_uIndex = m_uEntityCount - 1;
 
+	//the body of the last entity follows it to its new index
+	m_pMotion->Resize(m_uEntityCount);
+	m_pMotion->RemoveEntity(a_uIndex);
+
 	// if the entity is not the very last we swap it for the last one
 	if (a_uIndex != m_uEntityCount - 1)
 	{
 		std::swap(m_mEntityArray[a_uIndex], m_mEntityArray[m_uEntityCount - 1]);
 	}
+	RetireEntity(m_mEntityArray[m_uEntityCount - 1]);
 	
 	//and then pop the last one
 	//create a new temp array with one less entry
@@ -243,6 +1140,243 @@ void Simplex::MyEntityManager::RemoveEntity(uint a_uIndex)
 	m_mEntityArray = tempArray;
 	//add one entity to the count
 	--m_uEntityCount;
+	m_bReindexed = true;
+}
+void Simplex::MyEntityManager::QueueSpawn(String a_sFileName, String a_sUniqueID, matrix4 a_m4ToWorld)
+{
+	//the model is loaded here, with the OpenGL context, the entity is made when the command is applied
+	Model* pModel = new Model();
+	MyObjBounds bounds;
+	MyObjFile::LoadModel(pModel, a_sFileName, &bounds);
+	if (pModel->GetName() == "")
+	{
+		SafeDelete(pModel);
+		return;
+	}
+
+	MyCommand command;
+	command.eType = CMD_SPAWN;
+	command.sUniqueID = a_sUniqueID;
+	command.m4ToWorld = a_m4ToWorld;
+	command.sFileName = a_sFileName;
+	command.pModel = pModel;
+	if (bounds.bValid)
+	{
+		command.v3MinL = bounds.v3Min;
+		command.v3MaxL = bounds.v3Max;
+	}
+	else
+	{
+		MyRigidBody rigidBody(pModel->GetVertexList());
+		command.v3MinL = rigidBody.GetMinLocal();
+		command.v3MaxL = rigidBody.GetMaxLocal();
+	}
+	m_pCommandQueue->Push(command);
+}
+void Simplex::MyEntityManager::QueueSpawnAsync(String a_sFileName, String a_sUniqueID, matrix4 a_m4ToWorld, vector3 a_v3HalfSize)
+{
+	MyAsset* pAsset = m_pAssetLoader->Request(a_sFileName);
+	if (pAsset->eState == AS_FAILED)
+		return;
+
+	MyCommand command;
+	command.eType = CMD_SPAWN;
+	command.sUniqueID = a_sUniqueID;
+	command.m4ToWorld = a_m4ToWorld;
+	command.sFileName = a_sFileName;
+	if (pAsset->eState == AS_READY)
+	{
+		command.pModel = pAsset->pModel;
+		command.v3MinL = pAsset->v3MinL;
+		command.v3MaxL = pAsset->v3MaxL;
+	}
+	else
+	{
+		command.pAsset = pAsset;
+		command.v3MinL = -a_v3HalfSize;
+		command.v3MaxL = a_v3HalfSize;
+	}
+	m_pCommandQueue->Push(command);
+}
+uint Simplex::MyEntityManager::FinalizeAssets(float a_fBudget)
+{
+	if (m_pAssetLoader->GetLoadingCount() > 0)
+		m_pAssetLoader->Finalize(a_fBudget);
+	m_pAssetLoader->TakeLanded(m_lLanded);
+	return static_cast<uint>(m_lLanded.size());
+}
+void Simplex::MyEntityManager::AttachAssets(void)
+{
+	MY_PROFILE_ZONE("AttachAssets");
+	//the spawns applied before a model landed stand in with a box, the ones applied after got the model already
+	for (uint i = 0; i < m_lLoading.size();)
+	{
+		MyEntity* pEntity = m_lLoading[i].first;
+		MyAsset* pAsset = m_lLoading[i].second;
+		if (pAsset->eState != AS_READY && pAsset->eState != AS_FAILED)
+		{
+			++i;
+			continue;
+		}
+
+		if (pAsset->eState == AS_READY)
+			pEntity->SetModel(pAsset->pModel, pAsset->v3MinL, pAsset->v3MaxL);
+		else
+			QueueDespawn(pEntity->GetUniqueID());
+		m_lLoading[i] = m_lLoading.back();
+		m_lLoading.pop_back();
+	}
+	m_lLanded.clear();
+}
+MyEpoch* Simplex::MyEntityManager::GetEntityEpoch(void)
+{
+	return m_pEntityEpoch;
+}
+uint Simplex::MyEntityManager::GetLoadingAssetCount(void)
+{
+	return m_pAssetLoader->GetLoadingCount();
+}
+void Simplex::MyEntityManager::QueueDespawn(String a_sUniqueID)
+{
+	MyCommand command;
+	command.eType = CMD_DESPAWN;
+	command.sUniqueID = a_sUniqueID;
+	m_pCommandQueue->Push(command);
+}
+void Simplex::MyEntityManager::QueueModelMatrix(matrix4 a_m4ToWorld, String a_sUniqueID)
+{
+	MyCommand command;
+	command.eType = CMD_TRANSFORM;
+	command.sUniqueID = a_sUniqueID;
+	command.m4ToWorld = a_m4ToWorld;
+	m_pCommandQueue->Push(command);
+}
+bool Simplex::MyEntityManager::SaveSnapshot(String a_sFileName)
+{
+	MY_PROFILE_ZONE("SaveSnapshot");
+	//bring the octree up to date with the entities so the saved tree holds every one of them
+	MyOctreeBroadphase* pOctree = static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE]);
+	GatherBounds();
+	pOctree->SetFilters(m_lCategory, m_lMask);
+	pOctree->Update(m_lMinGlobal, m_lMaxGlobal);
+
+	MySceneData data;
+	std::unordered_map<String, uint> modelMap;
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		MyEntity* pEntity = m_mEntityArray[i];
+		MyRigidBody* pRigidBody = pEntity->GetRigidBody();
+		auto model = modelMap.emplace(pEntity->GetFileName(), static_cast<uint>(data.lModelName.size()));
+		if (model.second)
+			data.lModelName.push_back(pEntity->GetFileName());
+		data.lModelIndex.push_back(model.first->second);
+		data.lUniqueID.push_back(pEntity->GetUniqueID());
+		data.lMatrix.push_back(pEntity->GetModelMatrix());
+		data.lLocalMin.push_back(pRigidBody->GetMinLocal());
+		data.lLocalMax.push_back(pRigidBody->GetMaxLocal());
+		data.lFilter.push_back(pEntity->GetCategory());
+		data.lFilter.push_back(pEntity->GetCollisionMask());
+		data.lFlag.push_back(pEntity->IsStatic() ? SF_STATIC : 0);
+	}
+
+	MyOctant* pRoot = pOctree->GetOctree();
+	if (pRoot != nullptr)
+	{
+		pRoot->GetRecordList(data.lOctant, data.lOctantEntity);
+		data.uOctreeIDCount = pRoot->GetOctantCount();
+		data.uOctreeMaxLevel = pOctree->GetMaxLevel();
+		data.uOctreeIdealCount = pOctree->GetIdealEntityCount();
+	}
+	return MySceneFile::Save(a_sFileName, data);
+}
+bool Simplex::MyEntityManager::LoadSnapshot(String a_sFileName)
+{
+	MY_PROFILE_ZONE("LoadSnapshot");
+	MySceneFile file;
+	if (!file.Open(a_sFileName))
+		return false;
+
+	//each model is parsed once, the entities using it share it like a copied entity does; one that fails to load
+	//fails the snapshot, the indices of the saved octree would be off without its entities
+	std::vector<String> const& lModelName = file.GetModelNameList();
+	std::vector<Model*> lModel;
+	lModel.reserve(lModelName.size());
+	bool bLoaded = true;
+	for (uint i = 0; i < lModelName.size() && bLoaded; i++)
+	{
+		lModel.push_back(new Model());
+		bLoaded = MyObjFile::LoadModel(lModel.back(), lModelName[i]) != "";
+	}
+	if (!bLoaded)
+	{
+		for (Model* pModel : lModel)
+		{
+			SafeDelete(pModel);
+		}
+		return false;
+	}
+
+	uint uCount = file.GetEntityCount();
+	char const* pUniqueID = file.GetUniqueIDList();
+	uint const* pModelIndex = file.GetModelIndexList();
+	matrix4 const* pMatrix = file.GetMatrixList();
+	uint const* pFilter = file.GetFilterList();
+	uint const* pFlag = file.GetFlagList();
+	vector3 const* pMinLocal = nullptr;
+	vector3 const* pMaxLocal = nullptr;
+	file.GetLocalBoundsList(pMinLocal, pMaxLocal);
+
+	std::vector<MyEntity*> lEntity;
+	lEntity.reserve(uCount);
+	for (uint i = 0; i < uCount && bLoaded; i++)
+	{
+		String sUniqueID = pUniqueID;
+		pUniqueID += sUniqueID.size() + 1;
+		MyEntity* pEntity = new MyEntity(lModel[pModelIndex[i]], lModelName[pModelIndex[i]], pMinLocal[i], pMaxLocal[i], sUniqueID);
+		bLoaded = pEntity->IsInitialized();
+		pEntity->SetModelMatrix(pMatrix[i]);
+		pEntity->SetCollisionFilter(pFilter[2 * i], pFilter[2 * i + 1]);
+		pEntity->SetStatic((pFlag[i] & SF_STATIC) != 0);
+		lEntity.push_back(pEntity);
+	}
+	if (!bLoaded)
+	{
+		//the entities do not release their models, the ones made here go with them
+		for (MyEntity* pEntity : lEntity)
+		{
+			SafeDelete(pEntity);
+		}
+		for (Model* pModel : lModel)
+		{
+			SafeDelete(pModel);
+		}
+		return false;
+	}
+
+	//the saved octree indexes the entities from 0, it only fits a list that starts with them
+	bool bEmpty = m_uEntityCount == 0;
+	AppendEntities(lEntity);
+	if (!bEmpty || !file.HasOctree())
+		return true;
+
+	uint uMaxLevel = 0;
+	uint uIdealCount = 0;
+	file.GetOctreeSettings(uMaxLevel, uIdealCount);
+	MyOctreeBroadphase* pOctree = static_cast<MyOctreeBroadphase*>(m_pBroadphase[BP_OCTREE]);
+	pOctree->SetMaxLevel(uMaxLevel);
+	pOctree->SetIdealEntityCount(uIdealCount);
+	GatherBounds();
+	pOctree->SetFilters(m_lCategory, m_lMask);
+	pOctree->LoadTree(file.LoadOctree(), m_lMinGlobal, m_lMaxGlobal);
+
+	//with the octree in use the next update carries on with the loaded tree instead of building it again
+	MY_BROADPHASE eStrategy = m_eBroadphase == BP_ADAPTIVE ? m_eAdaptiveStrategy : m_eBroadphase;
+	if (eStrategy == BP_OCTREE)
+	{
+		m_eStrategy = BP_OCTREE;
+		m_bFilterChanged = false;
+	}
+	return true;
 }
 void Simplex::MyEntityManager::RemoveEntity(String a_sUniqueID)
 {
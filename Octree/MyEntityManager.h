@@ -3,12 +3,53 @@ Programmer: Alberto Bobadilla (labigm@gmail.com)
 Date: 2017/07
 ----------------------------------------------*/
 #ifndef __MYENTITYMANAGER_H_
-#define __MyENTITYMANAGER_H_
+#define __MYENTITYMANAGER_H_
 
 #include "MyEntity.h"
+#include "MyOctreeBroadphase.h"
+#include "MySpatialHashGrid.h"
+#include "MySweepAndPrune.h"
+#include "MyDynamicAABBTree.h"
+#include "MyPairCache.h"
+#include "MyMotionSystem.h"
+#include "MyCommandQueue.h"
+#include "MyAssetLoader.h"
 
 namespace Simplex
 {
+	class MyOctreeTuner;
+
+	//Counters of the collision pipeline on the last update
+	struct MyCollisionStats
+	{
+		static constexpr uint LEAF_BUCKETS = 6; //leaves holding 1, 2-3, 4-7, 8-15, 16-31 and 32 or more entities
+
+		uint uEntityCount = 0;
+		uint uActiveCount = 0; //entities whose pairs were processed
+		MyBroadphaseStats Broadphase; //work of the structure, plus the pairs the manager dropped from its queries
+		unsigned long long uSpatialCulled = 0; //pairs the structure never put side by side, i.e. sharing no leaf or cell;
+			//a lower bound when entities straddle leaves, only counted when the structure lists every pair
+		uint uPairsReported = 0; //pairs handed to the pair cache
+		uint uNarrowphaseTests = 0; //box tests between the rigid bodies
+		uint uCachedResults = 0; //pairs that reused the result of an earlier test
+		uint uContacts = 0; //processed pairs found colliding
+		uint uLeafCount = 0; //leaves of the octree holding entities, 0 with another broadphase
+		uint lLeafHistogram[LEAF_BUCKETS] = {}; //leaves by entity count, see LEAF_BUCKETS
+		float fDuplication = 0.0f; //leaves per entity held by the octree, above 1 when entities straddle octants
+		uint uSplitOctants = 0; //octants the cost model split
+		uint uKeptOctants = 0; //octants over the ideal count the cost model kept whole
+		float fSplitSaving = 0.0f; //pair tests the splits were expected to save
+	};
+
+	//Cost of one octree configuration measured by the tuner
+	struct MyOctreeTrial
+	{
+		uint uLevels = 0; //maximum level of subdivision
+		uint uIdealCount = 0; //entities per octant before it subdivides
+		float fBuildTime = 0.0f; //milliseconds to build the tree, best of the rounds
+		float fQueryTime = 0.0f; //milliseconds to list the pairs, best of the rounds
+		uint uLeafCount = 0; //leaves holding entities
+	};
 
 	//System Class
 	class MyEntityManager
@@ -17,6 +58,59 @@ namespace Simplex
 		uint m_uEntityCount = 0; //number of elements in the list
 		PEntity* m_mEntityArray = nullptr; //array of MyEntity pointers
 		static MyEntityManager* m_pInstance; // Singleton pointer
+
+		static constexpr uint ADAPTIVE_WINDOW = 8; //updates timed per strategy by the adaptive mode
+		static constexpr uint ADAPTIVE_PERIOD = 600; //updates before the adaptive mode times the strategies again
+
+		MY_BROADPHASE m_eBroadphase = BP_OCTREE; //broadphase mode selected
+		MY_BROADPHASE m_eStrategy = BP_COUNT; //structure that ran the last update, BP_COUNT before the first one
+		MyBroadphase* m_pBroadphase[BP_ADAPTIVE]; //one structure per strategy, indexed by MY_BROADPHASE
+		float m_fBroadphaseTime = 0.0f; //milliseconds spent by the broadphase on the last update
+
+		uint m_uAdaptiveMask = (1 << BP_ADAPTIVE) - 1; //strategies the adaptive mode chooses from, one bit per MY_BROADPHASE
+		uint m_uAdaptiveTrial = BP_ADAPTIVE; //strategy being timed, BP_ADAPTIVE once the choice is made
+		uint m_uAdaptiveFrame = 0; //updates since the trial started or since the choice was made
+		uint m_uAdaptiveEntityCount = 0; //entity count when the strategies were timed
+		MY_BROADPHASE m_eAdaptiveStrategy = BP_OCTREE; //strategy the adaptive mode is running
+		float m_fAdaptiveTime[BP_ADAPTIVE]; //milliseconds accumulated by each strategy during its trial
+
+		static constexpr float TUNE_BUDGET = 1000.0f; //microseconds per update the tuner spends when the rebuilds run on the worker
+		static constexpr float TUNE_COUNT_CHANGE = 0.25f; //relative change in the entity count that tunes the octree again
+		static constexpr float TUNE_SPREAD_CHANGE = 0.5f; //relative change in the size of the scene that tunes the octree again
+		bool m_bOctreeAutoTune = false; //does the tuner pick the octree settings?
+		uint m_uTuneEntityCount = 0; //entity count when the octree was tuned, 0 tunes it on the next update
+		float m_fTuneSpread = 0.0f; //diagonal of the scene when the octree was tuned
+		std::vector<MyOctreeTrial> m_lOctreeTrial; //configurations measured by the last tuning, cheapest first
+		MyOctreeTuner* m_pOctreeTuner = nullptr; //tuning in progress, nullptr between tunings
+
+		std::vector<vector3> m_lMinGlobal; //global minimum of every entity, gathered every update
+		std::vector<vector3> m_lMaxGlobal; //global maximum of every entity, gathered every update
+		std::vector<uint> m_lCategory; //collision layers of every entity, gathered every update
+		std::vector<uint> m_lMask; //collision layers every entity collides with, gathered every update
+		bool m_bFilterChanged = true; //did a filter change since the broadphase in use last received them?
+		MyPairList m_lPairList; //pairs reported by the broadphase on the last update
+		std::vector<char> m_lMoved; //did the bounds of each entity change since the pair cache last saw them?
+
+		static constexpr uint SLEEP_DELAY = 30; //updates without moving before an entity falls asleep
+		std::vector<uint> m_lIdleFrames; //updates since each entity last moved, saturates at SLEEP_DELAY
+		std::vector<char> m_lActive; //are the pairs of each entity processed on this update?
+		std::vector<uint> m_lActiveList; //indices of the active entities
+		std::vector<uint> m_lQueryList; //scratch list for the broadphase box queries
+
+		MyPairCache* m_pPairCache = nullptr; //broadphase pairs of the last update with their narrowphase result
+		static constexpr float MOTION_STEP = 1.0f / 60.0f; //seconds the bodies advance on every update
+		MyMotionSystem* m_pMotion = nullptr; //position, velocity and mass of the moving entities
+		MyCommandQueue* m_pCommandQueue = nullptr; //edits pushed from any thread, applied at the start of the next update
+		MyEpoch* m_pEntityEpoch = nullptr; //removed entities wait here until no published snapshot can point at them
+		MyAssetLoader* m_pAssetLoader = nullptr; //models read on workers for QueueSpawnAsync, render thread only
+		std::vector<MyAsset*> m_lLanded; //assets taken from the loader, waiting for AttachAssets
+		std::vector<std::pair<MyEntity*, MyAsset*>> m_lLoading; //entities standing in with a box and the model they wait for
+		MyCommandList m_lCommand; //commands taken on this update
+		std::vector<std::pair<uint, uint>> m_lEdit; //entity and command of the transforms, in the order they were pushed
+		bool m_bReindexed = true; //were entities added or removed since the pair cache was last cleared? their indices shifted
+		MyEventList m_lEventList; //begin, stay and end events of the last update
+		uint m_uNarrowphaseCount = 0; //pairs tested by the narrowphase on the last update
+		MyCollisionStats m_Stats; //counters of the last update
 	public:
 		/*
 		Usage: Gets the singleton pointer
@@ -57,6 +151,86 @@ namespace Simplex
 		*/
 		void RemoveEntity(String a_sUniqueID);
 		/*
+		USAGE: Loads a model and asks for an entity of it to be added on the next update, the spawns of an update are
+		added together with a single reallocation of the list; the entity takes its unique ID then, after the
+		despawns pushed before it. Loading the model needs the OpenGL context so, like AddEntity, it is meant for the
+		render thread while despawns and transforms can come from any thread
+		ARGUMENTS:
+		-	String a_sFileName -> Name of the model to load
+		-	String a_sUniqueID -> Name wanted as identifier, if not available will generate one
+		-	matrix4 a_m4ToWorld = IDENTITY_M4 -> model matrix to place it with
+		OUTPUT: ---
+		*/
+		void QueueSpawn(String a_sFileName, String a_sUniqueID, matrix4 a_m4ToWorld = IDENTITY_M4);
+		/*
+		USAGE: Like QueueSpawn but the model is read on a worker, from the render thread; until it lands the entity
+		collides and is drawn as a box, and once FinalizeAssets makes it AttachAssets gives it to the entity. An
+		entity whose model fails to load is despawned. A model that already landed is shared right away
+		ARGUMENTS:
+		-	String a_sFileName -> Name of the model to load
+		-	String a_sUniqueID -> Name wanted as identifier, if not available will generate one
+		-	matrix4 a_m4ToWorld = IDENTITY_M4 -> model matrix to place it with
+		-	vector3 a_v3HalfSize = vector3(0.5f) -> half the size of the box standing in for the model
+		OUTPUT: ---
+		*/
+		void QueueSpawnAsync(String a_sFileName, String a_sUniqueID, matrix4 a_m4ToWorld = IDENTITY_M4, vector3 a_v3HalfSize = vector3(0.5f));
+		/*
+		USAGE: Makes the textures and meshes of the models read by the workers, from the render thread, which
+		holds the OpenGL context; one texture or model is made even if the time runs out
+		ARGUMENTS: float a_fBudget -> microseconds to spend
+		OUTPUT: models landed that wait for AttachAssets
+		*/
+		uint FinalizeAssets(float a_fBudget);
+		/*
+		USAGE: Gives the models that landed to the entities waiting for them, from the render thread while it holds
+		the lock of the thread that updates the manager
+		ARGUMENTS: ---
+		OUTPUT: ---
+		*/
+		void AttachAssets(void);
+		/*
+		USAGE: Gets the number of models asked for by QueueSpawnAsync that have not landed
+		ARGUMENTS: ---
+		OUTPUT: models loading
+		*/
+		uint GetLoadingAssetCount(void);
+		/*
+		USAGE: Gets the epoch the removed entities are retired to, the thread drawing a snapshot stays inside it
+		while it reads the entities of the snapshot so they are not deleted under it
+		ARGUMENTS: ---
+		OUTPUT: epoch of the entities
+		*/
+		MyEpoch* GetEntityEpoch(void);
+		/*
+		USAGE: Asks for an entity to be removed on the next update, safe from any thread
+		ARGUMENTS: String a_sUniqueID -> Unique Identifier
+		OUTPUT: ---
+		*/
+		void QueueDespawn(String a_sUniqueID);
+		/*
+		USAGE: Asks for the model matrix of an entity to be set on the next update, safe from any thread; only the
+		last one asked for an entity is applied
+		ARGUMENTS:
+		-	matrix4 a_m4ToWorld -> model matrix to set
+		-	String a_sUniqueID -> Unique Identifier
+		OUTPUT: ---
+		*/
+		void QueueModelMatrix(matrix4 a_m4ToWorld, String a_sUniqueID);
+		/*
+		USAGE: Writes the entities and the octree built around them to a binary snapshot that LoadSnapshot reads
+		back without parsing the models or building the tree; the bodies and velocities are not saved
+		ARGUMENTS: String a_sFileName -> file to write
+		OUTPUT: was it written?
+		*/
+		bool SaveSnapshot(String a_sFileName);
+		/*
+		USAGE: Adds the entities of a snapshot, every model is loaded once and shared by the entities that use it;
+		when the list was empty the saved octree and its settings are taken over instead of building one
+		ARGUMENTS: String a_sFileName -> file to read
+		OUTPUT: was it a valid snapshot? nothing is added otherwise
+		*/
+		bool LoadSnapshot(String a_sFileName);
+		/*
 		USAGE: Gets the uniqueID name of the entity indexed
 		ARGUMENTS: uint a_uIndex = -1 -> index of the queried entry, if < 0 asks for the last one added
 		OUTPUT: UniqueID of the entity, if the list is empty will return blank
@@ -75,6 +249,318 @@ namespace Simplex
 		*/
 		void Update(void);
 		/*
+		USAGE: Selects the structure used by Update to find the pairs to test
+		ARGUMENTS: MY_BROADPHASE a_eBroadphase -> broadphase to use
+		OUTPUT: ---
+		*/
+		void SetBroadphase(MY_BROADPHASE a_eBroadphase);
+		/*
+		USAGE: Gets the structure used by Update to find the pairs to test
+		ARGUMENTS: ---
+		OUTPUT: broadphase in use
+		*/
+		MY_BROADPHASE GetBroadphase(void);
+		/*
+		USAGE: Gets a readable name of the broadphase in use
+		ARGUMENTS: ---
+		OUTPUT: name of the broadphase
+		*/
+		String GetBroadphaseName(void);
+		/*
+		USAGE: Declares the entity as static, static entities never fall asleep and are only processed when moved
+		ARGUMENTS:
+		-	bool a_bStatic -> is it static?
+		-	uint a_uIndex = -1 -> index in the list of entities; if less than 0 it will add it to the last in the list
+		OUTPUT: ---
+		*/
+		void SetStatic(bool a_bStatic, uint a_uIndex = -1);
+		/*
+		USAGE: Declares the entity as static, static entities never fall asleep and are only processed when moved
+		ARGUMENTS:
+		-	bool a_bStatic -> is it static?
+		-	String a_sUniqueID -> id of the queried entity
+		OUTPUT: ---
+		*/
+		void SetStatic(bool a_bStatic, String a_sUniqueID);
+		/*
+		USAGE: Sets the collision layers of the entity, pairs whose layers ignore each other are rejected by the
+		broadphase before their bounds are tested
+		ARGUMENTS:
+		-	uint a_uCategory -> layers the entity belongs to, one bit per layer
+		-	uint a_uMask -> layers the entity collides with
+		-	uint a_uIndex = -1 -> index in the list of entities; if less than 0 it will add it to the last in the list
+		OUTPUT: ---
+		*/
+		void SetCollisionFilter(uint a_uCategory, uint a_uMask, uint a_uIndex = -1);
+		/*
+		USAGE: Sets the collision layers of the entity, pairs whose layers ignore each other are rejected by the
+		broadphase before their bounds are tested
+		ARGUMENTS:
+		-	uint a_uCategory -> layers the entity belongs to, one bit per layer
+		-	uint a_uMask -> layers the entity collides with
+		-	String a_sUniqueID -> id of the queried entity
+		OUTPUT: ---
+		*/
+		void SetCollisionFilter(uint a_uCategory, uint a_uMask, String a_sUniqueID);
+		/*
+		USAGE: Gets the motion state of the entity as of the last update
+		ARGUMENTS: uint a_uIndex -> index in the list of entities
+		OUTPUT: motion state
+		*/
+		MY_MOTION_STATE GetMotionState(uint a_uIndex);
+		/*
+		USAGE: Gives the entity a body that moves on every update and is pushed by its contacts, or changes the
+		velocity and mass of the one it has
+		ARGUMENTS:
+		-	vector3 a_v3Velocity -> velocity in units per second
+		-	float a_fMass = 1.0f -> mass, 0 or less for a body that moves but nothing can push
+		-	uint a_uIndex = -1 -> index in the list of entities; if less than 0 it will add it to the last in the list
+		OUTPUT: ---
+		*/
+		void AddBody(vector3 a_v3Velocity, float a_fMass = 1.0f, uint a_uIndex = -1);
+		/*
+		USAGE: Stops the entity, it keeps its place and is only a wall for the bodies from now on
+		ARGUMENTS: uint a_uIndex = -1 -> index in the list of entities; if less than 0 it will add it to the last in the list
+		OUTPUT: ---
+		*/
+		void RemoveBody(uint a_uIndex = -1);
+		/*
+		USAGE: Gets the number of entities with a body
+		ARGUMENTS: ---
+		OUTPUT: body count
+		*/
+		uint GetBodyCount(void);
+		/*
+		USAGE: Sets the velocity of the body of the entity, entities without a body are ignored
+		ARGUMENTS:
+		-	vector3 a_v3Velocity -> velocity in units per second
+		-	uint a_uIndex = -1 -> index in the list of entities; if less than 0 it will add it to the last in the list
+		OUTPUT: ---
+		*/
+		void SetVelocity(vector3 a_v3Velocity, uint a_uIndex = -1);
+		/*
+		USAGE: Gets the velocity of the body of the entity
+		ARGUMENTS: uint a_uIndex = -1 -> index in the list of entities; if less than 0 it will add it to the last in the list
+		OUTPUT: velocity, zero for entities without a body
+		*/
+		vector3 GetVelocity(uint a_uIndex = -1);
+		/*
+		USAGE: Adds a force to the body of the entity for the next update, entities without a body are ignored
+		ARGUMENTS:
+		-	vector3 a_v3Force -> force to apply
+		-	uint a_uIndex = -1 -> index in the list of entities; if less than 0 it will add it to the last in the list
+		OUTPUT: ---
+		*/
+		void ApplyForce(vector3 a_v3Force, uint a_uIndex = -1);
+		/*
+		USAGE: Sets the acceleration applied to every body with mass
+		ARGUMENTS: vector3 a_v3Gravity -> acceleration
+		OUTPUT: ---
+		*/
+		void SetGravity(vector3 a_v3Gravity);
+		/*
+		USAGE: Sets the box the bodies bounce inside of
+		ARGUMENTS:
+		-	vector3 a_v3Min -> minimum corner
+		-	vector3 a_v3Max -> maximum corner
+		OUTPUT: ---
+		*/
+		void SetWorldBounds(vector3 a_v3Min, vector3 a_v3Max);
+		/*
+		USAGE: Gets the time the bodies advance on every update
+		ARGUMENTS: ---
+		OUTPUT: seconds per update
+		*/
+		float GetTimeStep(void);
+		/*
+		USAGE: Gets the number of entities whose pairs were processed on the last update
+		ARGUMENTS: ---
+		OUTPUT: active entity count
+		*/
+		uint GetActiveCount(void);
+		/*
+		USAGE: Gets the begin, stay and end events of the last update, pairs between sleeping or static entities
+		report no stay events; when entities are added or removed the cache is flushed and its end events, which
+		use the indices from before the change, come first
+		ARGUMENTS: ---
+		OUTPUT: event list
+		*/
+		MyEventList const& GetCollisionEvents(void);
+		/*
+		USAGE: Gets the number of pairs kept by the pair cache
+		ARGUMENTS: ---
+		OUTPUT: pair count
+		*/
+		uint GetCachedPairCount(void);
+		/*
+		USAGE: Gets the number of pairs the narrowphase tested on the last update, the rest reused their cached result
+		ARGUMENTS: ---
+		OUTPUT: pair count
+		*/
+		uint GetNarrowphaseCount(void);
+		/*
+		USAGE: Gets the counters of the last update: candidate pairs, pairs culled by layers or by sharing no leaf,
+		box tests, contacts and the shape of the octree when it is in use
+		ARGUMENTS: ---
+		OUTPUT: counters
+		*/
+		MyCollisionStats const& GetCollisionStats(void);
+		/*
+		USAGE: Measures the memory held by the structure that ran the last update, by category
+		ARGUMENTS: MyMemoryReport& a_Report -> report to fill, left empty before the first update
+		OUTPUT: ---
+		*/
+		void GetMemoryReport(MyMemoryReport& a_Report);
+		/*
+		USAGE: Selects the strategies the adaptive mode times, changing them starts a new warm-up
+		ARGUMENTS: uint a_uMask -> one bit per MY_BROADPHASE (1 << BP_HASHGRID | ...)
+		OUTPUT: ---
+		*/
+		void SetAdaptiveStrategies(uint a_uMask);
+		/*
+		USAGE: Gets the structure that ran the last update, resolves the adaptive mode to its current choice
+		ARGUMENTS: ---
+		OUTPUT: strategy, BP_COUNT if there has not been an update
+		*/
+		MY_BROADPHASE GetActiveStrategy(void);
+		/*
+		USAGE: Appends every entity whose bounds overlap the box, using the structure of the last update
+		ARGUMENTS:
+		-	vector3 a_v3Min -> minimum of the box in global space
+		-	vector3 a_v3Max -> maximum of the box in global space
+		-	std::vector<uint>& a_lEntities -> list to append the entity indices to
+		-	uint a_uMask = 0xFFFFFFFF -> layers to report
+		OUTPUT: ---
+		*/
+		void QueryAABB(vector3 a_v3Min, vector3 a_v3Max, std::vector<uint>& a_lEntities, uint a_uMask = 0xFFFFFFFF);
+		/*
+		USAGE: Finds the closest entity whose bounds are hit by the ray, using the structure of the last update
+		ARGUMENTS:
+		-	vector3 a_v3Origin -> origin of the ray
+		-	vector3 a_v3Direction -> direction of the ray
+		-	float a_fMaxDistance -> length of the ray
+		-	uint& a_uIndex -> index of the entity hit
+		-	float& a_fDistance -> distance along the ray to the hit
+		-	uint a_uMask = 0xFFFFFFFF -> layers the ray can hit
+		OUTPUT: was anything hit?
+		*/
+		bool Raycast(vector3 a_v3Origin, vector3 a_v3Direction, float a_fMaxDistance, uint& a_uIndex, float& a_fDistance, uint a_uMask = 0xFFFFFFFF);
+		/*
+		USAGE: Lets other threads query the octree while it is updated; a read only copy of it is published after
+		every update that uses the octree, the Concurrent queries read the last one
+		ARGUMENTS: bool a_bConcurrent -> publish it?
+		OUTPUT: ---
+		*/
+		void SetConcurrentQueries(bool a_bConcurrent);
+		/*
+		USAGE: QueryAABB for any thread, it neither waits on the update nor makes the update wait; the indices are
+		the ones of the update that published the copy of the octree
+		ARGUMENTS:
+		-	vector3 a_v3Min -> minimum of the box in global space
+		-	vector3 a_v3Max -> maximum of the box in global space
+		-	std::vector<uint>& a_lEntities -> list to append the entity indices to
+		-	uint a_uMask = 0xFFFFFFFF -> layers to report
+		OUTPUT: ---
+		*/
+		void QueryAABBConcurrent(vector3 a_v3Min, vector3 a_v3Max, std::vector<uint>& a_lEntities, uint a_uMask = 0xFFFFFFFF);
+		/*
+		USAGE: Raycast for any thread, on the last copy of the octree published
+		ARGUMENTS:
+		-	vector3 a_v3Origin -> origin of the ray
+		-	vector3 a_v3Direction -> direction of the ray
+		-	float a_fMaxDistance -> length of the ray
+		-	uint& a_uIndex -> index of the entity hit
+		-	float& a_fDistance -> distance along the ray to the hit
+		-	uint a_uMask = 0xFFFFFFFF -> layers the ray can hit
+		OUTPUT: was anything hit?
+		*/
+		bool RaycastConcurrent(vector3 a_v3Origin, vector3 a_v3Direction, float a_fMaxDistance, uint& a_uIndex, float& a_fDistance, uint a_uMask = 0xFFFFFFFF);
+		/*
+		USAGE: Finds the entities closest to a point for any thread, on the last copy of the octree published
+		ARGUMENTS:
+		-	vector3 a_v3Point -> point in global space
+		-	uint a_uCount -> entities to find
+		-	std::vector<uint>& a_lEntities -> list to append the entity indices to, closest first
+		-	uint a_uMask = 0xFFFFFFFF -> layers to report
+		OUTPUT: ---
+		*/
+		void QueryNearestConcurrent(vector3 a_v3Point, uint a_uCount, std::vector<uint>& a_lEntities, uint a_uMask = 0xFFFFFFFF);
+		/*
+		USAGE: Sets the maximum level of the octree and rebuilds it around the entities
+		ARGUMENTS: uint a_uLevels -> maximum level of subdivision
+		OUTPUT: ---
+		*/
+		void SetOctreeLevels(uint a_uLevels);
+		/*
+		USAGE: Sets the number of entities an octant holds before it subdivides and rebuilds the octree
+		ARGUMENTS: uint a_uIdealCount -> ideal entity count
+		OUTPUT: ---
+		*/
+		void SetOctreeIdealCount(uint a_uIdealCount);
+		/*
+		USAGE: Gets the maximum level of the octree, set by hand or by the tuner
+		ARGUMENTS: ---
+		OUTPUT: maximum level of subdivision
+		*/
+		uint GetOctreeLevels(void);
+		/*
+		USAGE: Gets the number of entities an octant holds before it subdivides, set by hand or by the tuner
+		ARGUMENTS: ---
+		OUTPUT: ideal entity count
+		*/
+		uint GetOctreeIdealCount(void);
+		/*
+		USAGE: Sets the time each update spends rebuilding or tuning the octree, a rebuild is then spread over updates
+		on the thread that updates instead of running on a worker; the old tree serves the queries until it is done
+		ARGUMENTS: float a_fBudget -> microseconds per update, 0 to rebuild on the worker
+		OUTPUT: ---
+		*/
+		void SetOctreeBuildBudget(float a_fBudget);
+		/*
+		USAGE: Gets the time each update spends rebuilding the octree
+		ARGUMENTS: ---
+		OUTPUT: microseconds per update, 0 when the rebuilds run on the worker
+		*/
+		float GetOctreeBuildBudget(void);
+		/*
+		USAGE: Gets how far the running octree rebuild got, a rebuild on the worker stays at 0 until it is done
+		ARGUMENTS: ---
+		OUTPUT: fraction between 0 and 1, -1 if no rebuild is running
+		*/
+		float GetOctreeBuildProgress(void);
+		/*
+		USAGE: Lets the tuner pick the octree settings; it times a build and a pair query of every configuration on
+		a copy of the scene, a slice per update within the octree build budget, and tunes again when the entity
+		count or the size of the scene change a lot
+		ARGUMENTS: bool a_bAutoTune -> is the tuner on?
+		OUTPUT: ---
+		*/
+		void SetOctreeAutoTune(bool a_bAutoTune);
+		/*
+		USAGE: Asks if the tuner picks the octree settings
+		ARGUMENTS: ---
+		OUTPUT: is the tuner on?
+		*/
+		bool GetOctreeAutoTune(void);
+		/*
+		USAGE: Makes the tuner measure the configurations again, if it is on; a tuning in progress finishes first
+		ARGUMENTS: ---
+		OUTPUT: ---
+		*/
+		void TuneOctree(void);
+		/*
+		USAGE: Gets the configurations measured by the last tuning, the first one is in use
+		ARGUMENTS: ---
+		OUTPUT: trials sorted by build plus query time, empty if the tuner never ran
+		*/
+		std::vector<MyOctreeTrial> const& GetOctreeTrials(void);
+		/*
+		USAGE: Gets the root of the octree owned by the octree broadphase
+		ARGUMENTS: ---
+		OUTPUT: root octant, nullptr if it has not been built
+		*/
+		MyOctant* GetOctree(void);
+		/*
 		USAGE: Gets the model associated with this entity
 		ARGUMENTS: uint a_uIndex = -1 -> index in the list of entities; if less than 0 it will add it to the last in the list
 		OUTPUT: Model
@@ -283,6 +769,111 @@ namespace Simplex
 		Output: ---
 		*/
 		void Init(void);
+		/*
+		Usage: copies the global bounds and the collision filters of every entity into the lists of the manager, flagging
+		the entities that changed
+		Arguments: ---
+		Output: ---
+		*/
+		void GatherBounds(void);
+		/*
+		Usage: advances the bodies one step and translates their entities, dirtying only the bounds that moved
+		Arguments: ---
+		Output: ---
+		*/
+		void StepMotion(void);
+		/*
+		Usage: applies the commands queued since the last update in the order they were pushed, so a spawn can take
+		the ID of an entity despawned before it; the spawns are appended and the despawns removed in one batch
+		each, the transforms of entities despawned in the batch are dropped
+		Arguments: ---
+		Output: ---
+		*/
+		void ApplyCommands(void);
+		/*
+		Usage: makes the entity of a spawn command, it takes its unique ID here
+		Arguments: MyCommand const& a_Command -> spawn to make
+		Output: placed entity, nullptr if it could not be made or its model failed to load
+		*/
+		MyEntity* SpawnEntity(MyCommand const& a_Command);
+		/*
+		Usage: appends entities to the list with a single reallocation
+		Arguments: std::vector<MyEntity*> const& a_lEntity -> initialized entities to append
+		Output: ---
+		*/
+		void AppendEntities(std::vector<MyEntity*> const& a_lEntity);
+		/*
+		Usage: removes entities from the list with a single reallocation, the last entities take their indices
+		Arguments: std::vector<uint>& a_lIndex -> indices to remove, sorted by the call
+		Output: ---
+		*/
+		void RemoveEntities(std::vector<uint>& a_lIndex);
+		/*
+		Usage: frees the unique ID of an entity taken out of the list and hands it to the epoch, it is deleted on
+		a later update once no snapshot being drawn can point at it
+		Arguments: MyEntity* a_pEntity -> entity removed
+		Output: ---
+		*/
+		void RetireEntity(MyEntity* a_pEntity);
+		/*
+		Usage: updates the idle counters and the list of active entities, the ones moved on this update or awake
+		Arguments: ---
+		Output: ---
+		*/
+		void UpdateMotionStates(void);
+		/*
+		Usage: fills m_lPairList with the pairs of the active entities by querying the broadphase with their bounds
+		Arguments:
+		-	MyBroadphase* a_pBroadphase -> updated broadphase to query
+		-	MyBroadphaseStats& a_Stats -> counters to add the pairs dropped by the manager to
+		Output: ---
+		*/
+		void QueryActivePairs(MyBroadphase* a_pBroadphase, MyBroadphaseStats& a_Stats);
+		/*
+		Usage: runs the pairs of m_lPairList through the pair cache, testing the ones that moved and reporting the
+		events, the colliding lists of the rigid bodies are updated with the begin and end events
+		Arguments: ---
+		Output: ---
+		*/
+		void CheckPairList(void);
+		/*
+		Usage: copies the shape of the octree into m_Stats, or clears it when another structure ran the update
+		Arguments: ---
+		Output: ---
+		*/
+		void GatherOctreeStats(void);
+		/*
+		Usage: restarts the warm-up of the adaptive mode, timing every enabled strategy again
+		Arguments: ---
+		Output: ---
+		*/
+		void StartAdaptive(void);
+		/*
+		Usage: accounts the time of the last update and moves the adaptive mode to its next strategy
+		Arguments: float a_fTime -> milliseconds spent by the broadphase
+		Output: ---
+		*/
+		void StepAdaptive(float a_fTime);
+		/*
+		Usage: asks if the entity count or the size of the scene moved away from the ones the octree was tuned for
+		Arguments: ---
+		Output: should the octree be tuned again?
+		*/
+		bool IsOctreeTuneStale(void);
+		/*
+		Usage: starts a tuning when the octree settings went stale and measures the configurations for a slice of
+		the build budget; once every one is timed the cheapest settings go to the octree, which rebuilds with them
+		like after any other settings change
+		Arguments: ---
+		Output: ---
+		*/
+		void StepOctreeTuner(void);
+		/*
+		Usage: gets the diagonal of the box around the gathered bounds
+		Arguments: ---
+		Output: size of the scene
+		*/
+		float GetSceneSpread(void);
 	};//class
 
 } //namespace Simplex
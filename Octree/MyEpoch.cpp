@@ -0,0 +1,100 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyEpoch.h"
+#include <thread>
+using namespace Simplex;
+
+Simplex::MyEpoch::MyEpoch(void)
+{
+	m_uEpoch = 1;
+	for (uint i = 0; i < MAX_READERS; i++)
+	{
+		m_lReader[i] = 0;
+	}
+}
+
+Simplex::MyEpoch::~MyEpoch(void)
+{
+	for (Retired& retired : m_lRetired)
+	{
+		retired.Free();
+	}
+	m_lRetired.clear();
+}
+
+uint Simplex::MyEpoch::Enter(void)
+{
+	// An epoch read just before the writer advances is older than needed, which only keeps things alive longer
+	while (true)
+	{
+		for (uint i = 0; i < MAX_READERS; i++)
+		{
+			unsigned long long uFree = 0;
+			if (m_lReader[i].compare_exchange_strong(uFree, m_uEpoch.load()))
+				return i;
+		}
+		std::this_thread::yield();
+	}
+}
+
+void Simplex::MyEpoch::Leave(uint a_uSlot)
+{
+	m_lReader[a_uSlot].store(0);
+}
+
+void Simplex::MyEpoch::Retire(std::function<void()> a_Free)
+{
+	Retired retired;
+	retired.uEpoch = m_uEpoch.load();
+	retired.Free = std::move(a_Free);
+	m_lRetired.push_back(std::move(retired));
+}
+
+uint Simplex::MyEpoch::Collect(void)
+{
+	if (m_lRetired.empty()) { return 0; }
+
+	// Readers entering from now on can only load what is linked, the older ones hold back what they could reach
+	unsigned long long uOldest = m_uEpoch.fetch_add(1) + 1;
+	for (uint i = 0; i < MAX_READERS; i++)
+	{
+		unsigned long long uReader = m_lReader[i].load();
+		if (uReader != 0 && uReader < uOldest) { uOldest = uReader; }
+	}
+
+	uint uFreed = 0;
+	for (uint i = 0; i < m_lRetired.size();)
+	{
+		if (m_lRetired[i].uEpoch < uOldest)
+		{
+			m_lRetired[i].Free();
+			m_lRetired[i] = std::move(m_lRetired.back());
+			m_lRetired.pop_back();
+			uFreed++;
+		}
+		else
+		{
+			i++;
+		}
+	}
+	return uFreed;
+}
+
+uint Simplex::MyEpoch::GetRetiredCount(void)
+{
+	return static_cast<uint>(m_lRetired.size());
+}
+
+Simplex::MyEpochGuard::MyEpochGuard(MyEpoch* a_pEpoch)
+{
+	m_pEpoch = a_pEpoch;
+	m_uSlot = m_pEpoch->Enter();
+}
+
+Simplex::MyEpochGuard::~MyEpochGuard(void)
+{
+	m_pEpoch->Leave(m_uSlot);
+}
@@ -0,0 +1,122 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYEPOCH_H_
+#define __MYEPOCH_H_
+
+#include "Simplex\Simplex.h"
+#include <atomic>
+#include <functional>
+
+namespace Simplex
+{
+	// Epoch based reclamation: readers announce the epoch they entered at, the writer retires what it unlinked and
+	// frees it once every reader that could still reach it has left
+	class MyEpoch
+	{
+		static constexpr uint MAX_READERS = 64; // readers inside at the same time, more wait for a free slot
+
+		// Object unlinked by the writer, waiting for the readers of its epoch
+		struct Retired
+		{
+			unsigned long long uEpoch = 0; // epoch it was unlinked at
+			std::function<void()> Free;
+		};
+
+		std::atomic<unsigned long long> m_uEpoch; // current epoch, starts at 1
+		std::atomic<unsigned long long> m_lReader[MAX_READERS]; // epoch each reader entered at, 0 for a free slot
+		std::vector<Retired> m_lRetired; // only the writer touches it
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyEpoch(void);
+
+		/*
+		USAGE: Destructor, frees everything retired; no reader can be inside anymore
+		*/
+		~MyEpoch(void);
+
+		/*
+		USAGE: Enters a read section, what the reader loads from now on stays alive until it leaves; safe from any
+		thread
+		OUTPUT: slot to leave with
+		*/
+		uint Enter(void);
+
+		/*
+		USAGE: Leaves a read section
+		ARGUMENTS:
+		- uint a_uSlot -> slot Enter returned
+		*/
+		void Leave(uint a_uSlot);
+
+		/*
+		USAGE: Hands over something the writer unlinked, to be called by the writer only
+		ARGUMENTS:
+		- std::function<void()> a_Free -> frees it once no reader can reach it
+		*/
+		void Retire(std::function<void()> a_Free);
+
+		/*
+		USAGE: Advances the epoch and frees what the readers left behind, to be called by the writer only
+		OUTPUT: objects freed
+		*/
+		uint Collect(void);
+
+		/*
+		USAGE: Gets the number of objects waiting for their readers
+		OUTPUT: retired count
+		*/
+		uint GetRetiredCount(void);
+
+	private:
+		/*
+		USAGE: Copy constructor
+		*/
+		MyEpoch(MyEpoch const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyEpoch& operator=(MyEpoch const& a_pOther);
+	};
+
+	// Read section of a MyEpoch for the lifetime of the guard
+	class MyEpochGuard
+	{
+		MyEpoch* m_pEpoch = nullptr;
+		uint m_uSlot = 0;
+
+	public:
+		/*
+		USAGE: Enters the read section
+		ARGUMENTS:
+		- MyEpoch* a_pEpoch -> epoch to enter
+		OUTPUT: class object
+		*/
+		MyEpochGuard(MyEpoch* a_pEpoch);
+
+		/*
+		USAGE: Leaves the read section
+		*/
+		~MyEpochGuard(void);
+
+	private:
+		/*
+		USAGE: Copy constructor
+		*/
+		MyEpochGuard(MyEpochGuard const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyEpochGuard& operator=(MyEpochGuard const& a_pOther);
+	};
+}
+
+#endif //__MYEPOCH_H_
@@ -0,0 +1,79 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyMappedFile.h"
+using namespace Simplex;
+
+Simplex::MyMappedFile::MyMappedFile(void)
+{
+	m_hFile = INVALID_HANDLE_VALUE;
+	m_hMapping = nullptr;
+	m_pData = nullptr;
+	m_uSize = 0;
+}
+
+Simplex::MyMappedFile::~MyMappedFile(void)
+{
+	Close();
+}
+
+bool Simplex::MyMappedFile::Open(String a_sFileName)
+{
+	Close();
+
+	m_hFile = CreateFileA(a_sFileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (m_hFile == INVALID_HANDLE_VALUE) { return false; }
+
+	// A mapping cannot be made of an empty file
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(m_hFile, &size) || size.QuadPart <= 0)
+	{
+		Close();
+		return false;
+	}
+
+	m_hMapping = CreateFileMappingA(m_hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	if (m_hMapping == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	m_pData = static_cast<char const*>(MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0));
+	if (m_pData == nullptr)
+	{
+		Close();
+		return false;
+	}
+	m_uSize = static_cast<size_t>(size.QuadPart);
+	return true;
+}
+
+void Simplex::MyMappedFile::Close(void)
+{
+	if (m_pData != nullptr) { UnmapViewOfFile(m_pData); }
+	if (m_hMapping != nullptr) { CloseHandle(m_hMapping); }
+	if (m_hFile != INVALID_HANDLE_VALUE) { CloseHandle(m_hFile); }
+
+	m_hFile = INVALID_HANDLE_VALUE;
+	m_hMapping = nullptr;
+	m_pData = nullptr;
+	m_uSize = 0;
+}
+
+bool Simplex::MyMappedFile::IsOpen(void)
+{
+	return m_pData != nullptr;
+}
+
+char const* Simplex::MyMappedFile::GetData(void)
+{
+	return m_pData;
+}
+
+size_t Simplex::MyMappedFile::GetSize(void)
+{
+	return m_uSize;
+}
@@ -0,0 +1,99 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYMAPPEDFILE_H_
+#define __MYMAPPEDFILE_H_
+
+#include "Simplex\Simplex.h"
+
+namespace Simplex
+{
+	// Where an array lies in a file written to be mapped, the offset aligned so it can be read in place
+	struct MyFileSection
+	{
+		unsigned long long uOffset = 0; // from the start of the file
+		unsigned long long uSize = 0; // in bytes
+	};
+
+	// Read only view of a whole file mapped in memory, the pages are read in by the system as they are touched
+	class MyMappedFile
+	{
+		HANDLE m_hFile = INVALID_HANDLE_VALUE;
+		HANDLE m_hMapping = nullptr;
+		char const* m_pData = nullptr; // first byte of the file, nullptr while nothing is mapped
+		size_t m_uSize = 0; // bytes in the file
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyMappedFile(void);
+
+		/*
+		USAGE: Destructor, unmaps the file
+		*/
+		~MyMappedFile(void);
+
+		/*
+		USAGE: Maps a file, closing the one mapped before
+		ARGUMENTS:
+		- String a_sFileName -> file to map
+		OUTPUT: was it mapped? empty files are not
+		*/
+		bool Open(String a_sFileName);
+
+		/*
+		USAGE: Unmaps the file, the pointers into it are no longer valid
+		*/
+		void Close(void);
+
+		/*
+		USAGE: Asks if a file is mapped
+		OUTPUT: is it open?
+		*/
+		bool IsOpen(void);
+
+		/*
+		USAGE: Gets the contents of the file
+		OUTPUT: first byte, nullptr if nothing is mapped
+		*/
+		char const* GetData(void);
+
+		/*
+		USAGE: Gets the size of the file
+		OUTPUT: bytes mapped, 0 if nothing is mapped
+		*/
+		size_t GetSize(void);
+
+		/*
+		USAGE: Gets an array stored in the file without copying it
+		ARGUMENTS:
+		- size_t a_uOffset -> byte the array starts at, aligned to the type
+		- size_t a_uCount -> entries in the array
+		OUTPUT: first entry, nullptr if the array does not fit in the file or is misaligned
+		*/
+		template <class T> T const* GetArray(size_t a_uOffset, size_t a_uCount)
+		{
+			if (m_pData == nullptr || a_uOffset > m_uSize || a_uCount > (m_uSize - a_uOffset) / sizeof(T)) { return nullptr; }
+			if (a_uOffset % alignof(T) != 0) { return nullptr; }
+
+			return reinterpret_cast<T const*>(m_pData + a_uOffset);
+		}
+
+	private:
+		/*
+		USAGE: Copy constructor
+		*/
+		MyMappedFile(MyMappedFile const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyMappedFile& operator=(MyMappedFile const& a_pOther);
+	};
+}
+
+#endif //__MYMAPPEDFILE_H_
@@ -0,0 +1,319 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyMotionSystem.h"
+using namespace Simplex;
+
+Simplex::MyMotionSystem::MyMotionSystem(void)
+{
+}
+
+void Simplex::MyMotionSystem::Resize(uint a_uEntityCount)
+{
+	m_lEntityBody.resize(a_uEntityCount, NO_BODY);
+}
+
+void Simplex::MyMotionSystem::AddBody(uint a_uEntity, vector3 const& a_v3Position, vector3 const& a_v3Velocity, float a_fMass)
+{
+	if (a_uEntity >= m_lEntityBody.size()) { Resize(a_uEntity + 1); }
+
+	uint uBody = m_lEntityBody[a_uEntity];
+	if (uBody == NO_BODY)
+	{
+		uBody = static_cast<uint>(m_lBodyEntity.size());
+		m_lEntityBody[a_uEntity] = uBody;
+		m_lBodyEntity.push_back(a_uEntity);
+		m_lPositionX.push_back(0.0f);
+		m_lPositionY.push_back(0.0f);
+		m_lPositionZ.push_back(0.0f);
+		m_lVelocityX.push_back(0.0f);
+		m_lVelocityY.push_back(0.0f);
+		m_lVelocityZ.push_back(0.0f);
+		m_lForceX.push_back(0.0f);
+		m_lForceY.push_back(0.0f);
+		m_lForceZ.push_back(0.0f);
+		m_lOffsetX.push_back(0.0f);
+		m_lOffsetY.push_back(0.0f);
+		m_lOffsetZ.push_back(0.0f);
+		m_lInverseMass.push_back(0.0f);
+	}
+
+	m_lPositionX[uBody] = a_v3Position.x;
+	m_lPositionY[uBody] = a_v3Position.y;
+	m_lPositionZ[uBody] = a_v3Position.z;
+	m_lVelocityX[uBody] = a_v3Velocity.x;
+	m_lVelocityY[uBody] = a_v3Velocity.y;
+	m_lVelocityZ[uBody] = a_v3Velocity.z;
+	m_lInverseMass[uBody] = a_fMass > 0.0f ? 1.0f / a_fMass : 0.0f;
+}
+
+void Simplex::MyMotionSystem::RemoveBody(uint a_uEntity)
+{
+	if (a_uEntity >= m_lEntityBody.size() || m_lEntityBody[a_uEntity] == NO_BODY) { return; }
+
+	RemoveSlot(m_lEntityBody[a_uEntity]);
+	m_lEntityBody[a_uEntity] = NO_BODY;
+}
+
+void Simplex::MyMotionSystem::RemoveEntity(uint a_uEntity)
+{
+	if (a_uEntity >= m_lEntityBody.size()) { return; }
+
+	RemoveBody(a_uEntity);
+
+	// The last entity takes the index of the removed one, its body follows it
+	uint uLast = static_cast<uint>(m_lEntityBody.size()) - 1;
+	if (a_uEntity != uLast)
+	{
+		uint uBody = m_lEntityBody[uLast];
+		m_lEntityBody[a_uEntity] = uBody;
+		if (uBody != NO_BODY) { m_lBodyEntity[uBody] = a_uEntity; }
+	}
+	m_lEntityBody.pop_back();
+}
+
+bool Simplex::MyMotionSystem::HasBody(uint a_uEntity)
+{
+	return a_uEntity < m_lEntityBody.size() && m_lEntityBody[a_uEntity] != NO_BODY;
+}
+
+uint Simplex::MyMotionSystem::GetBodyCount(void)
+{
+	return static_cast<uint>(m_lBodyEntity.size());
+}
+
+void Simplex::MyMotionSystem::SetPosition(uint a_uEntity, vector3 const& a_v3Position)
+{
+	if (!HasBody(a_uEntity)) { return; }
+
+	// The entity is already there, nothing is left to write back
+	uint uBody = m_lEntityBody[a_uEntity];
+	m_lPositionX[uBody] = a_v3Position.x;
+	m_lPositionY[uBody] = a_v3Position.y;
+	m_lPositionZ[uBody] = a_v3Position.z;
+	m_lOffsetX[uBody] = 0.0f;
+	m_lOffsetY[uBody] = 0.0f;
+	m_lOffsetZ[uBody] = 0.0f;
+}
+
+void Simplex::MyMotionSystem::SetVelocity(uint a_uEntity, vector3 const& a_v3Velocity)
+{
+	if (!HasBody(a_uEntity)) { return; }
+
+	uint uBody = m_lEntityBody[a_uEntity];
+	m_lVelocityX[uBody] = a_v3Velocity.x;
+	m_lVelocityY[uBody] = a_v3Velocity.y;
+	m_lVelocityZ[uBody] = a_v3Velocity.z;
+}
+
+vector3 Simplex::MyMotionSystem::GetVelocity(uint a_uEntity)
+{
+	if (!HasBody(a_uEntity)) { return ZERO_V3; }
+
+	uint uBody = m_lEntityBody[a_uEntity];
+	return vector3(m_lVelocityX[uBody], m_lVelocityY[uBody], m_lVelocityZ[uBody]);
+}
+
+void Simplex::MyMotionSystem::ApplyForce(uint a_uEntity, vector3 const& a_v3Force)
+{
+	if (!HasBody(a_uEntity)) { return; }
+
+	uint uBody = m_lEntityBody[a_uEntity];
+	m_lForceX[uBody] += a_v3Force.x;
+	m_lForceY[uBody] += a_v3Force.y;
+	m_lForceZ[uBody] += a_v3Force.z;
+}
+
+void Simplex::MyMotionSystem::SetGravity(vector3 const& a_v3Gravity)
+{
+	m_v3Gravity = a_v3Gravity;
+}
+
+void Simplex::MyMotionSystem::SetWorldBounds(vector3 const& a_v3Min, vector3 const& a_v3Max)
+{
+	m_v3WorldMin = glm::min(a_v3Min, a_v3Max);
+	m_v3WorldMax = glm::max(a_v3Min, a_v3Max);
+}
+
+void Simplex::MyMotionSystem::Integrate(float a_fDeltaTime)
+{
+	uint uCount = GetBodyCount();
+	if (uCount == 0 || a_fDeltaTime <= 0.0f) { return; }
+
+	float fDamping = glm::max(0.0f, 1.0f - m_fFriction * a_fDeltaTime);
+	float fMaxSpeed2 = m_fMaxSpeed * m_fMaxSpeed;
+	float fBounce = -m_fRestitution;
+
+	// Raw pointers and branch free bodies so the compiler keeps every loop below in vector registers
+	float* pPX = m_lPositionX.data();
+	float* pPY = m_lPositionY.data();
+	float* pPZ = m_lPositionZ.data();
+	float* pVX = m_lVelocityX.data();
+	float* pVY = m_lVelocityY.data();
+	float* pVZ = m_lVelocityZ.data();
+	float* pFX = m_lForceX.data();
+	float* pFY = m_lForceY.data();
+	float* pFZ = m_lForceZ.data();
+	float* pOX = m_lOffsetX.data();
+	float* pOY = m_lOffsetY.data();
+	float* pOZ = m_lOffsetZ.data();
+	const float* pInverseMass = m_lInverseMass.data();
+
+	for (uint uStart = 0; uStart < uCount; uStart += BATCH_SIZE)
+	{
+		uint uEnd = glm::min(uStart + BATCH_SIZE, uCount);
+
+		// Forces, gravity and friction, bodies without mass keep their velocity untouched
+		for (uint i = uStart; i < uEnd; i++)
+		{
+			float fInverseMass = pInverseMass[i];
+			float fMoves = fInverseMass > 0.0f ? 1.0f : 0.0f;
+			float fSlows = fInverseMass > 0.0f ? fDamping : 1.0f;
+			pVX[i] = (pVX[i] + (pFX[i] * fInverseMass + m_v3Gravity.x * fMoves) * a_fDeltaTime) * fSlows;
+			pVY[i] = (pVY[i] + (pFY[i] * fInverseMass + m_v3Gravity.y * fMoves) * a_fDeltaTime) * fSlows;
+			pVZ[i] = (pVZ[i] + (pFZ[i] * fInverseMass + m_v3Gravity.z * fMoves) * a_fDeltaTime) * fSlows;
+			pFX[i] = 0.0f;
+			pFY[i] = 0.0f;
+			pFZ[i] = 0.0f;
+		}
+
+		// Speed cap
+		for (uint i = uStart; i < uEnd; i++)
+		{
+			float fSpeed2 = pVX[i] * pVX[i] + pVY[i] * pVY[i] + pVZ[i] * pVZ[i];
+			float fScale = fSpeed2 > fMaxSpeed2 ? m_fMaxSpeed / std::sqrt(fSpeed2) : 1.0f;
+			pVX[i] *= fScale;
+			pVY[i] *= fScale;
+			pVZ[i] *= fScale;
+		}
+
+		// Positions, a body past a wall is put back on it and bounces
+		for (uint i = uStart; i < uEnd; i++)
+		{
+			float fX = pPX[i] + pVX[i] * a_fDeltaTime;
+			float fY = pPY[i] + pVY[i] * a_fDeltaTime;
+			float fZ = pPZ[i] + pVZ[i] * a_fDeltaTime;
+			bool bOutX = fX < m_v3WorldMin.x || fX > m_v3WorldMax.x;
+			bool bOutY = fY < m_v3WorldMin.y || fY > m_v3WorldMax.y;
+			bool bOutZ = fZ < m_v3WorldMin.z || fZ > m_v3WorldMax.z;
+			fX = glm::clamp(fX, m_v3WorldMin.x, m_v3WorldMax.x);
+			fY = glm::clamp(fY, m_v3WorldMin.y, m_v3WorldMax.y);
+			fZ = glm::clamp(fZ, m_v3WorldMin.z, m_v3WorldMax.z);
+			pVX[i] *= bOutX ? fBounce : 1.0f;
+			pVY[i] *= bOutY ? fBounce : 1.0f;
+			pVZ[i] *= bOutZ ? fBounce : 1.0f;
+			pOX[i] += fX - pPX[i];
+			pOY[i] += fY - pPY[i];
+			pOZ[i] += fZ - pPZ[i];
+			pPX[i] = fX;
+			pPY[i] = fY;
+			pPZ[i] = fZ;
+		}
+	}
+}
+
+void Simplex::MyMotionSystem::WriteBack(MyEntity** a_pEntity)
+{
+	uint uCount = GetBodyCount();
+	for (uint i = 0; i < uCount; i++)
+	{
+		if (m_lOffsetX[i] == 0.0f && m_lOffsetY[i] == 0.0f && m_lOffsetZ[i] == 0.0f) { continue; }
+
+		a_pEntity[m_lBodyEntity[i]]->Translate(vector3(m_lOffsetX[i], m_lOffsetY[i], m_lOffsetZ[i]));
+		m_lOffsetX[i] = 0.0f;
+		m_lOffsetY[i] = 0.0f;
+		m_lOffsetZ[i] = 0.0f;
+	}
+}
+
+void Simplex::MyMotionSystem::ResolveContacts(MyEventList const& a_lContacts, std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	for (MyCollisionEvent const& event : a_lContacts)
+	{
+		if (event.eType == CE_END) { continue; }
+		if (event.uA >= a_lMin.size() || event.uB >= a_lMin.size()) { continue; }
+
+		uint uBodyA = HasBody(event.uA) ? m_lEntityBody[event.uA] : NO_BODY;
+		uint uBodyB = HasBody(event.uB) ? m_lEntityBody[event.uB] : NO_BODY;
+		float fInverseA = uBodyA != NO_BODY ? m_lInverseMass[uBodyA] : 0.0f;
+		float fInverseB = uBodyB != NO_BODY ? m_lInverseMass[uBodyB] : 0.0f;
+		float fInverseSum = fInverseA + fInverseB;
+		if (fInverseSum <= 0.0f) { continue; }
+
+		// Normal along the axis of least overlap, pointing from A to B
+		vector3 v3Overlap = glm::min(a_lMax[event.uA], a_lMax[event.uB]) - glm::max(a_lMin[event.uA], a_lMin[event.uB]);
+		if (v3Overlap.x <= 0.0f || v3Overlap.y <= 0.0f || v3Overlap.z <= 0.0f) { continue; }
+
+		uint uAxis = 0;
+		if (v3Overlap.y < v3Overlap[uAxis]) { uAxis = 1; }
+		if (v3Overlap.z < v3Overlap[uAxis]) { uAxis = 2; }
+		float fCenterA = a_lMin[event.uA][uAxis] + a_lMax[event.uA][uAxis];
+		float fCenterB = a_lMin[event.uB][uAxis] + a_lMax[event.uB][uAxis];
+		float fSign = fCenterB >= fCenterA ? 1.0f : -1.0f;
+		float fDepth = v3Overlap[uAxis];
+
+		std::vector<float>& lVelocity = uAxis == 0 ? m_lVelocityX : (uAxis == 1 ? m_lVelocityY : m_lVelocityZ);
+		std::vector<float>& lPosition = uAxis == 0 ? m_lPositionX : (uAxis == 1 ? m_lPositionY : m_lPositionZ);
+		std::vector<float>& lOffset = uAxis == 0 ? m_lOffsetX : (uAxis == 1 ? m_lOffsetY : m_lOffsetZ);
+
+		// Impulse only while they approach, the correction splits the depth by inverse mass
+		float fVelocityA = uBodyA != NO_BODY ? lVelocity[uBodyA] : 0.0f;
+		float fVelocityB = uBodyB != NO_BODY ? lVelocity[uBodyB] : 0.0f;
+		float fApproach = (fVelocityA - fVelocityB) * fSign;
+		float fImpulse = fApproach > 0.0f ? (1.0f + m_fRestitution) * fApproach / fInverseSum : 0.0f;
+
+		if (fInverseA > 0.0f)
+		{
+			float fPush = -fSign * fDepth * fInverseA / fInverseSum;
+			lVelocity[uBodyA] -= fSign * fImpulse * fInverseA;
+			lPosition[uBodyA] += fPush;
+			lOffset[uBodyA] += fPush;
+		}
+		if (fInverseB > 0.0f)
+		{
+			float fPush = fSign * fDepth * fInverseB / fInverseSum;
+			lVelocity[uBodyB] += fSign * fImpulse * fInverseB;
+			lPosition[uBodyB] += fPush;
+			lOffset[uBodyB] += fPush;
+		}
+	}
+}
+
+void Simplex::MyMotionSystem::RemoveSlot(uint a_uBody)
+{
+	uint uLast = GetBodyCount() - 1;
+	if (a_uBody != uLast)
+	{
+		m_lBodyEntity[a_uBody] = m_lBodyEntity[uLast];
+		m_lEntityBody[m_lBodyEntity[a_uBody]] = a_uBody;
+		m_lPositionX[a_uBody] = m_lPositionX[uLast];
+		m_lPositionY[a_uBody] = m_lPositionY[uLast];
+		m_lPositionZ[a_uBody] = m_lPositionZ[uLast];
+		m_lVelocityX[a_uBody] = m_lVelocityX[uLast];
+		m_lVelocityY[a_uBody] = m_lVelocityY[uLast];
+		m_lVelocityZ[a_uBody] = m_lVelocityZ[uLast];
+		m_lForceX[a_uBody] = m_lForceX[uLast];
+		m_lForceY[a_uBody] = m_lForceY[uLast];
+		m_lForceZ[a_uBody] = m_lForceZ[uLast];
+		m_lOffsetX[a_uBody] = m_lOffsetX[uLast];
+		m_lOffsetY[a_uBody] = m_lOffsetY[uLast];
+		m_lOffsetZ[a_uBody] = m_lOffsetZ[uLast];
+		m_lInverseMass[a_uBody] = m_lInverseMass[uLast];
+	}
+	m_lBodyEntity.pop_back();
+	m_lPositionX.pop_back();
+	m_lPositionY.pop_back();
+	m_lPositionZ.pop_back();
+	m_lVelocityX.pop_back();
+	m_lVelocityY.pop_back();
+	m_lVelocityZ.pop_back();
+	m_lForceX.pop_back();
+	m_lForceY.pop_back();
+	m_lForceZ.pop_back();
+	m_lOffsetX.pop_back();
+	m_lOffsetY.pop_back();
+	m_lOffsetZ.pop_back();
+	m_lInverseMass.pop_back();
+}
@@ -0,0 +1,179 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYMOTIONSYSTEM_H_
+#define __MYMOTIONSYSTEM_H_
+
+#include "MyEntity.h"
+#include "MyPairCache.h"
+
+namespace Simplex
+{
+	// Moving bodies following the model of the Simplex Solver (mass, velocity, forces, friction, speed cap), kept
+	// in structure of arrays so every step runs over contiguous floats
+	class MyMotionSystem
+	{
+		static constexpr uint BATCH_SIZE = 256; // bodies integrated together, every pass over a batch stays in the cache
+		static constexpr uint NO_BODY = (uint)-1; // body of an entity that does not move
+
+		std::vector<uint> m_lEntityBody; // body of every entity, NO_BODY for the ones without motion
+		std::vector<uint> m_lBodyEntity; // entity of every body
+
+		std::vector<float> m_lPositionX; // position of every body, the translation of its model matrix
+		std::vector<float> m_lPositionY;
+		std::vector<float> m_lPositionZ;
+		std::vector<float> m_lVelocityX; // velocity of every body, in units per second
+		std::vector<float> m_lVelocityY;
+		std::vector<float> m_lVelocityZ;
+		std::vector<float> m_lForceX; // force accumulated since the last step
+		std::vector<float> m_lForceY;
+		std::vector<float> m_lForceZ;
+		std::vector<float> m_lOffsetX; // displacement since the last write back
+		std::vector<float> m_lOffsetY;
+		std::vector<float> m_lOffsetZ;
+		std::vector<float> m_lInverseMass; // 0 for bodies that do not react to forces or contacts
+
+		vector3 m_v3Gravity = ZERO_V3; // acceleration applied to every body with mass
+		float m_fFriction = 0.1f; // fraction of the velocity lost per second by every body with mass
+		float m_fMaxSpeed = 30.0f; // speed cap, as the Solver caps its velocity
+		float m_fRestitution = 0.5f; // bounce of the contacts and the walls
+		vector3 m_v3WorldMin = vector3(-50.0f); // walls the bodies bounce off
+		vector3 m_v3WorldMax = vector3(50.0f);
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyMotionSystem(void);
+
+		/*
+		USAGE: Makes the list of entities as long as the entity manager's, new entities have no motion
+		ARGUMENTS:
+		- uint a_uEntityCount -> number of entities
+		*/
+		void Resize(uint a_uEntityCount);
+
+		/*
+		USAGE: Gives motion to an entity or changes its mass and velocity if it already moves
+		ARGUMENTS:
+		- uint a_uEntity -> index of the entity
+		- vector3 const& a_v3Position -> translation of its model matrix
+		- vector3 const& a_v3Velocity -> velocity in units per second
+		- float a_fMass -> mass, 0 or less for a body nothing can push
+		*/
+		void AddBody(uint a_uEntity, vector3 const& a_v3Position, vector3 const& a_v3Velocity, float a_fMass);
+
+		/*
+		USAGE: Removes the motion of an entity
+		ARGUMENTS:
+		- uint a_uEntity -> index of the entity
+		*/
+		void RemoveBody(uint a_uEntity);
+
+		/*
+		USAGE: Follows the entity manager removing an entity, the last entity takes the index of the removed one
+		ARGUMENTS:
+		- uint a_uEntity -> index of the removed entity
+		*/
+		void RemoveEntity(uint a_uEntity);
+
+		/*
+		USAGE: Asks if an entity moves
+		ARGUMENTS:
+		- uint a_uEntity -> index of the entity
+		OUTPUT: does it have a body?
+		*/
+		bool HasBody(uint a_uEntity);
+
+		/*
+		USAGE: Gets the number of moving entities
+		OUTPUT: body count
+		*/
+		uint GetBodyCount(void);
+
+		/*
+		USAGE: Moves a body to a position set from outside, e.g. a new model matrix
+		ARGUMENTS:
+		- uint a_uEntity -> index of the entity, entities without motion are ignored
+		- vector3 const& a_v3Position -> new translation
+		*/
+		void SetPosition(uint a_uEntity, vector3 const& a_v3Position);
+
+		/*
+		USAGE: Sets the velocity of a body
+		ARGUMENTS:
+		- uint a_uEntity -> index of the entity, entities without motion are ignored
+		- vector3 const& a_v3Velocity -> velocity in units per second
+		*/
+		void SetVelocity(uint a_uEntity, vector3 const& a_v3Velocity);
+
+		/*
+		USAGE: Gets the velocity of a body
+		ARGUMENTS:
+		- uint a_uEntity -> index of the entity
+		OUTPUT: velocity, zero for entities without motion
+		*/
+		vector3 GetVelocity(uint a_uEntity);
+
+		/*
+		USAGE: Adds a force to the body for the next step
+		ARGUMENTS:
+		- uint a_uEntity -> index of the entity, entities without motion are ignored
+		- vector3 const& a_v3Force -> force to apply
+		*/
+		void ApplyForce(uint a_uEntity, vector3 const& a_v3Force);
+
+		/*
+		USAGE: Sets the acceleration applied to every body with mass
+		ARGUMENTS:
+		- vector3 const& a_v3Gravity -> acceleration
+		*/
+		void SetGravity(vector3 const& a_v3Gravity);
+
+		/*
+		USAGE: Sets the box the bodies bounce inside of
+		ARGUMENTS:
+		- vector3 const& a_v3Min, a_v3Max -> corners of the box
+		*/
+		void SetWorldBounds(vector3 const& a_v3Min, vector3 const& a_v3Max);
+
+		/*
+		USAGE: Integrates every body, batch after batch: forces and gravity into the velocities, friction, the speed
+		cap, then the positions and the walls
+		ARGUMENTS:
+		- float a_fDeltaTime -> seconds to advance
+		*/
+		void Integrate(float a_fDeltaTime);
+
+		/*
+		USAGE: Moves the entities by what their bodies moved since the last call, only the translation of the model
+		matrices and the global bounds change
+		ARGUMENTS:
+		- MyEntity** a_pEntity -> entity array of the entity manager
+		*/
+		void WriteBack(MyEntity** a_pEntity);
+
+		/*
+		USAGE: Pushes apart the bodies of every pair in contact, along the axis where their bounds overlap the least;
+		entities without motion act as walls
+		ARGUMENTS:
+		- MyEventList const& a_lContacts -> events of the last update, begin and stay events are the contacts
+		- std::vector<vector3> const& a_lMin -> global minimum of every entity
+		- std::vector<vector3> const& a_lMax -> global maximum of every entity
+		*/
+		void ResolveContacts(MyEventList const& a_lContacts, std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax);
+
+	private:
+		/*
+		USAGE: Removes a body, the last body takes its slot
+		ARGUMENTS:
+		- uint a_uBody -> body to remove
+		*/
+		void RemoveSlot(uint a_uBody);
+	};
+}
+
+#endif //__MYMOTIONSYSTEM_H_
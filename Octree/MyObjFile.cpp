@@ -0,0 +1,825 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyObjFile.h"
+#include "MyProfiler.h"
+#include <future>
+#include <thread>
+using namespace Simplex;
+
+bool Simplex::MyObjFile::m_bFastPath = true;
+bool Simplex::MyObjFile::m_bCache = true;
+
+Simplex::MyObjFile::MyObjFile(void)
+{
+	m_sMaterialLibrary = "";
+}
+
+Simplex::MyObjFile::~MyObjFile(void)
+{
+}
+
+bool Simplex::MyObjFile::Load(String a_sFileName, uint a_uThreadCount)
+{
+	MY_PROFILE_ZONE("MyObjFile::Load");
+	MyMappedFile file;
+	if (!file.Open(a_sFileName)) { return false; }
+
+	return Parse(file.GetData(), file.GetSize(), a_uThreadCount);
+}
+
+bool Simplex::MyObjFile::Parse(char const* a_pData, size_t a_uSize, uint a_uThreadCount)
+{
+	Clear();
+
+	// Every chunk starts at the start of a line, a line is never split between two threads
+	uint uThreadCount = a_uThreadCount > 0 ? a_uThreadCount : std::max(std::thread::hardware_concurrency(), 1u);
+	uint uChunkCount = static_cast<uint>(std::min<size_t>(uThreadCount, a_uSize / MIN_CHUNK + 1));
+	std::vector<char const*> lBoundary(uChunkCount + 1, a_pData + a_uSize);
+	lBoundary[0] = a_pData;
+	for (uint i = 1; i < uChunkCount; i++)
+	{
+		char const* pCut = std::max(lBoundary[i - 1], a_pData + a_uSize / uChunkCount * i);
+		char const* pLineEnd = static_cast<char const*>(memchr(pCut, '\n', a_pData + a_uSize - pCut));
+		lBoundary[i] = pLineEnd != nullptr ? pLineEnd + 1 : a_pData + a_uSize;
+	}
+
+	std::vector<Chunk> lChunk(uChunkCount);
+	{
+		MY_PROFILE_ZONE("ParseChunks");
+		std::vector<std::future<void>> lTask;
+		for (uint i = 1; i < uChunkCount; i++)
+		{
+			char const* pStart = lBoundary[i];
+			char const* pEnd = lBoundary[i + 1];
+			Chunk* pChunk = &lChunk[i];
+			lTask.push_back(std::async(std::launch::async, [pStart, pEnd, pChunk]()
+				{
+					MY_PROFILE_THREAD("OBJ parse");
+					ParseChunk(pStart, pEnd, *pChunk);
+				}));
+		}
+		ParseChunk(lBoundary[0], lBoundary[1], lChunk[0]);
+		for (std::future<void>& task : lTask)
+		{
+			task.get();
+		}
+	}
+
+	// Each chunk lands after the ones before it, the copies run in parallel again
+	MY_PROFILE_ZONE("MergeChunks");
+	std::vector<MyObjCorner> lOffset(uChunkCount);
+	std::vector<uint> lCornerStart(uChunkCount);
+	MyObjCorner total;
+	total.nPosition = total.nUV = total.nNormal = 0;
+	uint uCornerCount = 0;
+	for (uint i = 0; i < uChunkCount; i++)
+	{
+		if (!lChunk[i].bValid)
+		{
+			Clear();
+			return false;
+		}
+
+		lOffset[i] = total;
+		lCornerStart[i] = uCornerCount;
+		total.nPosition += static_cast<int>(lChunk[i].lPosition.size());
+		total.nUV += static_cast<int>(lChunk[i].lUV.size());
+		total.nNormal += static_cast<int>(lChunk[i].lNormal.size());
+		uCornerCount += static_cast<uint>(lChunk[i].lCorner.size());
+		if (m_sMaterialLibrary == "")
+			m_sMaterialLibrary = lChunk[i].sMaterialLibrary;
+	}
+	m_lPosition.resize(total.nPosition);
+	m_lUV.resize(total.nUV);
+	m_lNormal.resize(total.nNormal);
+	m_lCorner.resize(uCornerCount);
+
+	std::vector<std::future<bool>> lMerge;
+	for (uint i = 1; i < uChunkCount; i++)
+	{
+		lMerge.push_back(std::async(std::launch::async, [this, &lChunk, &lOffset, &lCornerStart, i]()
+			{
+				return MergeChunk(lChunk[i], lOffset[i], lCornerStart[i]);
+			}));
+	}
+	bool bValid = MergeChunk(lChunk[0], lOffset[0], lCornerStart[0]);
+	for (std::future<bool>& merge : lMerge)
+	{
+		bValid = merge.get() && bValid;
+	}
+	if (!bValid)
+	{
+		Clear();
+		return false;
+	}
+
+	// The group and the material carry over from one chunk to the next, a run ends wherever either changes
+	MyObjGroup current;
+	current.sName = "default";
+	for (uint i = 0; i < uChunkCount; i++)
+	{
+		Chunk const& chunk = lChunk[i];
+		uint uGroup = 0;
+		uint uMaterial = 0;
+		while (uGroup < chunk.lGroupSwitch.size() || uMaterial < chunk.lMaterialSwitch.size())
+		{
+			bool bGroup = uMaterial == chunk.lMaterialSwitch.size() ||
+				(uGroup < chunk.lGroupSwitch.size() && chunk.lGroupSwitch[uGroup].first <= chunk.lMaterialSwitch[uMaterial].first);
+			std::pair<uint, String> const& change = bGroup ? chunk.lGroupSwitch[uGroup++] : chunk.lMaterialSwitch[uMaterial++];
+			uint uCorner = lCornerStart[i] + change.first;
+			if (uCorner > current.uCornerStart)
+			{
+				current.uCornerCount = uCorner - current.uCornerStart;
+				m_lGroup.push_back(current);
+			}
+			current.uCornerStart = uCorner;
+			(bGroup ? current.sName : current.sMaterial) = change.second;
+		}
+	}
+	if (uCornerCount > current.uCornerStart)
+	{
+		current.uCornerCount = uCornerCount - current.uCornerStart;
+		m_lGroup.push_back(current);
+	}
+	ComputeBounds();
+	return true;
+}
+
+String Simplex::MyObjFile::MakeModel(Model* a_pModel, String a_sName, String a_sFolder)
+{
+	MY_PROFILE_ZONE("MyObjFile::MakeModel");
+	if (m_sMaterialLibrary != "")
+		a_pModel->LoadMTL(a_sFolder + m_sMaterialLibrary);
+
+	// The meshes are not indexed, every corner becomes a vertex of its own
+	std::map<String, Group*> groupMap;
+	for (uint i = 0; i < m_lGroup.size(); i++)
+	{
+		MyObjGroup const& run = m_lGroup[i];
+		std::vector<vector3> lPosition(run.uCornerCount);
+		std::vector<vector3> lUV;
+		std::vector<vector3> lNormal;
+		bool bUV = true;
+		bool bNormal = true;
+		for (uint j = 0; j < run.uCornerCount; j++)
+		{
+			MyObjCorner const& corner = m_lCorner[run.uCornerStart + j];
+			lPosition[j] = m_lPosition[corner.nPosition];
+			bUV = bUV && corner.nUV >= 0;
+			bNormal = bNormal && corner.nNormal >= 0;
+		}
+		if (bUV)
+		{
+			lUV.resize(run.uCornerCount);
+			for (uint j = 0; j < run.uCornerCount; j++)
+			{
+				lUV[j] = m_lUV[m_lCorner[run.uCornerStart + j].nUV];
+			}
+		}
+		if (bNormal)
+		{
+			lNormal.resize(run.uCornerCount);
+			for (uint j = 0; j < run.uCornerCount; j++)
+			{
+				lNormal[j] = m_lNormal[m_lCorner[run.uCornerStart + j].nNormal];
+			}
+		}
+
+		Mesh* pMesh = new Mesh();
+		pMesh->SetName(a_sName + "_" + run.sName + "_" + std::to_string(i));
+		pMesh->SetVertexList(lPosition);
+		if (bUV)
+			pMesh->SetUVList(lUV);
+		if (bNormal)
+			pMesh->SetNormalList(lNormal);
+		else
+			pMesh->CompleteTriangleInfo();
+		if (run.sMaterial != "")
+			pMesh->SetMaterial(run.sMaterial);
+		pMesh->CompileOpenGL3X();
+
+		// Runs of the same group with another material become more meshes of that group
+		Group*& pGroup = groupMap[run.sName];
+		if (pGroup == nullptr)
+		{
+			pGroup = new Group();
+			pGroup->SetName(run.sName);
+			a_pModel->AddGroup(pGroup);
+		}
+		pGroup->AddMesh(pMesh);
+	}
+	return a_pModel->SetName(a_sName);
+}
+
+bool Simplex::MyObjFile::SaveCache(String a_sFileName, MyObjSource const& a_Source)
+{
+	MY_PROFILE_ZONE("MyObjFile::SaveCache");
+
+	// The run records and the strings are written back to back, each string with its 0
+	std::vector<uint> lRun;
+	std::vector<char> lString(m_sMaterialLibrary.c_str(), m_sMaterialLibrary.c_str() + m_sMaterialLibrary.size() + 1);
+	for (MyObjGroup const& run : m_lGroup)
+	{
+		lRun.push_back(run.uCornerStart);
+		lRun.push_back(run.uCornerCount);
+		lString.insert(lString.end(), run.sName.c_str(), run.sName.c_str() + run.sName.size() + 1);
+		lString.insert(lString.end(), run.sMaterial.c_str(), run.sMaterial.c_str() + run.sMaterial.size() + 1);
+	}
+
+	void const* lData[OC_COUNT] = {};
+	MyObjCacheHeader header;
+	header.uVersion = CACHE_VERSION;
+	header.source = a_Source;
+	header.bounds = m_Bounds;
+	header.uGroupCount = static_cast<uint>(m_lGroup.size());
+	header.lSection[OC_POSITION].uSize = m_lPosition.size() * sizeof(vector3);
+	header.lSection[OC_UV].uSize = m_lUV.size() * sizeof(vector3);
+	header.lSection[OC_NORMAL].uSize = m_lNormal.size() * sizeof(vector3);
+	header.lSection[OC_CORNER].uSize = m_lCorner.size() * sizeof(MyObjCorner);
+	header.lSection[OC_GROUP].uSize = lRun.size() * sizeof(uint);
+	header.lSection[OC_STRING].uSize = lString.size();
+	lData[OC_POSITION] = m_lPosition.data();
+	lData[OC_UV] = m_lUV.data();
+	lData[OC_NORMAL] = m_lNormal.data();
+	lData[OC_CORNER] = m_lCorner.data();
+	lData[OC_GROUP] = lRun.data();
+	lData[OC_STRING] = lString.data();
+
+	unsigned long long uOffset = sizeof(MyObjCacheHeader);
+	for (uint i = 0; i < OC_COUNT; i++)
+	{
+		uOffset = (uOffset + CACHE_ALIGNMENT - 1) / CACHE_ALIGNMENT * CACHE_ALIGNMENT;
+		header.lSection[i].uOffset = uOffset;
+		uOffset += header.lSection[i].uSize;
+	}
+
+	FILE* pFile = nullptr;
+	fopen_s(&pFile, a_sFileName.c_str(), "wb");
+	if (pFile == nullptr)
+		return false;
+
+	bool bWritten = fwrite(&header, sizeof(MyObjCacheHeader), 1, pFile) == 1;
+	unsigned long long uWritten = sizeof(MyObjCacheHeader);
+	char const lPadding[CACHE_ALIGNMENT] = {};
+	for (uint i = 0; i < OC_COUNT && bWritten; i++)
+	{
+		size_t uPadding = static_cast<size_t>(header.lSection[i].uOffset - uWritten);
+		size_t uSize = static_cast<size_t>(header.lSection[i].uSize);
+		bWritten = fwrite(lPadding, 1, uPadding, pFile) == uPadding && fwrite(lData[i], 1, uSize, pFile) == uSize;
+		uWritten = header.lSection[i].uOffset + header.lSection[i].uSize;
+	}
+	bWritten = fclose(pFile) == 0 && bWritten;
+	if (!bWritten)
+		remove(a_sFileName.c_str());
+	return bWritten;
+}
+
+bool Simplex::MyObjFile::LoadCache(String a_sFileName, String a_sSourceName, MyObjSource& a_Source)
+{
+	MY_PROFILE_ZONE("MyObjFile::LoadCache");
+	Clear();
+	MyMappedFile file;
+	if (!file.Open(a_sFileName)) { return false; }
+
+	MyObjCacheHeader const* pHeader = file.GetArray<MyObjCacheHeader>(0, 1);
+	MyObjCacheHeader expected;
+	if (pHeader == nullptr || memcmp(pHeader->lMagic, expected.lMagic, sizeof(expected.lMagic)) != 0 ||
+		pHeader->uVersion != CACHE_VERSION || pHeader->source.uSize != a_Source.uSize)
+		return false;
+
+	// A new last write alone does not make the cache stale, the contents decide
+	if (pHeader->source.uTime != a_Source.uTime)
+	{
+		if (!ReadSource(a_sSourceName, true, a_Source) || pHeader->source.uHash != a_Source.uHash)
+			return false;
+	}
+
+	// Every array has to be whole, and every corner and run inside the lists
+	MyFileSection const* pSection = pHeader->lSection;
+	uint uGroupCount = pHeader->uGroupCount;
+	vector3 const* pPosition = file.GetArray<vector3>(static_cast<size_t>(pSection[OC_POSITION].uOffset), static_cast<size_t>(pSection[OC_POSITION].uSize / sizeof(vector3)));
+	vector3 const* pUV = file.GetArray<vector3>(static_cast<size_t>(pSection[OC_UV].uOffset), static_cast<size_t>(pSection[OC_UV].uSize / sizeof(vector3)));
+	vector3 const* pNormal = file.GetArray<vector3>(static_cast<size_t>(pSection[OC_NORMAL].uOffset), static_cast<size_t>(pSection[OC_NORMAL].uSize / sizeof(vector3)));
+	MyObjCorner const* pCorner = file.GetArray<MyObjCorner>(static_cast<size_t>(pSection[OC_CORNER].uOffset), static_cast<size_t>(pSection[OC_CORNER].uSize / sizeof(MyObjCorner)));
+	uint const* pRun = file.GetArray<uint>(static_cast<size_t>(pSection[OC_GROUP].uOffset), uGroupCount * 2ull);
+	char const* pString = file.GetArray<char>(static_cast<size_t>(pSection[OC_STRING].uOffset), static_cast<size_t>(pSection[OC_STRING].uSize));
+	if (pPosition == nullptr || pUV == nullptr || pNormal == nullptr || pCorner == nullptr || pRun == nullptr || pString == nullptr ||
+		pSection[OC_POSITION].uSize % sizeof(vector3) != 0 || pSection[OC_UV].uSize % sizeof(vector3) != 0 ||
+		pSection[OC_NORMAL].uSize % sizeof(vector3) != 0 || pSection[OC_CORNER].uSize % sizeof(MyObjCorner) != 0 ||
+		pSection[OC_GROUP].uSize != uGroupCount * 2ull * sizeof(uint) || uGroupCount == 0)
+		return false;
+
+	m_lPosition.assign(pPosition, pPosition + pSection[OC_POSITION].uSize / sizeof(vector3));
+	m_lUV.assign(pUV, pUV + pSection[OC_UV].uSize / sizeof(vector3));
+	m_lNormal.assign(pNormal, pNormal + pSection[OC_NORMAL].uSize / sizeof(vector3));
+	m_lCorner.assign(pCorner, pCorner + pSection[OC_CORNER].uSize / sizeof(MyObjCorner));
+	int nPositionCount = static_cast<int>(m_lPosition.size());
+	int nUVCount = static_cast<int>(m_lUV.size());
+	int nNormalCount = static_cast<int>(m_lNormal.size());
+	bool bValid = m_lCorner.size() % 3 == 0;
+	for (uint i = 0; i < m_lCorner.size() && bValid; i++)
+	{
+		MyObjCorner const& corner = m_lCorner[i];
+		bValid = corner.nPosition >= 0 && corner.nPosition < nPositionCount && corner.nUV >= -1 && corner.nUV < nUVCount &&
+			corner.nNormal >= -1 && corner.nNormal < nNormalCount;
+	}
+
+	// The runs follow each other from the first corner to the last, each with a name and a material
+	char const* pStringEnd = pString + pSection[OC_STRING].uSize;
+	std::vector<String> lString;
+	while (pString < pStringEnd && lString.size() < uGroupCount * 2ull + 1)
+	{
+		char const* pZero = static_cast<char const*>(memchr(pString, 0, pStringEnd - pString));
+		if (pZero == nullptr) { break; }
+		lString.push_back(String(pString, pZero));
+		pString = pZero + 1;
+	}
+	bValid = bValid && pString == pStringEnd && lString.size() == uGroupCount * 2ull + 1;
+	uint uCornerStart = 0;
+	for (uint i = 0; i < uGroupCount && bValid; i++)
+	{
+		MyObjGroup run;
+		run.uCornerStart = pRun[i * 2];
+		run.uCornerCount = pRun[i * 2 + 1];
+		run.sName = lString[i * 2 + 1];
+		run.sMaterial = lString[i * 2 + 2];
+		bValid = run.uCornerStart == uCornerStart && run.uCornerCount > 0 && run.uCornerCount <= m_lCorner.size() - uCornerStart;
+		uCornerStart += run.uCornerCount;
+		m_lGroup.push_back(run);
+	}
+	if (!bValid || uCornerStart != m_lCorner.size())
+	{
+		Clear();
+		return false;
+	}
+	m_sMaterialLibrary = lString[0];
+	m_Bounds = pHeader->bounds;
+	return true;
+}
+
+bool Simplex::MyObjFile::ReadSource(String a_sFileName, bool a_bHash, MyObjSource& a_Source)
+{
+	WIN32_FILE_ATTRIBUTE_DATA attributes;
+	if (!GetFileAttributesExA(a_sFileName.c_str(), GetFileExInfoStandard, &attributes))
+		return false;
+
+	a_Source.uSize = (static_cast<unsigned long long>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+	a_Source.uTime = (static_cast<unsigned long long>(attributes.ftLastWriteTime.dwHighDateTime) << 32) |
+		attributes.ftLastWriteTime.dwLowDateTime;
+	a_Source.uHash = 0;
+	if (!a_bHash)
+		return true;
+
+	MY_PROFILE_ZONE("MyObjFile::Hash");
+	MyMappedFile file;
+	if (!file.Open(a_sFileName) || file.GetSize() != a_Source.uSize)
+		return false;
+	a_Source.uHash = Hash(file.GetData(), file.GetSize());
+	return true;
+}
+
+bool Simplex::MyObjFile::Read(String a_sFileName, String& a_sName, String& a_sFolder)
+{
+	MY_PROFILE_ZONE("MyObjFile::Read");
+	Clear();
+	size_t uLength = a_sFileName.size();
+	bool bObj = m_bFastPath && uLength > 4 && a_sFileName[uLength - 4] == '.' &&
+		tolower(a_sFileName[uLength - 3]) == 'o' && tolower(a_sFileName[uLength - 2]) == 'b' && tolower(a_sFileName[uLength - 1]) == 'j';
+	if (!bObj)
+		return false;
+
+	// The file is looked for where the model looks for it, then as given
+	Folder* pFolder = Folder::GetInstance();
+	String sPath = pFolder->GetFolderRoot() + pFolder->GetFolderData() + pFolder->GetFolderMOBJ() + a_sFileName;
+	MyObjSource source;
+	if (!ReadSource(sPath, false, source) && !ReadSource(sPath = a_sFileName, false, source))
+		return false;
+
+	// The cache is read if it was made from this very file, else the file is parsed and the cache made anew; a
+	// cache that only had an old last write is rewritten so the next load does not hash the file again
+	String sCache = sPath + ".cache";
+	bool bCached = m_bCache && LoadCache(sCache, sPath, source);
+	if (bCached && source.uHash != 0)
+		SaveCache(sCache, source);
+	if (!bCached)
+	{
+		if (!Load(sPath) || m_lGroup.empty())
+		{
+			Clear();
+			return false;
+		}
+		if (m_bCache && ReadSource(sPath, true, source))
+			SaveCache(sCache, source);
+	}
+
+	size_t uSlash = a_sFileName.find_last_of("\\/");
+	a_sName = a_sFileName.substr(uSlash == String::npos ? 0 : uSlash + 1, a_sFileName.size() - (uSlash == String::npos ? 0 : uSlash + 1) - 4);
+	size_t uFolder = sPath.find_last_of("\\/");
+	a_sFolder = uFolder == String::npos ? "" : sPath.substr(0, uFolder + 1);
+	return true;
+}
+
+String Simplex::MyObjFile::LoadModel(Model* a_pModel, String a_sFileName, MyObjBounds* a_pBounds)
+{
+	MyObjFile file;
+	String sName = "";
+	String sFolder = "";
+	if (!file.Read(a_sFileName, sName, sFolder))
+		return a_pModel->Load(a_sFileName);
+
+	if (a_pBounds != nullptr)
+		*a_pBounds = file.GetBounds();
+	return file.MakeModel(a_pModel, sName, sFolder);
+}
+
+void Simplex::MyObjFile::SetFastPath(bool a_bFastPath)
+{
+	m_bFastPath = a_bFastPath;
+}
+
+bool Simplex::MyObjFile::GetFastPath(void)
+{
+	return m_bFastPath;
+}
+
+void Simplex::MyObjFile::SetCache(bool a_bCache)
+{
+	m_bCache = a_bCache;
+}
+
+bool Simplex::MyObjFile::GetCache(void)
+{
+	return m_bCache;
+}
+
+std::vector<vector3> const& Simplex::MyObjFile::GetPositionList(void)
+{
+	return m_lPosition;
+}
+
+std::vector<vector3> const& Simplex::MyObjFile::GetUVList(void)
+{
+	return m_lUV;
+}
+
+std::vector<vector3> const& Simplex::MyObjFile::GetNormalList(void)
+{
+	return m_lNormal;
+}
+
+std::vector<MyObjCorner> const& Simplex::MyObjFile::GetCornerList(void)
+{
+	return m_lCorner;
+}
+
+std::vector<MyObjGroup> const& Simplex::MyObjFile::GetGroupList(void)
+{
+	return m_lGroup;
+}
+
+String Simplex::MyObjFile::GetMaterialLibrary(void)
+{
+	return m_sMaterialLibrary;
+}
+
+MyObjBounds Simplex::MyObjFile::GetBounds(void)
+{
+	return m_Bounds;
+}
+
+void Simplex::MyObjFile::ParseChunk(char const* a_pStart, char const* a_pEnd, Chunk& a_Chunk)
+{
+	char const* pCursor = a_pStart;
+	while (pCursor < a_pEnd)
+	{
+		char const* pLineEnd = static_cast<char const*>(memchr(pCursor, '\n', a_pEnd - pCursor));
+		if (pLineEnd == nullptr)
+			pLineEnd = a_pEnd;
+		while (pCursor < pLineEnd && IsBlank(*pCursor))
+		{
+			++pCursor;
+		}
+
+		// Vertices and faces are nearly every line, the rest are told apart by their whole keyword
+		if (IsKeyword(pCursor, pLineEnd, "v", 1))
+			a_Chunk.lPosition.push_back(ParseVector(pCursor + 1, pLineEnd));
+		else if (IsKeyword(pCursor, pLineEnd, "vt", 2))
+			a_Chunk.lUV.push_back(ParseVector(pCursor + 2, pLineEnd));
+		else if (IsKeyword(pCursor, pLineEnd, "vn", 2))
+			a_Chunk.lNormal.push_back(ParseVector(pCursor + 2, pLineEnd));
+		else if (IsKeyword(pCursor, pLineEnd, "f", 1))
+			ParseFace(pCursor + 1, pLineEnd, a_Chunk);
+		else if (IsKeyword(pCursor, pLineEnd, "g", 1) || IsKeyword(pCursor, pLineEnd, "o", 1))
+			a_Chunk.lGroupSwitch.push_back(std::make_pair(static_cast<uint>(a_Chunk.lCorner.size()), ParseName(pCursor + 1, pLineEnd)));
+		else if (IsKeyword(pCursor, pLineEnd, "usemtl", 6))
+			a_Chunk.lMaterialSwitch.push_back(std::make_pair(static_cast<uint>(a_Chunk.lCorner.size()), ParseName(pCursor + 6, pLineEnd)));
+		else if (IsKeyword(pCursor, pLineEnd, "mtllib", 6) && a_Chunk.sMaterialLibrary == "")
+			a_Chunk.sMaterialLibrary = ParseName(pCursor + 6, pLineEnd);
+
+		pCursor = pLineEnd + 1;
+	}
+}
+
+void Simplex::MyObjFile::ParseFace(char const* a_pCursor, char const* a_pEnd, Chunk& a_Chunk)
+{
+	// Positive indices count from the start of the file, negative ones back from the last entry read so far
+	int lCount[3] = { static_cast<int>(a_Chunk.lPosition.size()), static_cast<int>(a_Chunk.lUV.size()),
+		static_cast<int>(a_Chunk.lNormal.size()) };
+	MyObjCorner first;
+	MyObjCorner previous;
+	uint8_t uFirstRelative = 0;
+	uint8_t uPreviousRelative = 0;
+	uint uCorner = 0;
+	char const* pCursor = a_pCursor;
+	while (true)
+	{
+		while (pCursor < a_pEnd && IsBlank(*pCursor))
+		{
+			++pCursor;
+		}
+		if (pCursor == a_pEnd)
+			break;
+
+		int lIndex[3] = { ParseIndex(pCursor, a_pEnd), 0, 0 };
+		bool lGiven[3] = { true, false, false };
+		if (pCursor < a_pEnd && *pCursor == '/')
+		{
+			++pCursor;
+			if (pCursor < a_pEnd && *pCursor != '/')
+			{
+				lIndex[1] = ParseIndex(pCursor, a_pEnd);
+				lGiven[1] = true;
+			}
+			if (pCursor < a_pEnd && *pCursor == '/')
+			{
+				++pCursor;
+				lIndex[2] = ParseIndex(pCursor, a_pEnd);
+				lGiven[2] = true;
+			}
+		}
+		// Anything else in the token is skipped
+		while (pCursor < a_pEnd && !IsBlank(*pCursor))
+		{
+			++pCursor;
+		}
+
+		int lResolved[3] = { -1, -1, -1 };
+		uint8_t uRelative = 0;
+		for (uint i = 0; i < 3; i++)
+		{
+			if (!lGiven[i])
+				continue;
+			if (lIndex[i] == 0)
+			{
+				a_Chunk.bValid = false;
+				return;
+			}
+			if (lIndex[i] > 0)
+				lResolved[i] = lIndex[i] - 1;
+			else
+			{
+				lResolved[i] = lCount[i] + lIndex[i];
+				uRelative |= 1 << i;
+			}
+		}
+		MyObjCorner corner;
+		corner.nPosition = lResolved[0];
+		corner.nUV = lResolved[1];
+		corner.nNormal = lResolved[2];
+
+		if (uCorner == 0)
+		{
+			first = corner;
+			uFirstRelative = uRelative;
+		}
+		else if (uCorner >= 2)
+		{
+			a_Chunk.lCorner.push_back(first);
+			a_Chunk.lCorner.push_back(previous);
+			a_Chunk.lCorner.push_back(corner);
+			a_Chunk.lRelative.push_back(uFirstRelative);
+			a_Chunk.lRelative.push_back(uPreviousRelative);
+			a_Chunk.lRelative.push_back(uRelative);
+		}
+		previous = corner;
+		uPreviousRelative = uRelative;
+		++uCorner;
+	}
+}
+
+vector3 Simplex::MyObjFile::ParseVector(char const* a_pCursor, char const* a_pEnd)
+{
+	vector3 v3Result(0.0f);
+	char const* pCursor = a_pCursor;
+	for (uint i = 0; i < 3; i++)
+	{
+		while (pCursor < a_pEnd && IsBlank(*pCursor))
+		{
+			++pCursor;
+		}
+		if (pCursor == a_pEnd)
+			break;
+		v3Result[i] = ParseFloat(pCursor, a_pEnd);
+	}
+	return v3Result;
+}
+
+float Simplex::MyObjFile::ParseFloat(char const*& a_pCursor, char const* a_pEnd)
+{
+	char const* pCursor = a_pCursor;
+	bool bNegative = false;
+	if (pCursor < a_pEnd && (*pCursor == '-' || *pCursor == '+'))
+	{
+		bNegative = *pCursor == '-';
+		++pCursor;
+	}
+
+	// Up to 19 significant digits fit in the mantissa, the ones past them only move the exponent
+	unsigned long long uMantissa = 0;
+	int nExponent = 0;
+	uint uSignificant = 0;
+	bool bDigits = false;
+	for (; pCursor < a_pEnd && IsDigit(*pCursor); ++pCursor)
+	{
+		bDigits = true;
+		if (uSignificant < 19)
+		{
+			uMantissa = uMantissa * 10 + (*pCursor - '0');
+			uSignificant += uMantissa > 0 ? 1 : 0;
+		}
+		else
+			++nExponent;
+	}
+	if (pCursor < a_pEnd && *pCursor == '.')
+	{
+		for (++pCursor; pCursor < a_pEnd && IsDigit(*pCursor); ++pCursor)
+		{
+			bDigits = true;
+			if (uSignificant < 19)
+			{
+				uMantissa = uMantissa * 10 + (*pCursor - '0');
+				uSignificant += uMantissa > 0 ? 1 : 0;
+				--nExponent;
+			}
+		}
+	}
+	if (!bDigits)
+	{
+		a_pCursor = pCursor;
+		return 0.0f;
+	}
+	if (pCursor < a_pEnd && (*pCursor == 'e' || *pCursor == 'E'))
+	{
+		char const* pExponent = pCursor + 1;
+		bool bExponentNegative = false;
+		if (pExponent < a_pEnd && (*pExponent == '-' || *pExponent == '+'))
+		{
+			bExponentNegative = *pExponent == '-';
+			++pExponent;
+		}
+		if (pExponent < a_pEnd && IsDigit(*pExponent))
+		{
+			int nValue = 0;
+			for (; pExponent < a_pEnd && IsDigit(*pExponent); ++pExponent)
+			{
+				nValue = std::min(nValue * 10 + (*pExponent - '0'), 9999);
+			}
+			nExponent += bExponentNegative ? -nValue : nValue;
+			pCursor = pExponent;
+		}
+	}
+	a_pCursor = pCursor;
+
+	// Powers of ten a double holds exactly, the rest go through pow
+	static double const POW10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+		1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+	double dValue = static_cast<double>(uMantissa);
+	if (nExponent < 0)
+		dValue = -nExponent <= 22 ? dValue / POW10[-nExponent] : dValue * std::pow(10.0, nExponent);
+	else if (nExponent > 0)
+		dValue = nExponent <= 22 ? dValue * POW10[nExponent] : dValue * std::pow(10.0, nExponent);
+	return static_cast<float>(bNegative ? -dValue : dValue);
+}
+
+int Simplex::MyObjFile::ParseIndex(char const*& a_pCursor, char const* a_pEnd)
+{
+	char const* pCursor = a_pCursor;
+	bool bNegative = false;
+	if (pCursor < a_pEnd && (*pCursor == '-' || *pCursor == '+'))
+	{
+		bNegative = *pCursor == '-';
+		++pCursor;
+	}
+	long long nValue = 0;
+	for (; pCursor < a_pEnd && IsDigit(*pCursor); ++pCursor)
+	{
+		nValue = std::min(nValue * 10 + (*pCursor - '0'), 0x7FFFFFFFll);
+	}
+	a_pCursor = pCursor;
+	return static_cast<int>(bNegative ? -nValue : nValue);
+}
+
+String Simplex::MyObjFile::ParseName(char const* a_pCursor, char const* a_pEnd)
+{
+	char const* pStart = a_pCursor;
+	char const* pEnd = a_pEnd;
+	while (pStart < pEnd && IsBlank(*pStart))
+	{
+		++pStart;
+	}
+	while (pEnd > pStart && IsBlank(pEnd[-1]))
+	{
+		--pEnd;
+	}
+	return String(pStart, pEnd);
+}
+
+bool Simplex::MyObjFile::MergeChunk(Chunk const& a_Chunk, MyObjCorner a_Offset, uint a_uCornerStart)
+{
+	std::copy(a_Chunk.lPosition.begin(), a_Chunk.lPosition.end(), m_lPosition.begin() + a_Offset.nPosition);
+	std::copy(a_Chunk.lUV.begin(), a_Chunk.lUV.end(), m_lUV.begin() + a_Offset.nUV);
+	std::copy(a_Chunk.lNormal.begin(), a_Chunk.lNormal.end(), m_lNormal.begin() + a_Offset.nNormal);
+
+	int nPositionCount = static_cast<int>(m_lPosition.size());
+	int nUVCount = static_cast<int>(m_lUV.size());
+	int nNormalCount = static_cast<int>(m_lNormal.size());
+	bool bValid = true;
+	for (uint i = 0; i < a_Chunk.lCorner.size(); i++)
+	{
+		MyObjCorner corner = a_Chunk.lCorner[i];
+		uint8_t uRelative = a_Chunk.lRelative[i];
+		if (uRelative & 1) { corner.nPosition += a_Offset.nPosition; }
+		if (uRelative & 2) { corner.nUV += a_Offset.nUV; }
+		if (uRelative & 4) { corner.nNormal += a_Offset.nNormal; }
+		bValid = bValid && corner.nPosition >= 0 && corner.nPosition < nPositionCount && corner.nUV < nUVCount &&
+			corner.nNormal < nNormalCount && ((uRelative & 2) == 0 || corner.nUV >= 0) && ((uRelative & 4) == 0 || corner.nNormal >= 0);
+		m_lCorner[a_uCornerStart + i] = corner;
+	}
+	return bValid;
+}
+
+bool Simplex::MyObjFile::IsBlank(char a_cCharacter)
+{
+	return a_cCharacter == ' ' || a_cCharacter == '\t' || a_cCharacter == '\r';
+}
+
+bool Simplex::MyObjFile::IsDigit(char a_cCharacter)
+{
+	return a_cCharacter >= '0' && a_cCharacter <= '9';
+}
+
+bool Simplex::MyObjFile::IsKeyword(char const* a_pCursor, char const* a_pEnd, char const* a_sKeyword, size_t a_uLength)
+{
+	return static_cast<size_t>(a_pEnd - a_pCursor) >= a_uLength && memcmp(a_pCursor, a_sKeyword, a_uLength) == 0 &&
+		(a_pCursor + a_uLength == a_pEnd || IsBlank(a_pCursor[a_uLength]));
+}
+
+void Simplex::MyObjFile::ComputeBounds(void)
+{
+	m_Bounds = MyObjBounds();
+	if (m_lCorner.empty()) { return; }
+
+	// Only the positions the faces use count, like the vertices of the meshes made from them
+	m_Bounds.v3Min = m_Bounds.v3Max = m_lPosition[m_lCorner[0].nPosition];
+	for (MyObjCorner const& corner : m_lCorner)
+	{
+		vector3 const& v3Position = m_lPosition[corner.nPosition];
+		m_Bounds.v3Min = glm::min(m_Bounds.v3Min, v3Position);
+		m_Bounds.v3Max = glm::max(m_Bounds.v3Max, v3Position);
+	}
+	m_Bounds.v3Center = (m_Bounds.v3Min + m_Bounds.v3Max) / 2.0f;
+	m_Bounds.fRadius = glm::distance(m_Bounds.v3Center, m_Bounds.v3Min);
+	m_Bounds.bValid = true;
+}
+
+void Simplex::MyObjFile::Clear(void)
+{
+	m_lPosition.clear();
+	m_lUV.clear();
+	m_lNormal.clear();
+	m_lCorner.clear();
+	m_lGroup.clear();
+	m_sMaterialLibrary = "";
+	m_Bounds = MyObjBounds();
+}
+
+unsigned long long Simplex::MyObjFile::Hash(char const* a_pData, size_t a_uSize)
+{
+	// Eight bytes are folded in per step, the bytes left at the end one at a time
+	unsigned long long uHash = 14695981039346656037ull;
+	size_t uWords = a_uSize / sizeof(unsigned long long);
+	for (size_t i = 0; i < uWords; i++)
+	{
+		unsigned long long uWord;
+		memcpy(&uWord, a_pData + i * sizeof(unsigned long long), sizeof(unsigned long long));
+		uHash = (uHash ^ uWord) * 1099511628211ull;
+	}
+	for (size_t i = uWords * sizeof(unsigned long long); i < a_uSize; i++)
+	{
+		uHash = (uHash ^ static_cast<unsigned char>(a_pData[i])) * 1099511628211ull;
+	}
+	return uHash != 0 ? uHash : 1;
+}
@@ -0,0 +1,392 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYOBJFILE_H_
+#define __MYOBJFILE_H_
+
+#include "MyMappedFile.h"
+
+namespace Simplex
+{
+	// Corner of a triangle, entries of the lists of the file counted from 0, -1 where the face left them out
+	struct MyObjCorner
+	{
+		int nPosition = -1;
+		int nUV = -1;
+		int nNormal = -1;
+	};
+
+	// Run of triangles that share a group and a material
+	struct MyObjGroup
+	{
+		String sName = "";
+		String sMaterial = ""; // empty if no usemtl came before them
+		uint uCornerStart = 0; // first corner of the run, three per triangle
+		uint uCornerCount = 0;
+	};
+
+	// Box and sphere around the vertices the faces use, in the space of the file
+	struct MyObjBounds
+	{
+		vector3 v3Min = ZERO_V3;
+		vector3 v3Max = ZERO_V3;
+		vector3 v3Center = ZERO_V3; // middle of the box, where the rigid body puts the center of its sphere
+		float fRadius = 0.0f; // from the center to a corner of the box
+		bool bValid = false; // false until a file with faces was read
+	};
+
+	// What a cache remembers of the OBJ file it was made from
+	struct MyObjSource
+	{
+		unsigned long long uSize = 0; // bytes in the file
+		unsigned long long uTime = 0; // last write, in FILETIME ticks
+		unsigned long long uHash = 0; // hash of the contents, 0 if it was not computed
+	};
+
+	// Arrays of a model cache
+	enum MY_OBJ_CACHE_SECTION
+	{
+		OC_POSITION = 0, // vector3
+		OC_UV = 1, // vector3
+		OC_NORMAL = 2, // vector3
+		OC_CORNER = 3, // MyObjCorner
+		OC_GROUP = 4, // first corner then corner count of each run, 2 uint
+		OC_STRING = 5, // material library, then name and material of each run, each ending with a 0
+		OC_COUNT = 6
+	};
+
+	// First bytes of a model cache, the arrays follow it at the offsets of the section table
+	struct MyObjCacheHeader
+	{
+		char lMagic[4] = { 'M', 'Y', 'O', 'C' };
+		uint uVersion = 0;
+		MyObjSource source;
+		MyObjBounds bounds;
+		uint uGroupCount = 0;
+		MyFileSection lSection[OC_COUNT];
+	};
+
+	// OBJ file parsed straight from its mapping; the file is cut in chunks at line ends that are parsed in parallel,
+	// then merged into the lists of the whole file. Only v, vt, vn, f, g, o, usemtl and mtllib are read
+	class MyObjFile
+	{
+		static constexpr size_t MIN_CHUNK = 1 << 20; // bytes a thread gets at the least, smaller files use fewer threads
+		static bool m_bFastPath; // does LoadModel parse OBJ files here instead of in the model?
+		static bool m_bCache; // does LoadModel keep a binary cache next to the OBJ files it parses?
+		static constexpr uint CACHE_VERSION = 1; // bumped whenever the layout changes, other versions are remade
+		static constexpr uint CACHE_ALIGNMENT = 16;
+
+		std::vector<vector3> m_lPosition;
+		std::vector<vector3> m_lUV; // z is 0 unless the file gave a third coordinate
+		std::vector<vector3> m_lNormal;
+		std::vector<MyObjCorner> m_lCorner; // triangles, polygons are split in fans
+		std::vector<MyObjGroup> m_lGroup;
+		String m_sMaterialLibrary = ""; // first mtllib of the file
+		MyObjBounds m_Bounds;
+
+		// What a thread got out of its chunk; indices relative to the end of a list are fixed once the chunks
+		// before it are counted
+		struct Chunk
+		{
+			std::vector<vector3> lPosition;
+			std::vector<vector3> lUV;
+			std::vector<vector3> lNormal;
+			std::vector<MyObjCorner> lCorner;
+			std::vector<uint8_t> lRelative; // per corner, bit 0 position, bit 1 uv and bit 2 normal counted from the chunk
+			std::vector<std::pair<uint, String>> lGroupSwitch; // corner at which a g or o line named the group
+			std::vector<std::pair<uint, String>> lMaterialSwitch; // corner at which a usemtl line named the material
+			String sMaterialLibrary = "";
+			bool bValid = true; // false if a face used index 0
+		};
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyObjFile(void);
+
+		/*
+		USAGE: Destructor
+		*/
+		~MyObjFile(void);
+
+		/*
+		USAGE: Parses a file, replacing what was parsed before
+		ARGUMENTS:
+		- String a_sFileName -> path of the file
+		- uint a_uThreadCount = 0 -> threads to parse with, 0 for one per core
+		OUTPUT: was it read? faces pointing past the lists fail it
+		*/
+		bool Load(String a_sFileName, uint a_uThreadCount = 0);
+
+		/*
+		USAGE: Parses OBJ text already in memory, replacing what was parsed before
+		ARGUMENTS:
+		- char const* a_pData -> first character
+		- size_t a_uSize -> characters in the text
+		- uint a_uThreadCount = 0 -> threads to parse with, 0 for one per core
+		OUTPUT: was it read?
+		*/
+		bool Parse(char const* a_pData, size_t a_uSize, uint a_uThreadCount = 0);
+
+		/*
+		USAGE: Makes a mesh per run of triangles and a group per group name in the model, like the model does when
+		it loads the file itself
+		ARGUMENTS:
+		- Model* a_pModel -> empty model to fill
+		- String a_sName -> name to give the model
+		- String a_sFolder -> folder of the file, the material library is read from it
+		OUTPUT: name the model got
+		*/
+		String MakeModel(Model* a_pModel, String a_sName, String a_sFolder);
+
+		/*
+		USAGE: Writes what was parsed to a cache that LoadCache reads back without parsing
+		ARGUMENTS:
+		- String a_sFileName -> cache to write
+		- MyObjSource const& a_Source -> OBJ file it was parsed from, with its hash
+		OUTPUT: was it written?
+		*/
+		bool SaveCache(String a_sFileName, MyObjSource const& a_Source);
+
+		/*
+		USAGE: Reads a cache in place of the OBJ file it was made from, replacing what was parsed before. A cache
+		whose source has the same size and last write is taken as is; if only the last write changed the source is
+		hashed and the cache is still taken if the contents are the same
+		ARGUMENTS:
+		- String a_sFileName -> cache to read
+		- String a_sSourceName -> OBJ file the cache has to match
+		- MyObjSource& a_Source -> size and last write of the source, its hash is filled in if it had to be computed
+		OUTPUT: was the cache valid and made from that source?
+		*/
+		bool LoadCache(String a_sFileName, String a_sSourceName, MyObjSource& a_Source);
+
+		/*
+		USAGE: Gets the size and last write of a file, and optionally the hash of its contents
+		ARGUMENTS:
+		- String a_sFileName -> file to look at
+		- bool a_bHash -> read the whole file to hash it?
+		- MyObjSource& a_Source -> filled with what was read
+		OUTPUT: does the file exist?
+		*/
+		static bool ReadSource(String a_sFileName, bool a_bHash, MyObjSource& a_Source);
+
+		/*
+		USAGE: Reads an OBJ file like LoadModel does, from its cache or by parsing it and making the cache, but
+		leaves the model alone so it can run on any thread; MakeModel then needs the OpenGL context
+		ARGUMENTS:
+		- String a_sFileName -> file as Model::Load takes it, inside the OBJ folder of the data
+		- String& a_sName -> name to give the model, the file name without folder and extension
+		- String& a_sFolder -> folder the file was found in, for MakeModel
+		OUTPUT: was it read? files that are not OBJ, or any file while the fast path is off, are left to the model
+		*/
+		bool Read(String a_sFileName, String& a_sName, String& a_sFolder);
+
+		/*
+		USAGE: Loads a model file, OBJ files are parsed here when the fast path is on and every other file, or an
+		OBJ the parser refuses, goes to the model. With the cache on, a parsed OBJ leaves a .cache file next to it
+		that later loads read instead while the OBJ stays the same
+		ARGUMENTS:
+		- Model* a_pModel -> empty model to fill
+		- String a_sFileName -> file as Model::Load takes it, inside the OBJ folder of the data
+		- MyObjBounds* a_pBounds = nullptr -> filled with the bounds of the vertices if the model was made here
+		OUTPUT: name the model got, empty if it could not be loaded
+		*/
+		static String LoadModel(Model* a_pModel, String a_sFileName, MyObjBounds* a_pBounds = nullptr);
+
+		/*
+		USAGE: Sets whether LoadModel parses OBJ files here
+		ARGUMENTS:
+		- bool a_bFastPath -> parse them here?
+		*/
+		static void SetFastPath(bool a_bFastPath);
+
+		/*
+		USAGE: Asks whether LoadModel parses OBJ files here
+		OUTPUT: does it?
+		*/
+		static bool GetFastPath(void);
+
+		/*
+		USAGE: Sets whether LoadModel keeps a binary cache of the OBJ files it parses
+		ARGUMENTS:
+		- bool a_bCache -> keep one?
+		*/
+		static void SetCache(bool a_bCache);
+
+		/*
+		USAGE: Asks whether LoadModel keeps a binary cache of the OBJ files it parses
+		OUTPUT: does it?
+		*/
+		static bool GetCache(void);
+
+		/*
+		USAGE: Gets the positions of the file
+		OUTPUT: positions in the order of the file
+		*/
+		std::vector<vector3> const& GetPositionList(void);
+
+		/*
+		USAGE: Gets the texture coordinates of the file
+		OUTPUT: coordinates in the order of the file
+		*/
+		std::vector<vector3> const& GetUVList(void);
+
+		/*
+		USAGE: Gets the normals of the file
+		OUTPUT: normals in the order of the file
+		*/
+		std::vector<vector3> const& GetNormalList(void);
+
+		/*
+		USAGE: Gets the corners of the triangles
+		OUTPUT: three corners per triangle
+		*/
+		std::vector<MyObjCorner> const& GetCornerList(void);
+
+		/*
+		USAGE: Gets the runs of triangles sharing a group and a material
+		OUTPUT: runs in the order of the file
+		*/
+		std::vector<MyObjGroup> const& GetGroupList(void);
+
+		/*
+		USAGE: Gets the material library named by the file
+		OUTPUT: file name, empty if there was none
+		*/
+		String GetMaterialLibrary(void);
+
+		/*
+		USAGE: Gets the box and sphere around the vertices the faces use
+		OUTPUT: bounds, not valid if there were no faces
+		*/
+		MyObjBounds GetBounds(void);
+
+	private:
+		/*
+		USAGE: Parses the lines of a chunk
+		ARGUMENTS:
+		- char const* a_pStart -> first character of the chunk, at the start of a line
+		- char const* a_pEnd -> past the last character, at the end of a line
+		- Chunk& a_Chunk -> lists to fill
+		*/
+		static void ParseChunk(char const* a_pStart, char const* a_pEnd, Chunk& a_Chunk);
+
+		/*
+		USAGE: Parses a face, its polygon is split in a fan of triangles
+		ARGUMENTS:
+		- char const* a_pCursor -> first character after the f
+		- char const* a_pEnd -> end of the line
+		- Chunk& a_Chunk -> lists to add the triangles to
+		*/
+		static void ParseFace(char const* a_pCursor, char const* a_pEnd, Chunk& a_Chunk);
+
+		/*
+		USAGE: Parses up to three numbers separated by blanks
+		ARGUMENTS:
+		- char const* a_pCursor -> first character after the keyword
+		- char const* a_pEnd -> end of the line
+		OUTPUT: numbers read, 0 for the ones missing
+		*/
+		static vector3 ParseVector(char const* a_pCursor, char const* a_pEnd);
+
+		/*
+		USAGE: Parses a decimal number with an optional sign, fraction and exponent, without going through the
+		locale like strtof does
+		ARGUMENTS:
+		- char const*& a_pCursor -> first character, left past the number
+		- char const* a_pEnd -> end of the line
+		OUTPUT: number read, 0 if there were no digits
+		*/
+		static float ParseFloat(char const*& a_pCursor, char const* a_pEnd);
+
+		/*
+		USAGE: Parses an index of a face
+		ARGUMENTS:
+		- char const*& a_pCursor -> first character, left past the index
+		- char const* a_pEnd -> end of the line
+		OUTPUT: index as written, 0 if there were no digits
+		*/
+		static int ParseIndex(char const*& a_pCursor, char const* a_pEnd);
+
+		/*
+		USAGE: Gets the rest of a line without the blanks around it
+		ARGUMENTS:
+		- char const* a_pCursor -> first character after the keyword
+		- char const* a_pEnd -> end of the line
+		OUTPUT: text of the line
+		*/
+		static String ParseName(char const* a_pCursor, char const* a_pEnd);
+
+		/*
+		USAGE: Asks if a character separates the words of a line, the \r of Windows line ends included
+		ARGUMENTS:
+		- char a_cCharacter -> character to look at
+		OUTPUT: is it blank?
+		*/
+		static bool IsBlank(char a_cCharacter);
+
+		/*
+		USAGE: Asks if a character is a decimal digit
+		ARGUMENTS:
+		- char a_cCharacter -> character to look at
+		OUTPUT: is it a digit?
+		*/
+		static bool IsDigit(char a_cCharacter);
+
+		/*
+		USAGE: Asks if a line starts with a keyword followed by a blank or nothing
+		ARGUMENTS:
+		- char const* a_pCursor -> first character of the line past the blanks
+		- char const* a_pEnd -> end of the line
+		- char const* a_sKeyword -> keyword looked for
+		- size_t a_uLength -> characters in the keyword
+		OUTPUT: is it that keyword?
+		*/
+		static bool IsKeyword(char const* a_pCursor, char const* a_pEnd, char const* a_sKeyword, size_t a_uLength);
+
+		/*
+		USAGE: Copies a chunk to its place in the lists of the file and fixes its relative indices
+		ARGUMENTS:
+		- Chunk const& a_Chunk -> parsed chunk
+		- MyObjCorner a_Offset -> entries of each list in the chunks before it
+		- uint a_uCornerStart -> first corner of the chunk in the file
+		OUTPUT: do the corners point inside the lists?
+		*/
+		bool MergeChunk(Chunk const& a_Chunk, MyObjCorner a_Offset, uint a_uCornerStart);
+
+		/*
+		USAGE: Computes the bounds from the corners
+		*/
+		void ComputeBounds(void);
+
+		/*
+		USAGE: Empties the lists
+		*/
+		void Clear(void);
+
+		/*
+		USAGE: Hashes bytes with 64 bit FNV-1a, taken a word at a time
+		ARGUMENTS:
+		- char const* a_pData -> first byte
+		- size_t a_uSize -> bytes to hash
+		OUTPUT: hash, never 0
+		*/
+		static unsigned long long Hash(char const* a_pData, size_t a_uSize);
+
+		/*
+		USAGE: Copy constructor
+		*/
+		MyObjFile(MyObjFile const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyObjFile& operator=(MyObjFile const& a_pOther);
+	};
+}
+
+#endif //__MYOBJFILE_H_
@@ -6,11 +6,6 @@ Date: 08/2023
 #include "MyOctant.h"
 using namespace Simplex;
 
-// Static variables
-uint MyOctant::m_uOctantCount = 0;
-uint MyOctant::m_uMaxLevel = 0;
-uint MyOctant::m_uIdealEntityCount = 0;
-
 MyOctant::MyOctant(uint a_nMaxLevel, uint a_nIdealEntityCount)
 {
 	Init();
@@ -48,11 +43,42 @@ MyOctant::MyOctant(uint a_nMaxLevel, uint a_nIdealEntityCount)
 	ConstructTree(m_uMaxLevel); // Make the tree from the passed level
 }
 
-Simplex::MyOctant::MyOctant(vector3 a_v3Center, float a_fSize)
+Simplex::MyOctant::MyOctant(std::vector<vector3> const* a_pMinList, std::vector<vector3> const* a_pMaxList, uint a_nMaxLevel, uint a_nIdealEntityCount,
+	bool a_bBuild)
 {
 	Init();
 
+	m_uID = m_uOctantCount;
+	m_pRoot = this;
 	m_uOctantCount++;
+	m_uIdealEntityCount = a_nIdealEntityCount;
+	m_uMaxLevel = a_nMaxLevel;
+	m_pMinList = a_pMinList;
+	m_pMaxList = a_pMaxList;
+
+	// Box around every entity, straight from the lists so nothing is read from the entity manager
+	vector3 sceneMin = ZERO_V3;
+	vector3 sceneMax = ZERO_V3;
+	for (uint i = 0; i < m_pMinList->size(); i++)
+	{
+		sceneMin = i == 0 ? (*m_pMinList)[i] : glm::min(sceneMin, (*m_pMinList)[i]);
+		sceneMax = i == 0 ? (*m_pMaxList)[i] : glm::max(sceneMax, (*m_pMaxList)[i]);
+	}
+
+	// Same cube as the other root, centered on the box and as wide as its widest side
+	m_v3Center = (sceneMin + sceneMax) / 2.0f;
+	vector3 halfWidth = (sceneMax - sceneMin) / 2.0f;
+	float hwMax = std::max({ halfWidth.x, halfWidth.y, halfWidth.z });
+	m_fSize = hwMax * 2.0f;
+	m_v3Min = m_v3Center - vector3(hwMax);
+	m_v3Max = m_v3Center + vector3(hwMax);
+
+	if (a_bBuild) { BuildTree(m_uMaxLevel); }
+}
+
+Simplex::MyOctant::MyOctant(vector3 a_v3Center, float a_fSize)
+{
+	Init();
 
 	m_v3Center = a_v3Center;
 	m_fSize = a_fSize;
@@ -62,6 +88,20 @@ Simplex::MyOctant::MyOctant(vector3 a_v3Center, float a_fSize)
 	m_v3Max = m_v3Center + (vector3(m_fSize) / 2.0f);
 }
 
+Simplex::MyOctant::MyOctant(MyOctantRecord const* a_pRecordList, uint const* a_pEntityList, uint a_nOctantCount, uint a_nMaxLevel, uint a_nIdealEntityCount)
+{
+	Init();
+
+	m_pRoot = this;
+	m_uOctantCount = a_nOctantCount;
+	m_uIdealEntityCount = a_nIdealEntityCount;
+	m_uMaxLevel = a_nMaxLevel;
+
+	MyOctantRecord const* pRecord = a_pRecordList;
+	ReadRecord(pRecord, a_pEntityList);
+	ConstructList();
+}
+
 Simplex::MyOctant::MyOctant(MyOctant const & other)
 {
 	m_pRoot, other.m_pRoot;
@@ -77,6 +117,15 @@ Simplex::MyOctant::MyOctant(MyOctant const & other)
 	m_lChild, other.m_lChild;
 	m_uNumChildren = other.m_uNumChildren;
 
+	m_eSplit = other.m_eSplit;
+	m_fSplitSaving = other.m_fSplitSaving;
+
+	m_uOctantCount = other.m_uOctantCount;
+	m_uMaxLevel = other.m_uMaxLevel;
+	m_uIdealEntityCount = other.m_uIdealEntityCount;
+	m_pMinList = other.m_pMinList;
+	m_pMaxList = other.m_pMaxList;
+
 	m_pMeshMngr = MeshManager::GetInstance();
 	m_pEntityMngr = MyEntityManager::GetInstance();
 }
@@ -97,6 +146,7 @@ MyOctant & Simplex::MyOctant::operator=(MyOctant const & other)
 		MyOctant toSwap(other);
 		Swap(toSwap); 
 	}
+	return *this;
 }
 
 Simplex::MyOctant::~MyOctant(void)
@@ -120,6 +170,15 @@ void Simplex::MyOctant::Swap(MyOctant & other)
 	std::swap(m_pChild, other.m_pChild);
 	std::swap(m_uNumChildren, other.m_uNumChildren);
 
+	std::swap(m_eSplit, other.m_eSplit);
+	std::swap(m_fSplitSaving, other.m_fSplitSaving);
+
+	std::swap(m_uOctantCount, other.m_uOctantCount);
+	std::swap(m_uMaxLevel, other.m_uMaxLevel);
+	std::swap(m_uIdealEntityCount, other.m_uIdealEntityCount);
+	std::swap(m_pMinList, other.m_pMinList);
+	std::swap(m_pMaxList, other.m_pMaxList);
+
 	m_pMeshMngr = MeshManager::GetInstance();
 	m_pEntityMngr = MyEntityManager::GetInstance();
 
@@ -141,25 +200,24 @@ vector3 Simplex::MyOctant::GetCenterGlobal(void)
 
 vector3 Simplex::MyOctant::GetMinGlobal(void)
 {
-	return m_v3Max;
+	return m_v3Min;
 }
 
 vector3 Simplex::MyOctant::GetMaxGlobal(void)
 {
-	return m_v3Min;
+	return m_v3Max;
 }
 
 bool Simplex::MyOctant::IsColliding(uint a_uRBIndex)
 {
-	uint numEntities = m_pEntityMngr->GetEntityCount();
+	uint numEntities = GetBoundsCount();
 
 	// Stop checking if the index is out of bounds
 	if (a_uRBIndex < 0 || a_uRBIndex >= numEntities) { return false; }
 
-	// Get the min/max values from the rigidbody of the entity at the given index
-	MyRigidBody* otherRB = m_pEntityMngr->GetEntity(a_uRBIndex)->GetRigidBody();
-	vector3 otherMin = otherRB->GetMinGlobal();
-	vector3 otherMax = otherRB->GetMaxGlobal();
+	// Get the min/max values of the entity at the given index
+	vector3 otherMin, otherMax;
+	GetBounds(a_uRBIndex, otherMin, otherMax);
 
 	// Check for AABB collisions
 	if (m_v3Max.x < otherMin.x) { return false; }
@@ -208,6 +266,22 @@ void Simplex::MyOctant::Display(vector3 a_v3Color)
 		RENDER_WIRE);
 }
 
+void Simplex::MyOctant::GetDisplayList(std::vector<matrix4>& a_lBox, uint a_nIndex)
+{
+	// Same walk as the two Display methods, -1 takes every octant
+	if (a_nIndex == -1 || m_uID == a_nIndex)
+	{
+		a_lBox.push_back(glm::translate(IDENTITY_M4, m_v3Center) * glm::scale(vector3(m_fSize)));
+		if (a_nIndex != -1)
+			return;
+	}
+
+	for (uint i = 0; i < m_uNumChildren; i++)
+	{
+		m_pChild[i]->GetDisplayList(a_lBox, a_nIndex);
+	}
+}
+
 void Simplex::MyOctant::ClearEntityList(void)
 {
 	// Clear entity lists of the Octree
@@ -222,8 +296,35 @@ void Simplex::MyOctant::Subdivide(void)
 {
 	if (m_uNumChildren != 0) { return; } // If there are already children, do not subdivide again
 
-	if (m_uLevel == m_uMaxLevel) { return; } // Cap at the MaxLevel 
+	if (m_uLevel == m_pRoot->m_uMaxLevel) { return; } // Cap at the MaxLevel 
 
+	// Split only if the children are expected to test fewer pairs than this octant
+	m_fSplitSaving = EstimateSplitSaving();
+	if (m_fSplitSaving <= 0.0f)
+	{
+		m_eSplit = SD_KEPT;
+		return;
+	}
+	m_eSplit = SD_SPLIT;
+
+	AllocateChildren();
+	for (uint i = 0; i < 8; i++) 
+	{
+		m_pChild[i]->m_uID = m_pRoot->m_uOctantCount++;
+
+		// Assign the ID of the child to the entities within it
+		m_pChild[i]->AssignIDtoEntity();
+
+		// Subdivide children if they contain more than the ideal entity count
+		if (m_pChild[i]->ContainsMoreThan(m_pRoot->m_uIdealEntityCount))
+		{
+			m_pChild[i]->Subdivide();
+		}
+	}
+}
+
+void Simplex::MyOctant::AllocateChildren(void)
+{
 	vector3 offset = ZERO_V3;
 	float step = m_fSize / 4.0f; // Distance of the offset to new octants is a quarter of the size of the original octant
 
@@ -240,18 +341,65 @@ void Simplex::MyOctant::Subdivide(void)
 		m_pChild[i]->m_uLevel = m_uLevel + 1;
 		m_pChild[i]->m_pRoot = m_pRoot;
 		m_pChild[i]->m_pParent = this;
+	}
 
-		// Assign the ID of the child to the entities within it
-		m_pChild[i]->AssignIDtoEntity();
+	m_uNumChildren = 8;
+}
 
-		// Subdivide children if they contain more than the ideal entity count
-		if (m_pChild[i]->ContainsMoreThan(m_uIdealEntityCount))
+MY_SPLIT_DECISION Simplex::MyOctant::GetSplitDecision(void)
+{
+	return m_eSplit;
+}
+
+float Simplex::MyOctant::GetSplitSaving(void)
+{
+	return m_fSplitSaving;
+}
+
+float Simplex::MyOctant::EstimateSplitSaving(void)
+{
+	uint childCount[8] = {};
+	uint placements = 0;
+	CountSplit(0, static_cast<uint>(m_EntityList.size()), childCount, placements);
+
+	return ScoreSplit(childCount, placements);
+}
+
+void Simplex::MyOctant::CountSplit(uint a_uStart, uint a_uEnd, uint* a_lChildCount, uint& a_uPlacements)
+{
+	// Count the entities each child would get, an entity touches the low half of an axis if its min is below
+	// the center and the high half if its max is above it
+	for (uint i = a_uStart; i < a_uEnd; i++)
+	{
+		vector3 rbMin, rbMax;
+		GetBounds(m_EntityList[i], rbMin, rbMax);
+
+		for (uint j = 0; j < 8; j++)
 		{
-			m_pChild[i]->Subdivide();
+			// Bit 1, 2 and 4 of the child index pick the high half of x, y and z, as in AllocateChildren
+			if ((j & 1) ? rbMax.x < m_v3Center.x : rbMin.x > m_v3Center.x) { continue; }
+			if ((j & 2) ? rbMax.y < m_v3Center.y : rbMin.y > m_v3Center.y) { continue; }
+			if ((j & 4) ? rbMax.z < m_v3Center.z : rbMin.z > m_v3Center.z) { continue; }
+
+			a_lChildCount[j]++;
+			a_uPlacements++;
 		}
 	}
+}
 
-	m_uNumChildren = 8;
+float Simplex::MyOctant::ScoreSplit(uint const* a_lChildCount, uint a_uPlacements)
+{
+	// Every pair inside a leaf is tested, the children add the cost of visiting them and of the duplicates
+	float count = static_cast<float>(m_EntityList.size());
+	float leafCost = count * (count - 1.0f) / 2.0f;
+	float splitCost = 8.0f * NODE_COST + (a_uPlacements - count) * DUPLICATE_COST;
+	for (uint j = 0; j < 8; j++)
+	{
+		float childPairs = static_cast<float>(a_lChildCount[j]);
+		splitCost += childPairs * (childPairs - 1.0f) / 2.0f;
+	}
+
+	return leafCost - splitCost;
 }
 
 MyOctant * Simplex::MyOctant::GetChild(uint a_nChild)
@@ -272,6 +420,11 @@ bool Simplex::MyOctant::IsLeaf(void)
 	return false;
 }
 
+std::vector<uint> const& Simplex::MyOctant::GetEntityList(void)
+{
+	return m_EntityList;
+}
+
 bool Simplex::MyOctant::ContainsMoreThan(uint a_nEntities)
 {
 	// Compare the size of the entity list to the passed in parameter
@@ -294,10 +447,113 @@ void Simplex::MyOctant::KillBranches(void)
 	m_uNumChildren = 0;
 }
 
+MyOctant* Simplex::MyOctant::Grow(vector3 a_v3Point)
+{
+	if (m_pRoot != this) { return nullptr; }
+
+	// The new root is offset by half the old size toward the point, the old root becomes the child on the other side
+	float step = m_fSize / 2.0f;
+	vector3 offset = ZERO_V3;
+	offset.x = (a_v3Point.x < m_v3Center.x) ? -step : step;
+	offset.y = (a_v3Point.y < m_v3Center.y) ? -step : step;
+	offset.z = (a_v3Point.z < m_v3Center.z) ? -step : step;
+	MyOctant* root = new MyOctant(m_v3Center + offset, m_fSize * 2.0f);
+	root->m_uOctantCount = m_uOctantCount;
+	root->m_uID = root->m_uOctantCount++;
+	root->m_uMaxLevel = m_uMaxLevel;
+	root->m_uIdealEntityCount = m_uIdealEntityCount;
+	root->m_pMinList = m_pMinList;
+	root->m_pMaxList = m_pMaxList;
+	uint index = (offset.x < 0.0f ? 1 : 0) | (offset.y < 0.0f ? 2 : 0) | (offset.z < 0.0f ? 4 : 0);
+
+	for (uint i = 0; i < 8; i++)
+	{
+		if (i == index)
+		{
+			root->m_pChild[i] = this;
+			continue;
+		}
+
+		// Same layout as Subdivide, the siblings start empty and the next assignment fills them
+		vector3 childOffset = ZERO_V3;
+		childOffset.x = ((i & 1) ? step : -step);
+		childOffset.y = ((i & 2) ? step : -step);
+		childOffset.z = ((i & 4) ? step : -step);
+		root->m_pChild[i] = new MyOctant(root->m_v3Center + childOffset, m_fSize);
+		root->m_pChild[i]->m_uID = root->m_uOctantCount++;
+	}
+	root->m_uNumChildren = 8;
+	root->m_eSplit = SD_SPLIT;
+
+	// The whole old tree goes one level down, only the root keeps the list of leaves
+	m_pParent = root;
+	m_lChild.clear();
+	root->SetRoot(root, 0);
+	return root;
+}
+
+MyOctant* Simplex::MyOctant::Shrink(vector3 a_v3Min, vector3 a_v3Max)
+{
+	if (m_pRoot != this || m_uNumChildren == 0) { return this; }
+
+	// The box has to leave a tenth of the child free on each side, so a scene sitting on the edge of a child does
+	// not shrink and grow the root every update
+	float margin = m_fSize / 20.0f;
+	uint index = (uint)-1;
+	for (uint i = 0; i < m_uNumChildren; i++)
+	{
+		vector3 childMin = m_pChild[i]->m_v3Min + vector3(margin);
+		vector3 childMax = m_pChild[i]->m_v3Max - vector3(margin);
+		if (glm::all(glm::greaterThanEqual(a_v3Min, childMin)) && glm::all(glm::lessThanEqual(a_v3Max, childMax)))
+		{
+			index = i;
+			break;
+		}
+	}
+	if (index == (uint)-1) { return this; }
+
+	// The kept child moves to the end so the old root only owns the discarded ones, it stays a root so deleting
+	// it deletes them too
+	MyOctant* root = m_pChild[index];
+	m_pChild[index] = m_pChild[m_uNumChildren - 1];
+	m_pChild[m_uNumChildren - 1] = root;
+	m_uNumChildren--;
+
+	root->m_pParent = nullptr;
+	root->m_uOctantCount = m_uOctantCount;
+	root->m_uMaxLevel = m_uMaxLevel;
+	root->m_uIdealEntityCount = m_uIdealEntityCount;
+	root->m_pMinList = m_pMinList;
+	root->m_pMaxList = m_pMaxList;
+	root->SetRoot(root, 0);
+	return root;
+}
+
+void Simplex::MyOctant::ReassignEntities(void)
+{
+	if (m_uLevel != 0) { return; }
+
+	ClearEntityList();
+	m_lChild.clear();
+
+	AssignIDtoEntity();
+
+	ConstructList();
+	AssignDimensions();
+}
+
 void Simplex::MyOctant::ConstructTree(uint a_nMaxLevel)
 {
 	if (m_uLevel != 0) { return; } 
 
+	BuildTree(a_nMaxLevel);
+	AssignDimensions();
+}
+
+void Simplex::MyOctant::BuildTree(uint a_nMaxLevel)
+{
+	if (m_uLevel != 0) { return; } 
+
 	// Clear the Octree's variables 
 	ClearEntityList();
 	KillBranches();
@@ -306,7 +562,7 @@ void Simplex::MyOctant::ConstructTree(uint a_nMaxLevel)
 	m_uMaxLevel = a_nMaxLevel;
 	m_uOctantCount = 1;
 
-	// Assign ID to the entities
+	// Fill the root, an entity lands in every leaf it touches
 	AssignIDtoEntity();
 
 	// Subdivide if contains more than ideal count
@@ -324,13 +580,11 @@ void Simplex::MyOctant::AssignIDtoEntity(void)
 	if (IsLeaf())
 	{
 		// Check all entities to see if they are colliding with the Octant's RigidBody. If so, assign them the Octant's ID
-		for (uint i = 0; i < m_pEntityMngr->GetEntityCount(); i++)
+		for (uint i = 0; i < GetBoundsCount(); i++)
 		{
 			if (IsColliding(i)) // If colliding add it to this octant's entity list
 			{
 				m_EntityList.push_back(i);
-				m_pEntityMngr->ClearDimensionSet(i); 
-				m_pEntityMngr->AddDimension(i, m_uID);
 			}
 		}
 	}
@@ -343,9 +597,177 @@ void Simplex::MyOctant::AssignIDtoEntity(void)
 	}
 }
 
+void Simplex::MyOctant::AssignDimensions(void)
+{
+	if (m_uLevel != 0) { return; }
+
+	// Every leaf holding entities is in the list, an entity keeps the ID of each one it touches; the octants that
+	// were split keep their list too but are no longer dimensions
+	m_pEntityMngr->ClearDimensionSetAll();
+	for (uint i = 0; i < m_lChild.size(); i++)
+	{
+		if (!m_lChild[i]->IsLeaf()) { continue; }
+
+		std::vector<uint> const& entityList = m_lChild[i]->m_EntityList;
+		for (uint j = 0; j < entityList.size(); j++)
+		{
+			m_pEntityMngr->AddDimension(entityList[j], m_lChild[i]->m_uID);
+		}
+	}
+}
+
+void Simplex::MyOctant::SetBoundsList(std::vector<vector3> const* a_pMinList, std::vector<vector3> const* a_pMaxList)
+{
+	if (m_uLevel != 0) { return; }
+
+	m_pMinList = a_pMinList;
+	m_pMaxList = a_pMaxList;
+}
+
+void Simplex::MyOctant::GetRecordList(std::vector<MyOctantRecord>& a_lRecord, std::vector<uint>& a_lEntity)
+{
+	MyOctantRecord record;
+	record.v3Center = m_v3Center;
+	record.fSize = m_fSize;
+	record.uID = m_uID;
+	record.uChildCount = m_uNumChildren;
+	record.uEntityStart = static_cast<uint>(a_lEntity.size());
+	record.uEntityCount = static_cast<uint>(m_EntityList.size());
+	record.uSplit = m_eSplit;
+	record.fSplitSaving = m_fSplitSaving;
+	a_lRecord.push_back(record);
+	a_lEntity.insert(a_lEntity.end(), m_EntityList.begin(), m_EntityList.end());
+
+	for (uint i = 0; i < m_uNumChildren; i++)
+	{
+		m_pChild[i]->GetRecordList(a_lRecord, a_lEntity);
+	}
+}
+
+bool Simplex::MyOctant::IsRecordListValid(MyOctantRecord const* a_pRecordList, uint a_uRecordCount, uint const* a_pEntityList, uint a_uEntryCount,
+	uint a_uEntityCount, uint a_uOctantCount)
+{
+	if (a_uRecordCount == 0) { return false; }
+
+	// Children still to read on each level above the current record, the list is done when none are left
+	std::vector<uint> pending;
+	pending.push_back(1);
+	for (uint i = 0; i < a_uRecordCount; i++)
+	{
+		if (pending.empty()) { return false; } // records past the end of the tree
+
+		MyOctantRecord const& record = a_pRecordList[i];
+		if (record.uChildCount != 0 && record.uChildCount != 8) { return false; }
+		if (record.uID >= a_uOctantCount || record.uSplit > SD_KEPT) { return false; }
+		if (record.uEntityStart > a_uEntryCount || record.uEntityCount > a_uEntryCount - record.uEntityStart) { return false; }
+		for (uint j = 0; j < record.uEntityCount; j++)
+		{
+			if (a_pEntityList[record.uEntityStart + j] >= a_uEntityCount) { return false; }
+		}
+
+		pending.back()--;
+		if (record.uChildCount > 0)
+		{
+			if (pending.size() == MAX_RECORD_DEPTH) { return false; }
+			pending.push_back(record.uChildCount);
+		}
+		while (!pending.empty() && pending.back() == 0)
+		{
+			pending.pop_back();
+		}
+	}
+
+	return pending.empty();
+}
+
+void Simplex::MyOctant::ReadRecord(MyOctantRecord const*& a_pRecord, uint const* a_pEntityList)
+{
+	MyOctantRecord const& record = *a_pRecord;
+	a_pRecord++;
+
+	// The boxes are taken as written, a grown root may not halve into its children exactly
+	m_v3Center = record.v3Center;
+	m_fSize = record.fSize;
+	m_v3Min = m_v3Center - (vector3(m_fSize) / 2.0f);
+	m_v3Max = m_v3Center + (vector3(m_fSize) / 2.0f);
+
+	m_uID = record.uID;
+	m_eSplit = static_cast<MY_SPLIT_DECISION>(record.uSplit);
+	m_fSplitSaving = record.fSplitSaving;
+	m_EntityList.assign(a_pEntityList + record.uEntityStart, a_pEntityList + record.uEntityStart + record.uEntityCount);
+
+	if (record.uChildCount == 0) { return; }
+
+	AllocateChildren();
+	for (uint i = 0; i < 8; i++)
+	{
+		m_pChild[i]->ReadRecord(a_pRecord, a_pEntityList);
+	}
+}
+
+uint Simplex::MyOctant::GetBoundsCount(void)
+{
+	if (m_pRoot->m_pMinList == nullptr) { return m_pEntityMngr->GetEntityCount(); }
+
+	return static_cast<uint>(m_pRoot->m_pMinList->size());
+}
+
+void Simplex::MyOctant::GetBounds(uint a_uIndex, vector3& a_v3Min, vector3& a_v3Max)
+{
+	if (m_pRoot->m_pMinList == nullptr)
+	{
+		MyRigidBody* rb = m_pEntityMngr->GetEntity(a_uIndex)->GetRigidBody();
+		a_v3Min = rb->GetMinGlobal();
+		a_v3Max = rb->GetMaxGlobal();
+		return;
+	}
+
+	a_v3Min = (*m_pRoot->m_pMinList)[a_uIndex];
+	a_v3Max = (*m_pRoot->m_pMaxList)[a_uIndex];
+}
+
+void Simplex::MyOctant::SetRoot(MyOctant* a_pRoot, uint a_uLevel)
+{
+	m_pRoot = a_pRoot;
+	m_uLevel = a_uLevel;
+
+	for (uint i = 0; i < m_uNumChildren; i++)
+	{
+		m_pChild[i]->m_pParent = this;
+		m_pChild[i]->SetRoot(a_pRoot, a_uLevel + 1);
+	}
+}
+
+uint Simplex::MyOctant::GetID(void)
+{
+	return m_uID;
+}
+
 uint Simplex::MyOctant::GetOctantCount(void)
 {
-	return m_uOctantCount;
+	return m_pRoot->m_uOctantCount;
+}
+
+void Simplex::MyOctant::GetMemoryReport(MyMemoryReport& a_Report)
+{
+	// Every octant carries the full struct, child pointers and lists included, whether it uses them or not
+	a_Report.uNodeCount++;
+	a_Report.uNodeBytes += sizeof(MyOctant);
+	a_Report.AddList(m_EntityList, a_Report.uIndexBytes);
+	a_Report.AddList(m_lChild, a_Report.uAuxiliaryBytes);
+
+	for (uint i = 0; i < m_uNumChildren; i++)
+	{
+		m_pChild[i]->GetMemoryReport(a_Report);
+	}
+
+	if (m_pRoot != this) { return; }
+
+	// The dimensions are the IDs of the leaves each entity touches, kept in an array on the entity
+	for (uint i = 0; i < m_pEntityMngr->GetEntityCount(); i++)
+	{
+		a_Report.uDimensionBytes += m_pEntityMngr->GetEntity(i)->GetDimensionCount() * sizeof(uint);
+	}
 }
 
 void Simplex::MyOctant::Release(void)
@@ -365,9 +787,11 @@ void Simplex::MyOctant::Init(void)
 	m_pParent = nullptr;
 
 	m_uLevel = 0;
-	m_uID = m_uOctantCount;
+	m_uID = 0;
 
 	m_fSize = 0.0f;
+	m_eSplit = SD_NONE;
+	m_fSplitSaving = 0.0f;
 	m_v3Center = ZERO_V3;
 	m_v3Min = ZERO_V3;
 	m_v3Max = ZERO_V3;
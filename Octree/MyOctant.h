@@ -10,11 +10,38 @@ Date: 08/2023
 
 namespace Simplex
 {
+	// What the cost model decided for an octant with more than the ideal entity count
+	enum MY_SPLIT_DECISION
+	{
+		SD_NONE = 0, // Few enough entities or at the maximum level, the split was not looked at
+		SD_SPLIT = 1, // The children are expected to test fewer pairs than the octant
+		SD_KEPT = 2 // The entities straddle the center planes too much for the split to pay off
+	};
+
+	// Octant written out flat, a tree is listed depth first with the children of an octant right after it
+	struct MyOctantRecord
+	{
+		vector3 v3Center = vector3(0.0f);
+		float fSize = 0.0f;
+		uint uID = 0;
+		uint uChildCount = 0; // 0 for leaves, 8 otherwise
+		uint uEntityStart = 0; // first entry of the octant in the entity list
+		uint uEntityCount = 0; // entries of the octant in the entity list
+		uint uSplit = SD_NONE; // MY_SPLIT_DECISION of the octant
+		float fSplitSaving = 0.0f;
+	};
+
 	class MyOctant
 	{
-		static uint m_uOctantCount; 
-		static uint m_uMaxLevel;
-		static uint m_uIdealEntityCount; 
+		friend class MyOctantBuilder; // fills the octants a few entities at a time
+
+		uint m_uOctantCount = 0; // octants created in the tree, kept by the root
+		uint m_uMaxLevel = 0; // kept by the root
+		uint m_uIdealEntityCount = 0; // kept by the root
+
+		static constexpr float NODE_COST = 1.0f; // cost of visiting a child octant, in pair tests
+		static constexpr float DUPLICATE_COST = 0.5f; // cost of an entity landing in one more child, in pair tests
+		static constexpr uint MAX_RECORD_DEPTH = 64; // deepest tree read back from a flat list, grown roots included
 
 		uint m_uID = 0; 
 		uint m_uLevel = 0; 
@@ -34,9 +61,16 @@ namespace Simplex
 
 		std::vector<uint> m_EntityList; 
 
+		MY_SPLIT_DECISION m_eSplit = SD_NONE; // decision of the cost model
+		float m_fSplitSaving = 0.0f; // pair tests the split was expected to save, negative when it was kept
+
 		MyOctant* m_pRoot = nullptr;
 		std::vector<MyOctant*> m_lChild;  
 
+		// Global bounds of every entity, kept by the root; the octants read the rigid bodies of the entity manager when null
+		std::vector<vector3> const* m_pMinList = nullptr;
+		std::vector<vector3> const* m_pMaxList = nullptr;
+
 	public:
 		/*
 		USAGE: Constructor
@@ -47,6 +81,20 @@ namespace Simplex
 		*/
 		MyOctant(uint a_nMaxLevel = 2, uint a_nIdealEntityCount = 5);
 
+		/*
+		USAGE: Constructor of a root that reads the entities from bounds lists instead of the entity manager, so it
+		can be built on any thread; the dimensions of the entities are left alone until AssignDimensions
+		ARGUMENTS:
+		- std::vector<vector3> const* a_pMinList -> global minimum of each entity, has to outlive the tree
+		- std::vector<vector3> const* a_pMaxList -> global maximum of each entity, has to outlive the tree
+		- uint a_nMaxLevel -> Sets the maximum level of subdivision
+		- uint a_nIdealEntityCount -> Sets the ideal level of objects per octant
+		- bool a_bBuild = true -> builds the tree right away, false leaves the root empty for a MyOctantBuilder
+		OUTPUT: class object
+		*/
+		MyOctant(std::vector<vector3> const* a_pMinList, std::vector<vector3> const* a_pMaxList, uint a_nMaxLevel, uint a_nIdealEntityCount,
+			bool a_bBuild = true);
+
 		/*
 		USAGE: Constructor
 		ARGUMENTS:
@@ -56,6 +104,20 @@ namespace Simplex
 		*/
 		MyOctant(vector3 a_v3Center, float a_fSize);
 
+		/*
+		USAGE: Constructor of a root read back from the flat list of GetRecordList, nothing is tested against the
+		entities; the dimensions are left alone until AssignDimensions and the bounds are read from the entity
+		manager until SetBoundsList
+		ARGUMENTS:
+		- MyOctantRecord const* a_pRecordList -> octants depth first, checked with IsRecordListValid
+		- uint const* a_pEntityList -> entries the records point into
+		- uint a_nOctantCount -> IDs handed out by the tree that was written
+		- uint a_nMaxLevel -> Sets the maximum level of subdivision
+		- uint a_nIdealEntityCount -> Sets the ideal level of objects per octant
+		OUTPUT: class object
+		*/
+		MyOctant(MyOctantRecord const* a_pRecordList, uint const* a_pEntityList, uint a_nOctantCount, uint a_nMaxLevel, uint a_nIdealEntityCount);
+
 		MyOctant(MyOctant const& other);
 		MyOctant& operator=(MyOctant const& other);
 		~MyOctant(void);
@@ -113,16 +175,37 @@ namespace Simplex
 		*/
 		void Display(vector3 a_v3Color = C_YELLOW);
 
+		/*
+		USAGE: Collects the transforms of the wire cubes Display draws, so another thread can draw them
+		ARGUMENTS:
+		- std::vector<matrix4>& a_lBox -> list to append the transforms to
+		- uint a_nIndex = -1 -> MyOctant to collect as Display(a_nIndex) would, -1 for the whole tree
+		*/
+		void GetDisplayList(std::vector<matrix4>& a_lBox, uint a_nIndex = -1);
+
 		/*
 		USAGE: Clears the Entity list for each node
 		*/
 		void ClearEntityList(void);
 
 		/*
-		USAGE: Allocates 8 smaller child octants from this octant
+		USAGE: Allocates 8 smaller child octants from this octant if the cost model expects them to test fewer
+		pairs than the octant alone
 		*/
 		void Subdivide(void);
 
+		/*
+		USAGE: Gets what the cost model decided for this octant
+		OUTPUT: split decision, SD_NONE if it was never looked at
+		*/
+		MY_SPLIT_DECISION GetSplitDecision(void);
+
+		/*
+		USAGE: Gets the pair tests the split of this octant was expected to save
+		OUTPUT: estimated saving, negative when the octant was kept whole and 0 if it was never looked at
+		*/
+		float GetSplitSaving(void);
+
 		/*
 		USAGE: Returns the child specified by the index
 		ARGUMENTS: uint a_nChild -> index of the child (from 0 to 7)
@@ -141,6 +224,18 @@ namespace Simplex
 		*/
 		bool IsLeaf(void);
 
+		/*
+		USAGE: Gets the index of the octant, unique within its tree
+		OUTPUT: octant index
+		*/
+		uint GetID(void);
+
+		/*
+		USAGE: Gets the indices of the entities inside the octant
+		OUTPUT: entity list
+		*/
+		std::vector<uint> const& GetEntityList(void);
+
 		/*
 		USAGE: Checks to see if the octant contains more entities than the provided number
 		ARGUMENTS:
@@ -160,16 +255,82 @@ namespace Simplex
 		*/
 		void ConstructTree(uint a_nMaxLevel = 3);
 
+		/*
+		USAGE: Puts the root under a new root twice its size, extended toward the point; the old tree is kept as
+		one of the children and the other seven are empty leaves
+		ARGUMENTS:
+		- vector3 a_v3Point -> point outside of the root the new root grows toward
+		OUTPUT: new root, nullptr if this octant is not a root
+		*/
+		MyOctant* Grow(vector3 a_v3Point);
+
+		/*
+		USAGE: Makes the child of the root holding the whole box the new root; this octant keeps the other children
+		and nothing is deleted, the caller deletes it with them once no reader can reach them
+		ARGUMENTS:
+		- vector3 a_v3Min -> minimum of the box in global space
+		- vector3 a_v3Max -> maximum of the box in global space
+		OUTPUT: new root, this octant if no single child holds the box with some room to spare
+		*/
+		MyOctant* Shrink(vector3 a_v3Min, vector3 a_v3Max);
+
+		/*
+		USAGE: Assigns the entities to the leaves again without changing the subdivisions, for entities that moved
+		inside the root
+		*/
+		void ReassignEntities(void);
+
 		/*
 		USAGE: Traverse the tree up to the leafs and sets the objects in them to the index
 		*/
 		void AssignIDtoEntity(void);
+		/*
+		USAGE: Replaces the dimensions of every entity with the IDs of the leaves holding it
+		*/
+		void AssignDimensions(void);
+		/*
+		USAGE: Points the tree at other bounds lists, the next assignment reads them
+		ARGUMENTS:
+		- std::vector<vector3> const* a_pMinList -> global minimum of each entity, null to read the entity manager
+		- std::vector<vector3> const* a_pMaxList -> global maximum of each entity, null to read the entity manager
+		*/
+		void SetBoundsList(std::vector<vector3> const* a_pMinList, std::vector<vector3> const* a_pMaxList);
+
+		/*
+		USAGE: Lists the octant and the ones under it depth first, to be written out
+		ARGUMENTS:
+		- std::vector<MyOctantRecord>& a_lRecord -> list to append the octants to
+		- std::vector<uint>& a_lEntity -> list to append the entities of the octants to
+		*/
+		void GetRecordList(std::vector<MyOctantRecord>& a_lRecord, std::vector<uint>& a_lEntity);
+
+		/*
+		USAGE: Checks a flat list read from a file before a tree is made of it
+		ARGUMENTS:
+		- MyOctantRecord const* a_pRecordList -> octants depth first
+		- uint a_uRecordCount -> octants in the list
+		- uint const* a_pEntityList -> entries the records point into
+		- uint a_uEntryCount -> entries in the entity list
+		- uint a_uEntityCount -> entities the entries can name
+		- uint a_uOctantCount -> IDs handed out by the tree, every ID is below it
+		OUTPUT: does it make a single tree with every range in bounds?
+		*/
+		static bool IsRecordListValid(MyOctantRecord const* a_pRecordList, uint a_uRecordCount, uint const* a_pEntityList, uint a_uEntryCount,
+			uint a_uEntityCount, uint a_uOctantCount);
 
 		/*
 		USAGE: Gets the total number of octants in the world
 		*/
 		uint GetOctantCount(void);
 
+		/*
+		USAGE: Adds the memory of this octant and the ones under it to the report, the root also adds the
+		dimension arrays it gave to the entities
+		ARGUMENTS:
+		- MyMemoryReport& a_Report -> report to add to
+		*/
+		void GetMemoryReport(MyMemoryReport& a_Report);
+
 	private:
 		/*
 		USAGE: Deallocates member fields
@@ -185,6 +346,72 @@ namespace Simplex
 		USAGE: creates the list of all leafs that contains objects.
 		*/
 		void ConstructList(void);
+		/*
+		USAGE: Subdivides the root and fills the leaves without touching the dimensions of the entities
+		ARGUMENTS:
+		- uint a_nMaxLevel -> maximum level of the tree
+		*/
+		void BuildTree(uint a_nMaxLevel);
+		/*
+		USAGE: Gets the number of entities the tree places
+		OUTPUT: entity count
+		*/
+		uint GetBoundsCount(void);
+		/*
+		USAGE: Gets the global bounds of an entity from the lists of the root, or from its rigid body
+		ARGUMENTS:
+		- uint a_uIndex -> index of the entity
+		- vector3& a_v3Min -> global minimum
+		- vector3& a_v3Max -> global maximum
+		*/
+		void GetBounds(uint a_uIndex, vector3& a_v3Min, vector3& a_v3Max);
+
+		/*
+		USAGE: Sets the root and the level of this octant and the ones under it
+		ARGUMENTS:
+		- MyOctant* a_pRoot -> root of the tree
+		- uint a_uLevel -> level of this octant
+		*/
+		void SetRoot(MyOctant* a_pRoot, uint a_uLevel);
+
+		/*
+		USAGE: Estimates the pair tests of the octant against the ones of its 8 children, the entities straddling
+		the center planes count in every child they touch
+		OUTPUT: pair tests the split saves, negative if it costs more than it saves
+		*/
+		float EstimateSplitSaving(void);
+
+		/*
+		USAGE: Counts the entities each child would get for a range of the entity list
+		ARGUMENTS:
+		- uint a_uStart -> first entry of m_EntityList to count
+		- uint a_uEnd -> one past the last entry to count
+		- uint* a_lChildCount -> 8 counters to add to
+		- uint& a_uPlacements -> adds the entries the range makes in the children, straddling entities count once per child
+		*/
+		void CountSplit(uint a_uStart, uint a_uEnd, uint* a_lChildCount, uint& a_uPlacements);
+
+		/*
+		USAGE: Weighs the pair tests of the octant against the ones of its children
+		ARGUMENTS:
+		- uint const* a_lChildCount -> entities each child would get
+		- uint a_uPlacements -> entries in all the children
+		OUTPUT: pair tests the split saves, negative if it costs more than it saves
+		*/
+		float ScoreSplit(uint const* a_lChildCount, uint a_uPlacements);
+
+		/*
+		USAGE: Creates the 8 empty children, their IDs are handed out when they get filled
+		*/
+		void AllocateChildren(void);
+
+		/*
+		USAGE: Takes the ID, the entities and the split of a record and reads the children after it
+		ARGUMENTS:
+		- MyOctantRecord const*& a_pRecord -> record of this octant, left past the last one under it
+		- uint const* a_pEntityList -> entries the records point into
+		*/
+		void ReadRecord(MyOctantRecord const*& a_pRecord, uint const* a_pEntityList);
 	};
 } 
 
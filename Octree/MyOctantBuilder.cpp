@@ -0,0 +1,144 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyOctantBuilder.h"
+#include <chrono>
+using namespace Simplex;
+
+Simplex::MyOctantBuilder::MyOctantBuilder(std::vector<vector3> const* a_pMinList, std::vector<vector3> const* a_pMaxList, uint a_uMaxLevel, uint a_uIdealEntityCount)
+{
+	m_pRoot = new MyOctant(a_pMinList, a_pMaxList, a_uMaxLevel, a_uIdealEntityCount, false);
+	m_lStack.push_back(m_pRoot);
+	for (uint i = 0; i < 8; i++)
+	{
+		m_lChildCount[i] = 0;
+	}
+}
+
+Simplex::MyOctantBuilder::~MyOctantBuilder(void)
+{
+	SafeDelete(m_pRoot);
+}
+
+bool Simplex::MyOctantBuilder::Step(float a_fBudget)
+{
+	if (m_bDone) { return true; }
+
+	auto tStart = std::chrono::high_resolution_clock::now();
+	do
+	{
+		StepOctant();
+		if (m_lStack.empty())
+		{
+			m_fProgress = 1.0f;
+			m_bDone = true;
+			return true;
+		}
+	} while (std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - tStart).count() < a_fBudget);
+
+	float fProgress = m_uFinished / static_cast<float>(m_uFinished + m_lStack.size());
+	m_fProgress = glm::max(m_fProgress, fProgress);
+	return false;
+}
+
+bool Simplex::MyOctantBuilder::IsDone(void)
+{
+	return m_bDone;
+}
+
+float Simplex::MyOctantBuilder::GetProgress(void)
+{
+	return m_fProgress;
+}
+
+MyOctant* Simplex::MyOctantBuilder::TakeRoot(void)
+{
+	if (!m_bDone) { return nullptr; }
+
+	MyOctant* pRoot = m_pRoot;
+	m_pRoot = nullptr;
+	return pRoot;
+}
+
+void Simplex::MyOctantBuilder::StepOctant(void)
+{
+	MyOctant* pOctant = m_lStack.back();
+
+	if (m_eStage == STAGE_FILL)
+	{
+		// IDs are handed out as the octants are started, in the same order as the recursion of Subdivide
+		if (m_uCursor == 0 && pOctant != m_pRoot)
+		{
+			pOctant->m_uID = m_pRoot->m_uOctantCount++;
+		}
+
+		// The root looks at every entity, a child only at the ones of its parent since it lies inside it
+		MyOctant* pParent = pOctant->m_pParent;
+		uint uCount = pParent == nullptr ? pOctant->GetBoundsCount() : static_cast<uint>(pParent->m_EntityList.size());
+		uint uEnd = glm::min(m_uCursor + CHUNK, uCount);
+		for (uint i = m_uCursor; i < uEnd; i++)
+		{
+			uint uEntity = pParent == nullptr ? i : pParent->m_EntityList[i];
+			if (pOctant->IsColliding(uEntity))
+			{
+				pOctant->m_EntityList.push_back(uEntity);
+			}
+		}
+		m_uCursor = uEnd;
+		if (m_uCursor < uCount) { return; }
+
+		// The octants are filled in the order ConstructList walks them, so the list of the root grows as it goes
+		if (!pOctant->m_EntityList.empty())
+		{
+			m_pRoot->m_lChild.push_back(pOctant);
+		}
+
+		// Only the octants holding too many entities above the maximum level are weighed, as in Subdivide
+		if (!pOctant->ContainsMoreThan(m_pRoot->m_uIdealEntityCount) || pOctant->m_uLevel == m_pRoot->m_uMaxLevel)
+		{
+			FinishOctant();
+			return;
+		}
+		m_eStage = STAGE_COUNT;
+		m_uCursor = 0;
+		m_uPlacements = 0;
+		for (uint i = 0; i < 8; i++)
+		{
+			m_lChildCount[i] = 0;
+		}
+		return;
+	}
+
+	uint uCount = static_cast<uint>(pOctant->m_EntityList.size());
+	uint uEnd = glm::min(m_uCursor + CHUNK, uCount);
+	pOctant->CountSplit(m_uCursor, uEnd, m_lChildCount, m_uPlacements);
+	m_uCursor = uEnd;
+	if (m_uCursor < uCount) { return; }
+
+	pOctant->m_fSplitSaving = pOctant->ScoreSplit(m_lChildCount, m_uPlacements);
+	if (pOctant->m_fSplitSaving <= 0.0f)
+	{
+		pOctant->m_eSplit = SD_KEPT;
+		FinishOctant();
+		return;
+	}
+	pOctant->m_eSplit = SD_SPLIT;
+
+	// The children go on the stack in reverse so the first one is filled next, with its own children before the second
+	FinishOctant();
+	pOctant->AllocateChildren();
+	for (uint i = 8; i > 0; i--)
+	{
+		m_lStack.push_back(pOctant->m_pChild[i - 1]);
+	}
+}
+
+void Simplex::MyOctantBuilder::FinishOctant(void)
+{
+	m_lStack.pop_back();
+	m_uFinished++;
+	m_eStage = STAGE_FILL;
+	m_uCursor = 0;
+}
@@ -0,0 +1,103 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYOCTANTBUILDER_H_
+#define __MYOCTANTBUILDER_H_
+
+#include "MyOctant.h"
+
+namespace Simplex
+{
+	// Builds an octree from bounds lists a slice at a time, so a rebuild can be spread over frames on the thread
+	// that updates; the octants come out the same as the ones the constructor builds in one go
+	class MyOctantBuilder
+	{
+		static constexpr uint CHUNK = 64; // entities looked at between two reads of the clock
+
+		// Work left on the octant at the top of the stack
+		enum STAGE
+		{
+			STAGE_FILL = 0, // picks the entities of the parent that touch the octant
+			STAGE_COUNT = 1 // counts the entities each child would get for the cost model
+		};
+
+		MyOctant* m_pRoot = nullptr; // tree being built, owned until TakeRoot
+		std::vector<MyOctant*> m_lStack; // octants left to fill, the top one is in progress
+		STAGE m_eStage = STAGE_FILL;
+		uint m_uCursor = 0; // next entry of the list the stage walks
+		uint m_lChildCount[8]; // entities each child would get, counted so far
+		uint m_uPlacements = 0; // entries in all the children, counted so far
+		uint m_uFinished = 0; // octants filled and decided
+		float m_fProgress = 0.0f; // never goes back, the stack grows as the octants split
+		bool m_bDone = false;
+
+	public:
+		/*
+		USAGE: Constructor, sizes the root around the entities; nothing is filled until Step
+		ARGUMENTS:
+		- std::vector<vector3> const* a_pMinList -> global minimum of each entity, has to outlive the builder
+		- std::vector<vector3> const* a_pMaxList -> global maximum of each entity, has to outlive the builder
+		- uint a_uMaxLevel -> maximum level of subdivision
+		- uint a_uIdealEntityCount -> entities per octant before it subdivides
+		OUTPUT: class object
+		*/
+		MyOctantBuilder(std::vector<vector3> const* a_pMinList, std::vector<vector3> const* a_pMaxList, uint a_uMaxLevel, uint a_uIdealEntityCount);
+
+		/*
+		USAGE: Destructor, deletes the tree unless it was taken
+		*/
+		~MyOctantBuilder(void);
+
+		/*
+		USAGE: Builds until the time runs out or the tree is done; the clock is read after every chunk of entities,
+		so the step overruns the budget by about one chunk
+		ARGUMENTS:
+		- float a_fBudget -> microseconds to spend, at least one chunk is done
+		OUTPUT: is the tree done?
+		*/
+		bool Step(float a_fBudget);
+
+		/*
+		USAGE: Asks if the tree is done
+		OUTPUT: is it done?
+		*/
+		bool IsDone(void);
+
+		/*
+		USAGE: Gets an estimate of the work done, from the octants finished against the ones known to be left
+		OUTPUT: fraction between 0 and 1, 1 once the tree is done
+		*/
+		float GetProgress(void);
+
+		/*
+		USAGE: Hands over the tree once it is done, the builder no longer deletes it
+		OUTPUT: root of the tree, nullptr if it is not done or was taken already
+		*/
+		MyOctant* TakeRoot(void);
+
+	private:
+		/*
+		USAGE: Does one chunk of the octant at the top of the stack
+		*/
+		void StepOctant(void);
+
+		/*
+		USAGE: Pops the octant at the top of the stack, it needs no more work
+		*/
+		void FinishOctant(void);
+
+		/*
+		USAGE: Copy constructor
+		*/
+		MyOctantBuilder(MyOctantBuilder const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyOctantBuilder& operator=(MyOctantBuilder const& a_pOther);
+	};
+}
+
+#endif //__MYOCTANTBUILDER_H_
@@ -0,0 +1,1038 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyOctreeBroadphase.h"
+#include "MyOctant.h"
+#include "MyOctantBuilder.h"
+#include "MyProfiler.h"
+#include <bitset>
+#include <queue>
+using namespace Simplex;
+
+Simplex::MyOctreeBroadphase::MyOctreeBroadphase(void)
+{
+	m_pRoot = nullptr;
+	m_pView = nullptr;
+	m_uMaxLevel = 0;
+	m_uIdealEntityCount = 5;
+	m_bDirty = true;
+	m_fBuildCost = 0.0f;
+	m_uStamp = 0;
+}
+
+Simplex::MyOctreeBroadphase::~MyOctreeBroadphase(void)
+{
+	CancelBuild();
+	for (std::future<MyOctant*>& build : m_lAbandoned)
+	{
+		MyOctant* pAbandoned = build.get();
+		SafeDelete(pAbandoned);
+	}
+	MyOctant* pRoot = m_pRoot.exchange(nullptr);
+	SafeDelete(pRoot);
+	View* pView = m_pView.exchange(nullptr);
+	SafeDelete(pView);
+}
+
+void Simplex::MyOctreeBroadphase::SetMaxLevel(uint a_uMaxLevel)
+{
+	if (m_uMaxLevel == a_uMaxLevel) { return; }
+
+	m_uMaxLevel = a_uMaxLevel;
+	m_bDirty = true;
+}
+
+uint Simplex::MyOctreeBroadphase::GetMaxLevel(void)
+{
+	return m_uMaxLevel;
+}
+
+void Simplex::MyOctreeBroadphase::SetIdealEntityCount(uint a_uIdealEntityCount)
+{
+	if (m_uIdealEntityCount == a_uIdealEntityCount) { return; }
+
+	m_uIdealEntityCount = a_uIdealEntityCount;
+	m_bDirty = true;
+}
+
+uint Simplex::MyOctreeBroadphase::GetIdealEntityCount(void)
+{
+	return m_uIdealEntityCount;
+}
+
+uint Simplex::MyOctreeBroadphase::GetLeafCount(void)
+{
+	return static_cast<uint>(m_lLeaf.size());
+}
+
+void Simplex::MyOctreeBroadphase::GetLeafHistogram(uint* a_lBucket, uint a_uBuckets)
+{
+	for (uint i = 0; i < a_uBuckets; i++)
+	{
+		a_lBucket[i] = 0;
+	}
+	if (a_uBuckets == 0) { return; }
+
+	// Bucket i holds the leaves with 2^i to 2^(i+1) - 1 entities, the last one takes every leaf past it
+	for (uint uLeaf = 0; uLeaf < m_lLeaf.size(); uLeaf++)
+	{
+		uint uCount = static_cast<uint>(m_lLeaf[uLeaf]->GetEntityList().size());
+		uint uBucket = 0;
+		while (uCount > 1 && uBucket + 1 < a_uBuckets)
+		{
+			uCount >>= 1;
+			uBucket++;
+		}
+		a_lBucket[uBucket]++;
+	}
+}
+
+float Simplex::MyOctreeBroadphase::GetDuplicationFactor(void)
+{
+	// Entities outside of every leaf do not count, the factor is about the ones the tree holds
+	uint uHeld = 0;
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		if (m_lEntityLeafStart[i + 1] > m_lEntityLeafStart[i]) { uHeld++; }
+	}
+	return uHeld == 0 ? 0.0f : m_lEntityLeaf.size() / static_cast<float>(uHeld);
+}
+
+void Simplex::MyOctreeBroadphase::GetSplitStats(uint& a_uSplit, uint& a_uKept, float& a_fSaving)
+{
+	a_uSplit = 0;
+	a_uKept = 0;
+	a_fSaving = 0.0f;
+	for (uint uNode = 0; uNode < m_lNodeInfo.size(); uNode++)
+	{
+		MyOctant* pOctant = m_lNodeInfo[uNode].pOctant;
+		if (pOctant->GetSplitDecision() == SD_SPLIT)
+		{
+			a_uSplit++;
+			a_fSaving += pOctant->GetSplitSaving();
+		}
+		else if (pOctant->GetSplitDecision() == SD_KEPT)
+		{
+			a_uKept++;
+		}
+	}
+}
+
+uint Simplex::MyOctreeBroadphase::GetNodeCount(void)
+{
+	return static_cast<uint>(m_lNode.size());
+}
+
+MyOctant* Simplex::MyOctreeBroadphase::GetNodeOctant(uint a_uNode)
+{
+	if (a_uNode >= m_lNodeInfo.size()) { return nullptr; }
+
+	return m_lNodeInfo[a_uNode].pOctant;
+}
+
+MyOctant* Simplex::MyOctreeBroadphase::GetOctree(void)
+{
+	return m_pRoot.load();
+}
+
+MyEpoch* Simplex::MyOctreeBroadphase::GetEpoch(void)
+{
+	return &m_Epoch;
+}
+
+bool Simplex::MyOctreeBroadphase::IsBuilding(void)
+{
+	return m_Build.valid() || m_pBuilder != nullptr;
+}
+
+void Simplex::MyOctreeBroadphase::SetBuildBudget(float a_fBudget)
+{
+	m_fBuildBudget = glm::max(a_fBudget, 0.0f);
+}
+
+float Simplex::MyOctreeBroadphase::GetBuildBudget(void)
+{
+	return m_fBuildBudget;
+}
+
+float Simplex::MyOctreeBroadphase::GetBuildProgress(void)
+{
+	if (m_pBuilder != nullptr) { return m_pBuilder->GetProgress(); }
+	if (m_Build.valid()) { return 0.0f; }
+	return -1.0f;
+}
+
+void Simplex::MyOctreeBroadphase::Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	LoadTree(nullptr, a_lMin, a_lMax);
+}
+
+void Simplex::MyOctreeBroadphase::LoadTree(MyOctant* a_pRoot, std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	CancelBuild();
+	CopyBounds(a_lMin, a_lMax);
+	m_bViewBounds = true;
+	m_bDirty = false;
+	m_lStamp.assign(m_uEntityCount, 0);
+	m_uStamp = 0;
+
+	MyOctant* pRoot = a_pRoot;
+	if (m_uEntityCount == 0)
+	{
+		SafeDelete(pRoot);
+	}
+	else if (pRoot != nullptr)
+	{
+		pRoot->SetBoundsList(&m_lMin, &m_lMax);
+		pRoot->AssignDimensions();
+		MY_PROFILE_COUNTER("Octants", pRoot->GetOctantCount());
+	}
+	else
+	{
+		MY_PROFILE_ZONE("ConstructTree");
+		pRoot = new MyOctant(&m_lMin, &m_lMax, m_uMaxLevel, m_uIdealEntityCount);
+		pRoot->AssignDimensions();
+		MY_PROFILE_COUNTER("Octants", pRoot->GetOctantCount());
+	}
+	SetRoot(pRoot);
+	GatherLeaves();
+	m_fBuildCost = GetLeafCost();
+	MY_PROFILE_COUNTER("Entities per leaf", m_lLeaf.empty() ? 0.0f : m_lEntityLeaf.size() / static_cast<float>(m_lLeaf.size()));
+	PublishView();
+}
+
+void Simplex::MyOctreeBroadphase::Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	UpdateTree(a_lMin, a_lMax);
+	PublishView();
+}
+
+void Simplex::MyOctreeBroadphase::UpdateTree(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	CollectAbandoned();
+
+	// Without a tree there is nothing to query while one is built, the first one is built right away
+	if (m_pRoot.load() == nullptr)
+	{
+		Build(a_lMin, a_lMax);
+		return;
+	}
+
+	// A sliced rebuild gets its share of the update, and takes over like one the worker finished before the
+	// update reads the tree
+	if (m_pBuilder != nullptr)
+	{
+		MY_PROFILE_ZONE("ConstructTree slice");
+		if (m_pBuilder->Step(m_fBuildBudget))
+		{
+			MyOctant* pRoot = m_pBuilder->TakeRoot();
+			SafeDelete(m_pBuilder);
+			PublishBuild(pRoot, a_lMin, a_lMax);
+			return;
+		}
+	}
+	else if (m_Build.valid() && m_Build.wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+	{
+		PublishBuild(m_Build.get(), a_lMin, a_lMax);
+		return;
+	}
+
+	// The subdivisions are kept while the entities only move, new settings are rebuilt meanwhile
+	if (m_bDirty)
+	{
+		StartBuild(a_lMin, a_lMax);
+	}
+
+	// Entities added or removed are placed in the subdivisions the tree already has, like moved ones
+	if (a_lMin.size() != m_uEntityCount)
+	{
+		m_lStamp.assign(a_lMin.size(), 0);
+		m_uStamp = 0;
+		Refit(a_lMin, a_lMax);
+		return;
+	}
+
+	bool bMoved = false;
+	for (uint i = 0; i < m_uEntityCount && !bMoved; i++)
+	{
+		bMoved = a_lMin[i] != m_lMin[i] || a_lMax[i] != m_lMax[i];
+	}
+
+	if (bMoved)
+	{
+		Refit(a_lMin, a_lMax);
+	}
+	else if (m_bFilterChanged)
+	{
+		GroupLeaves();
+	}
+}
+
+void Simplex::MyOctreeBroadphase::QueryPairs(MyPairList& a_lPairs)
+{
+	MyBroadphaseStats stats;
+	stats.uNodesVisited = static_cast<uint>(m_lLeaf.size());
+	for (uint uLeaf = 0; uLeaf < m_lLeaf.size(); uLeaf++)
+	{
+		uint uGroupEnd = m_lLeafGroupStart[uLeaf + 1];
+		for (uint g = m_lLeafGroupStart[uLeaf]; g < uGroupEnd; g++)
+		{
+			for (uint h = g; h < uGroupEnd; h++)
+			{
+				// Layers that ignore each other are skipped without looking at their entities
+				Group const& groupA = m_lGroup[g];
+				Group const& groupB = m_lGroup[h];
+				uint uSizeA = groupA.uEnd - groupA.uStart;
+				uint uPairs = g == h ? uSizeA * (uSizeA - 1) / 2 : uSizeA * (groupB.uEnd - groupB.uStart);
+				stats.uCandidatePairs += uPairs;
+				if (!(groupA.uCategory & groupB.uMask) || !(groupB.uCategory & groupA.uMask))
+				{
+					stats.uLayerCulled += uPairs;
+					continue;
+				}
+
+				for (uint a = groupA.uStart; a < groupA.uEnd; a++)
+				{
+					for (uint b = g == h ? a + 1 : groupB.uStart; b < groupB.uEnd; b++)
+					{
+						uint i = m_lGroupEntity[a];
+						uint j = m_lGroupEntity[b];
+						if (!IsPairPassing(i, j))
+						{
+							stats.uLayerCulled++;
+							continue;
+						}
+						stats.uBoundsTests++;
+						if (!IsBoxOverlapping(m_lMin[i], m_lMax[i], m_lMin[j], m_lMax[j])) { continue; }
+
+						// Entities straddling octants meet in several leaves, only the first one reports them
+						if (GetFirstSharedLeaf(i, j) != uLeaf)
+						{
+							stats.uDuplicatePairs++;
+							continue;
+						}
+
+						MyEntityPair pair;
+						pair.uA = std::min(i, j);
+						pair.uB = std::max(i, j);
+						a_lPairs.push_back(pair);
+					}
+				}
+			}
+		}
+	}
+	m_Stats += stats;
+}
+
+void Simplex::MyOctreeBroadphase::QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities)
+{
+	if (m_pRoot.load() == nullptr) { return; }
+
+	MyBroadphaseStats stats;
+	m_uStamp++;
+	if (m_uStamp == 0)
+	{
+		std::fill(m_lStamp.begin(), m_lStamp.end(), 0);
+		m_uStamp = 1;
+	}
+
+	m_lStack.clear();
+	m_lStack.push_back(0);
+	while (!m_lStack.empty())
+	{
+		Node const& node = m_lNode[m_lStack.back()];
+		m_lStack.pop_back();
+		stats.uNodesVisited++;
+
+		vector3 v3Half(node.fHalfSize);
+		if (!IsBoxOverlapping(a_v3Min, a_v3Max, node.v3Center - v3Half, node.v3Center + v3Half)) { continue; }
+
+		if (node.uChildMask != 0)
+		{
+			uint uChildren = static_cast<uint>(std::bitset<8>(node.uChildMask).count());
+			for (uint i = 0; i < uChildren; i++)
+			{
+				m_lStack.push_back(node.uFirstChild + i);
+			}
+			continue;
+		}
+
+		// The entities of a leaf are sorted by category, the layers are checked on each one
+		stats.uCandidatePairs += node.uEntityCount;
+		for (uint i = node.uEntityStart; i < node.uEntityStart + node.uEntityCount; i++)
+		{
+			uint uEntity = m_lGroupEntity[i];
+			if (!(m_lCategory[uEntity] & a_uMask))
+			{
+				stats.uLayerCulled++;
+				continue;
+			}
+			if (m_lStamp[uEntity] == m_uStamp)
+			{
+				stats.uDuplicatePairs++;
+				continue;
+			}
+
+			m_lStamp[uEntity] = m_uStamp;
+			stats.uBoundsTests++;
+			if (IsBoxOverlapping(a_v3Min, a_v3Max, m_lMin[uEntity], m_lMax[uEntity]))
+			{
+				a_lEntities.push_back(uEntity);
+			}
+		}
+	}
+	m_Stats += stats;
+}
+
+bool Simplex::MyOctreeBroadphase::Raycast(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float a_fMaxDistance, uint a_uMask,
+	uint& a_uEntity, float& a_fDistance)
+{
+	if (m_pRoot.load() == nullptr) { return false; }
+
+	vector3 v3InvDirection = 1.0f / a_v3Direction;
+	bool bHit = false;
+
+	m_lStack.clear();
+	m_lStack.push_back(0);
+	while (!m_lStack.empty())
+	{
+		Node const& node = m_lNode[m_lStack.back()];
+		m_lStack.pop_back();
+		m_Stats.uNodesVisited++;
+
+		// The ray is shortened to the closest hit so far, farther octants are skipped
+		float fDistance = 0.0f;
+		vector3 v3Half(node.fHalfSize);
+		if (!IsRayHittingBox(a_v3Origin, v3InvDirection, node.v3Center - v3Half, node.v3Center + v3Half, a_fMaxDistance, fDistance))
+		{
+			continue;
+		}
+
+		if (node.uChildMask != 0)
+		{
+			uint uChildren = static_cast<uint>(std::bitset<8>(node.uChildMask).count());
+			for (uint i = 0; i < uChildren; i++)
+			{
+				m_lStack.push_back(node.uFirstChild + i);
+			}
+			continue;
+		}
+
+		for (uint i = node.uEntityStart; i < node.uEntityStart + node.uEntityCount; i++)
+		{
+			uint uEntity = m_lGroupEntity[i];
+			if (!(m_lCategory[uEntity] & a_uMask)) { continue; }
+
+			if (IsRayHittingBox(a_v3Origin, v3InvDirection, m_lMin[uEntity], m_lMax[uEntity], a_fMaxDistance, fDistance))
+			{
+				a_fMaxDistance = fDistance;
+				a_uEntity = uEntity;
+				a_fDistance = fDistance;
+				bHit = true;
+			}
+		}
+	}
+	return bHit;
+}
+
+void Simplex::MyOctreeBroadphase::SetSharedView(bool a_bShare)
+{
+	m_bShareView = a_bShare;
+	m_bViewTree = true;
+	m_bViewBounds = true;
+	if (m_bShareView)
+	{
+		PublishView();
+		return;
+	}
+
+	View* pOld = m_pView.exchange(nullptr);
+	if (pOld != nullptr)
+	{
+		m_Epoch.Retire([pOld]() { delete pOld; });
+	}
+	m_Epoch.Collect();
+}
+
+bool Simplex::MyOctreeBroadphase::IsSharedView(void)
+{
+	return m_bShareView;
+}
+
+void Simplex::MyOctreeBroadphase::QueryAABBShared(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities)
+{
+	MyEpochGuard guard(&m_Epoch);
+	View const* pView = m_pView.load();
+	if (pView == nullptr || pView->pNode->empty()) { return; }
+
+	std::vector<Node> const& lNode = *pView->pNode;
+	std::vector<uint> const& lEntity = *pView->pEntity;
+	std::vector<uint> const& lCategory = *pView->pCategory;
+	std::vector<vector3> const& lMin = *pView->pMin;
+	std::vector<vector3> const& lMax = *pView->pMax;
+
+	// Same walk as QueryAABB, with a stack of its own; the straddling entities are removed at the end instead of
+	// being stamped, the stamps belong to the thread updating
+	uint uFirst = static_cast<uint>(a_lEntities.size());
+	std::vector<uint> lStack;
+	lStack.push_back(0);
+	while (!lStack.empty())
+	{
+		Node const& node = lNode[lStack.back()];
+		lStack.pop_back();
+
+		vector3 v3Half(node.fHalfSize);
+		if (!IsBoxOverlapping(a_v3Min, a_v3Max, node.v3Center - v3Half, node.v3Center + v3Half)) { continue; }
+
+		if (node.uChildMask != 0)
+		{
+			uint uChildren = static_cast<uint>(std::bitset<8>(node.uChildMask).count());
+			for (uint i = 0; i < uChildren; i++)
+			{
+				lStack.push_back(node.uFirstChild + i);
+			}
+			continue;
+		}
+
+		for (uint i = node.uEntityStart; i < node.uEntityStart + node.uEntityCount; i++)
+		{
+			uint uEntity = lEntity[i];
+			if ((lCategory[uEntity] & a_uMask) && IsBoxOverlapping(a_v3Min, a_v3Max, lMin[uEntity], lMax[uEntity]))
+			{
+				a_lEntities.push_back(uEntity);
+			}
+		}
+	}
+
+	std::sort(a_lEntities.begin() + uFirst, a_lEntities.end());
+	a_lEntities.erase(std::unique(a_lEntities.begin() + uFirst, a_lEntities.end()), a_lEntities.end());
+}
+
+bool Simplex::MyOctreeBroadphase::RaycastShared(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float a_fMaxDistance, uint a_uMask,
+	uint& a_uEntity, float& a_fDistance)
+{
+	MyEpochGuard guard(&m_Epoch);
+	View const* pView = m_pView.load();
+	if (pView == nullptr || pView->pNode->empty()) { return false; }
+
+	std::vector<Node> const& lNode = *pView->pNode;
+	std::vector<uint> const& lEntity = *pView->pEntity;
+	std::vector<uint> const& lCategory = *pView->pCategory;
+	std::vector<vector3> const& lMin = *pView->pMin;
+	std::vector<vector3> const& lMax = *pView->pMax;
+
+	vector3 v3InvDirection = 1.0f / a_v3Direction;
+	bool bHit = false;
+
+	std::vector<uint> lStack;
+	lStack.push_back(0);
+	while (!lStack.empty())
+	{
+		Node const& node = lNode[lStack.back()];
+		lStack.pop_back();
+
+		// The ray is shortened to the closest hit so far, farther octants are skipped
+		float fDistance = 0.0f;
+		vector3 v3Half(node.fHalfSize);
+		if (!IsRayHittingBox(a_v3Origin, v3InvDirection, node.v3Center - v3Half, node.v3Center + v3Half, a_fMaxDistance, fDistance))
+		{
+			continue;
+		}
+
+		if (node.uChildMask != 0)
+		{
+			uint uChildren = static_cast<uint>(std::bitset<8>(node.uChildMask).count());
+			for (uint i = 0; i < uChildren; i++)
+			{
+				lStack.push_back(node.uFirstChild + i);
+			}
+			continue;
+		}
+
+		for (uint i = node.uEntityStart; i < node.uEntityStart + node.uEntityCount; i++)
+		{
+			uint uEntity = lEntity[i];
+			if (!(lCategory[uEntity] & a_uMask)) { continue; }
+
+			if (IsRayHittingBox(a_v3Origin, v3InvDirection, lMin[uEntity], lMax[uEntity], a_fMaxDistance, fDistance))
+			{
+				a_fMaxDistance = fDistance;
+				a_uEntity = uEntity;
+				a_fDistance = fDistance;
+				bHit = true;
+			}
+		}
+	}
+	return bHit;
+}
+
+void Simplex::MyOctreeBroadphase::QueryNearestShared(vector3 const& a_v3Point, uint a_uCount, uint a_uMask, std::vector<uint>& a_lEntities)
+{
+	if (a_uCount == 0) { return; }
+
+	MyEpochGuard guard(&m_Epoch);
+	View const* pView = m_pView.load();
+	if (pView == nullptr || pView->pNode->empty()) { return; }
+
+	std::vector<Node> const& lNode = *pView->pNode;
+	std::vector<uint> const& lEntity = *pView->pEntity;
+	std::vector<uint> const& lCategory = *pView->pCategory;
+	std::vector<vector3> const& lMin = *pView->pMin;
+	std::vector<vector3> const& lMax = *pView->pMax;
+
+	// Squared distances from the point to a box, 0 inside of it
+	auto GetDistance = [&a_v3Point](vector3 const& a_v3Min, vector3 const& a_v3Max)
+		{
+			vector3 v3Offset = glm::clamp(a_v3Point, a_v3Min, a_v3Max) - a_v3Point;
+			return glm::dot(v3Offset, v3Offset);
+		};
+
+	// Octants closest first, the best entities so far in a heap with the farthest on top
+	typedef std::pair<float, uint> Candidate;
+	std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> lOctant;
+	std::vector<Candidate> lBest;
+	vector3 v3Half(lNode[0].fHalfSize);
+	lOctant.push(Candidate(GetDistance(lNode[0].v3Center - v3Half, lNode[0].v3Center + v3Half), 0));
+	while (!lOctant.empty())
+	{
+		Candidate octant = lOctant.top();
+		lOctant.pop();
+		if (lBest.size() == a_uCount && octant.first > lBest.front().first) { break; }
+
+		Node const& node = lNode[octant.second];
+		if (node.uChildMask != 0)
+		{
+			uint uChildren = static_cast<uint>(std::bitset<8>(node.uChildMask).count());
+			for (uint i = 0; i < uChildren; i++)
+			{
+				Node const& child = lNode[node.uFirstChild + i];
+				v3Half = vector3(child.fHalfSize);
+				lOctant.push(Candidate(GetDistance(child.v3Center - v3Half, child.v3Center + v3Half), node.uFirstChild + i));
+			}
+			continue;
+		}
+
+		for (uint i = node.uEntityStart; i < node.uEntityStart + node.uEntityCount; i++)
+		{
+			uint uEntity = lEntity[i];
+			if (!(lCategory[uEntity] & a_uMask)) { continue; }
+
+			float fDistance = GetDistance(lMin[uEntity], lMax[uEntity]);
+			if (lBest.size() == a_uCount && fDistance >= lBest.front().first) { continue; }
+
+			// Entities straddling octants come up once per leaf, the list is short enough to look through
+			bool bKnown = false;
+			for (uint j = 0; j < lBest.size() && !bKnown; j++)
+			{
+				bKnown = lBest[j].second == uEntity;
+			}
+			if (bKnown) { continue; }
+
+			if (lBest.size() == a_uCount)
+			{
+				std::pop_heap(lBest.begin(), lBest.end());
+				lBest.pop_back();
+			}
+			lBest.push_back(Candidate(fDistance, uEntity));
+			std::push_heap(lBest.begin(), lBest.end());
+		}
+	}
+
+	std::sort_heap(lBest.begin(), lBest.end());
+	for (uint i = 0; i < lBest.size(); i++)
+	{
+		a_lEntities.push_back(lBest[i].second);
+	}
+}
+
+String Simplex::MyOctreeBroadphase::GetName(void)
+{
+	return "Octree";
+}
+
+void Simplex::MyOctreeBroadphase::GetMemoryReport(MyMemoryReport& a_Report)
+{
+	MyBroadphase::GetMemoryReport(a_Report);
+
+	// The octants are kept for the dimensions and the display, the queries only walk the compact nodes
+	MyOctant* pRoot = m_pRoot.load();
+	if (pRoot != nullptr)
+	{
+		MyMemoryReport octants;
+		pRoot->GetMemoryReport(octants);
+		a_Report.uIndexBytes += octants.uIndexBytes;
+		a_Report.uSlackBytes += octants.uSlackBytes;
+		a_Report.uDimensionBytes += octants.uDimensionBytes;
+		a_Report.uAuxiliaryBytes += octants.uNodeBytes + octants.uAuxiliaryBytes;
+	}
+	a_Report.uNodeCount += static_cast<uint>(m_lNode.size());
+	a_Report.AddList(m_lNode, a_Report.uNodeBytes);
+
+	// The flattened leaf lists hold entity indices too, the rest are lookups for the queries
+	a_Report.AddList(m_lEntityLeafStart, a_Report.uIndexBytes);
+	a_Report.AddList(m_lEntityLeaf, a_Report.uIndexBytes);
+	a_Report.AddList(m_lGroupEntity, a_Report.uIndexBytes);
+	a_Report.AddList(m_lNodeInfo, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lLeaf, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lLeafNode, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lLeafGroupStart, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lGroup, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lStack, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lStamp, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lBuildMin, a_Report.uAuxiliaryBytes);
+	a_Report.AddList(m_lBuildMax, a_Report.uAuxiliaryBytes);
+
+	// The parts of the copy shared with the tree are counted again, the readers hold them on their own
+	View const* pView = m_pView.load();
+	if (pView != nullptr)
+	{
+		a_Report.AddList(*pView->pNode, a_Report.uAuxiliaryBytes);
+		a_Report.AddList(*pView->pEntity, a_Report.uAuxiliaryBytes);
+		a_Report.AddList(*pView->pCategory, a_Report.uAuxiliaryBytes);
+		a_Report.AddList(*pView->pMin, a_Report.uAuxiliaryBytes);
+		a_Report.AddList(*pView->pMax, a_Report.uAuxiliaryBytes);
+	}
+}
+
+void Simplex::MyOctreeBroadphase::PublishView(void)
+{
+	View* pOld = m_pView.load();
+	if (!m_bShareView || (pOld != nullptr && !m_bViewTree && !m_bViewBounds)) { return; }
+
+	// The parts that did not change are shared with the old copy, the readers of either never see them change
+	MY_PROFILE_ZONE("PublishView");
+	View* pView = pOld != nullptr ? new View(*pOld) : new View();
+	if (pOld == nullptr || m_bViewTree)
+	{
+		pView->pNode = std::make_shared<std::vector<Node> const>(m_lNode);
+		pView->pEntity = std::make_shared<std::vector<uint> const>(m_lGroupEntity);
+		pView->pCategory = std::make_shared<std::vector<uint> const>(m_lCategory);
+	}
+	if (pOld == nullptr || m_bViewBounds)
+	{
+		pView->pMin = std::make_shared<std::vector<vector3> const>(m_lMin);
+		pView->pMax = std::make_shared<std::vector<vector3> const>(m_lMax);
+	}
+	m_bViewTree = false;
+	m_bViewBounds = false;
+
+	m_pView.store(pView);
+	if (pOld != nullptr)
+	{
+		m_Epoch.Retire([pOld]() { delete pOld; });
+	}
+	m_Epoch.Collect();
+}
+
+void Simplex::MyOctreeBroadphase::StartBuild(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	// Settings changed while a rebuild runs stay dirty, the next one picks them up; a cancelled rebuild still
+	// reads the copy of the bounds, so a new one waits for it too
+	if (IsBuilding() || CollectAbandoned()) { return; }
+
+	m_bDirty = false;
+	m_lBuildMin = a_lMin;
+	m_lBuildMax = a_lMax;
+
+	// With a budget the updates build it a slice at a time, nothing else reads the copy of the bounds meanwhile
+	if (m_fBuildBudget > 0.0f)
+	{
+		m_pBuilder = new MyOctantBuilder(&m_lBuildMin, &m_lBuildMax, m_uMaxLevel, m_uIdealEntityCount);
+		return;
+	}
+
+	// The worker only reads its own copy of the bounds and leaves the dimensions of the entities alone; it builds
+	// in slices too so a cancelled rebuild stops within one of them instead of running to the end
+	std::vector<vector3> const* pMin = &m_lBuildMin;
+	std::vector<vector3> const* pMax = &m_lBuildMax;
+	uint uMaxLevel = m_uMaxLevel;
+	uint uIdealEntityCount = m_uIdealEntityCount;
+	std::shared_ptr<std::atomic<bool>> pCancel = std::make_shared<std::atomic<bool>>(false);
+	m_pCancel = pCancel;
+	m_Build = std::async(std::launch::async, [pMin, pMax, uMaxLevel, uIdealEntityCount, pCancel]()
+		{
+			MY_PROFILE_THREAD("Octree build");
+			MY_PROFILE_ZONE("ConstructTree");
+			MyOctantBuilder builder(pMin, pMax, uMaxLevel, uIdealEntityCount);
+			while (!builder.Step(CANCEL_CHECK))
+			{
+				if (pCancel->load()) { return static_cast<MyOctant*>(nullptr); }
+			}
+			return builder.TakeRoot();
+		});
+}
+
+void Simplex::MyOctreeBroadphase::PublishBuild(MyOctant* a_pRoot, std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	// Not sliced: the dimensions of the entities and the compact nodes have to switch to the new tree in the same
+	// update as the root, or the queries would mix the two trees. It reassigns every entity once, the same work
+	// as a Refit on any update where the entities move, so swapping in costs a moving update and not a rebuild
+	MY_PROFILE_ZONE("PublishTree");
+	MyOctant* pRoot = a_pRoot;
+	pRoot->SetBoundsList(&m_lMin, &m_lMax);
+	SetRoot(pRoot);
+	m_lStamp.assign(a_lMin.size(), 0);
+	m_uStamp = 0;
+
+	// Entities that stayed put since the copy keep the leaves the rebuild put them in, otherwise the new
+	// subdivisions are fitted to where they are now; either way their dimensions switch over here
+	if (a_lMin == m_lBuildMin && a_lMax == m_lBuildMax)
+	{
+		CopyBounds(a_lMin, a_lMax);
+		m_bViewBounds = true;
+		pRoot->AssignDimensions();
+		GatherLeaves();
+	}
+	else
+	{
+		m_fBuildCost = FLT_MAX;
+		Refit(a_lMin, a_lMax);
+	}
+	m_fBuildCost = GetLeafCost();
+	MY_PROFILE_COUNTER("Octants", m_pRoot.load()->GetOctantCount());
+}
+
+void Simplex::MyOctreeBroadphase::CancelBuild(void)
+{
+	SafeDelete(m_pBuilder);
+	if (!m_Build.valid()) { return; }
+
+	// Waiting for the worker would stall the update for a whole rebuild, it stops at its next slice and whatever
+	// it made is dropped by a later update
+	m_pCancel->store(true);
+	m_pCancel.reset();
+	m_lAbandoned.push_back(std::move(m_Build));
+}
+
+bool Simplex::MyOctreeBroadphase::CollectAbandoned(void)
+{
+	for (uint i = 0; i < m_lAbandoned.size();)
+	{
+		if (m_lAbandoned[i].wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		{
+			i++;
+			continue;
+		}
+
+		MyOctant* pRoot = m_lAbandoned[i].get();
+		SafeDelete(pRoot);
+		m_lAbandoned.erase(m_lAbandoned.begin() + i);
+	}
+	return !m_lAbandoned.empty();
+}
+
+void Simplex::MyOctreeBroadphase::SetRoot(MyOctant* a_pRoot)
+{
+	MyOctant* pOld = m_pRoot.exchange(a_pRoot);
+	if (pOld != nullptr)
+	{
+		m_Epoch.Retire([pOld]() { delete pOld; });
+	}
+	m_Epoch.Collect();
+}
+
+void Simplex::MyOctreeBroadphase::Refit(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	MY_PROFILE_ZONE("RefitTree");
+	CopyBounds(a_lMin, a_lMax);
+	m_bViewBounds = true;
+
+	// Grow toward the corner of the scene sticking out of the root, each step doubles its size
+	MyOctant* pRoot = m_pRoot.load();
+	uint uGrowth = 0;
+	while (glm::any(glm::lessThan(m_v3SceneMin, pRoot->GetMinGlobal())) ||
+		glm::any(glm::greaterThan(m_v3SceneMax, pRoot->GetMaxGlobal())))
+	{
+		// A root this far off would leave entities out of every leaf until the rebuild is done, build it here;
+		// growing freed nothing, the grown root holds the old tree and Build retires them together
+		if (uGrowth == MAX_GROWTH)
+		{
+			m_pRoot.store(pRoot);
+			Build(a_lMin, a_lMax);
+			return;
+		}
+
+		vector3 v3Toward = m_v3SceneMax;
+		for (uint i = 0; i < 3; i++)
+		{
+			if (m_v3SceneMin[i] < pRoot->GetMinGlobal()[i]) { v3Toward[i] = m_v3SceneMin[i]; }
+		}
+		pRoot = pRoot->Grow(v3Toward);
+		uGrowth++;
+	}
+
+	// Shrink while a single child of the root holds the whole scene, the roots left behind still hold the other
+	// children and a reader of the published tree may be walking them
+	uint uShrink = 0;
+	for (MyOctant* pChild = pRoot->Shrink(m_v3SceneMin, m_v3SceneMax); pChild != pRoot; pChild = pRoot->Shrink(m_v3SceneMin, m_v3SceneMax))
+	{
+		MyOctant* pDropped = pRoot;
+		m_Epoch.Retire([pDropped]() { delete pDropped; });
+		pRoot = pChild;
+		uShrink++;
+	}
+	m_pRoot.store(pRoot);
+	m_Epoch.Collect();
+	MY_PROFILE_COUNTER("Root growth", static_cast<int>(uGrowth) - static_cast<int>(uShrink));
+
+	pRoot->ReassignEntities();
+	GatherLeaves();
+
+	// The subdivisions were made for where the entities were, start a rebuild once the leaves got too
+	// crowded; the crowded tree still finds every pair in the meantime
+	if (GetLeafCost() > m_fBuildCost * REBUILD_FACTOR + m_uEntityCount)
+	{
+		StartBuild(a_lMin, a_lMax);
+	}
+}
+
+float Simplex::MyOctreeBroadphase::GetLeafCost(void)
+{
+	float fCost = 0.0f;
+	for (uint uLeaf = 0; uLeaf < m_lLeaf.size(); uLeaf++)
+	{
+		float fCount = static_cast<float>(m_lLeaf[uLeaf]->GetEntityList().size());
+		fCost += fCount * (fCount - 1.0f) / 2.0f;
+	}
+	return fCost;
+}
+
+void Simplex::MyOctreeBroadphase::GatherLeaves(void)
+{
+	m_lNode.clear();
+	m_lNodeInfo.clear();
+	m_lLeaf.clear();
+	m_lLeafNode.clear();
+	m_lEntityLeafStart.assign(m_uEntityCount + 1, 0);
+	m_lEntityLeaf.clear();
+	if (m_pRoot.load() == nullptr)
+	{
+		GroupLeaves();
+		return;
+	}
+
+	// Breadth first, the children of a node are appended together right after the ones already queued
+	MyOctant* pRoot = m_pRoot.load();
+	Node root;
+	root.v3Center = pRoot->GetCenterGlobal();
+	root.fHalfSize = pRoot->GetSize() / 2.0f;
+	NodeInfo rootInfo;
+	rootInfo.pOctant = pRoot;
+	m_lNode.push_back(root);
+	m_lNodeInfo.push_back(rootInfo);
+	for (uint uNode = 0; uNode < m_lNode.size(); uNode++)
+	{
+		MyOctant* pOctant = m_lNodeInfo[uNode].pOctant;
+		if (pOctant->IsLeaf())
+		{
+			if (!pOctant->GetEntityList().empty())
+			{
+				m_lNodeInfo[uNode].uLeaf = static_cast<uint>(m_lLeaf.size());
+				m_lLeaf.push_back(pOctant);
+				m_lLeafNode.push_back(uNode);
+			}
+			continue;
+		}
+
+		// Empty leaves are skipped, an inner octant a refit left empty stays as a node with no children or entities
+		m_lNode[uNode].uFirstChild = static_cast<uint>(m_lNode.size());
+		for (uint i = 0; i < 8; i++)
+		{
+			MyOctant* pChild = pOctant->GetChild(i);
+			if (pChild->IsLeaf() && pChild->GetEntityList().empty()) { continue; }
+
+			m_lNode[uNode].uChildMask |= 1 << i;
+			Node node;
+			node.v3Center = pChild->GetCenterGlobal();
+			node.fHalfSize = pChild->GetSize() / 2.0f;
+			NodeInfo info;
+			info.pOctant = pChild;
+			info.uLevel = m_lNodeInfo[uNode].uLevel + 1;
+			m_lNode.push_back(node);
+			m_lNodeInfo.push_back(info);
+		}
+	}
+
+	// Count the leaves of each entity, the prefix sum gives each entity its range
+	for (uint uLeaf = 0; uLeaf < m_lLeaf.size(); uLeaf++)
+	{
+		std::vector<uint> const& lEntity = m_lLeaf[uLeaf]->GetEntityList();
+		for (uint i = 0; i < lEntity.size(); i++)
+		{
+			m_lEntityLeafStart[lEntity[i] + 1]++;
+		}
+	}
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		m_lEntityLeafStart[i + 1] += m_lEntityLeafStart[i];
+	}
+
+	// Visiting the leaves in order leaves every range sorted
+	std::vector<uint> lCursor(m_lEntityLeafStart.begin(), m_lEntityLeafStart.end() - 1);
+	m_lEntityLeaf.resize(m_lEntityLeafStart[m_uEntityCount]);
+	for (uint uLeaf = 0; uLeaf < m_lLeaf.size(); uLeaf++)
+	{
+		std::vector<uint> const& lEntity = m_lLeaf[uLeaf]->GetEntityList();
+		for (uint i = 0; i < lEntity.size(); i++)
+		{
+			m_lEntityLeaf[lCursor[lEntity[i]]++] = uLeaf;
+		}
+	}
+
+	GroupLeaves();
+}
+
+void Simplex::MyOctreeBroadphase::GroupLeaves(void)
+{
+	m_bFilterChanged = false;
+	m_bViewTree = true;
+	m_lLeafGroupStart.assign(1, 0);
+	m_lGroup.clear();
+	m_lGroupEntity.clear();
+
+	for (uint uLeaf = 0; uLeaf < m_lLeaf.size(); uLeaf++)
+	{
+		// Sort the entities of the leaf by category, each run of the same category is one group
+		std::vector<uint> const& lEntity = m_lLeaf[uLeaf]->GetEntityList();
+		uint uStart = static_cast<uint>(m_lGroupEntity.size());
+		m_lGroupEntity.insert(m_lGroupEntity.end(), lEntity.begin(), lEntity.end());
+		std::stable_sort(m_lGroupEntity.begin() + uStart, m_lGroupEntity.end(),
+			[this](uint a, uint b) { return m_lCategory[a] < m_lCategory[b]; });
+
+		Node& node = m_lNode[m_lLeafNode[uLeaf]];
+		node.uEntityStart = uStart;
+		node.uEntityCount = static_cast<uint>(lEntity.size());
+
+		for (uint i = uStart; i < m_lGroupEntity.size(); i++)
+		{
+			uint uEntity = m_lGroupEntity[i];
+			if (i == uStart || m_lCategory[uEntity] != m_lGroup.back().uCategory)
+			{
+				Group group;
+				group.uCategory = m_lCategory[uEntity];
+				group.uStart = i;
+				m_lGroup.push_back(group);
+			}
+			m_lGroup.back().uMask |= m_lMask[uEntity];
+			m_lGroup.back().uEnd = i + 1;
+		}
+		m_lLeafGroupStart.push_back(static_cast<uint>(m_lGroup.size()));
+	}
+}
+
+uint Simplex::MyOctreeBroadphase::GetFirstSharedLeaf(uint a_uA, uint a_uB)
+{
+	uint a = m_lEntityLeafStart[a_uA], uEndA = m_lEntityLeafStart[a_uA + 1];
+	uint b = m_lEntityLeafStart[a_uB], uEndB = m_lEntityLeafStart[a_uB + 1];
+
+	// Merge the two sorted ranges until they meet
+	while (a < uEndA && b < uEndB)
+	{
+		if (m_lEntityLeaf[a] == m_lEntityLeaf[b]) { return m_lEntityLeaf[a]; }
+		if (m_lEntityLeaf[a] < m_lEntityLeaf[b]) { a++; }
+		else { b++; }
+	}
+	return (uint)-1;
+}
@@ -0,0 +1,434 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYOCTREEBROADPHASE_H_
+#define __MYOCTREEBROADPHASE_H_
+
+#include "MyBroadphase.h"
+#include "MyEpoch.h"
+#include <future>
+#include <memory>
+
+namespace Simplex
+{
+	class MyOctant;
+	class MyOctantBuilder;
+
+	// Broadphase adapter around MyOctant, the octree assigns its leaves as the dimensions of the entities; the
+	// queries walk a compact copy of it. Rebuilds run on a worker, or a slice per update within a time budget, while
+	// the old tree keeps serving the queries, and other threads can query a read only copy published after every update
+	class MyOctreeBroadphase : public MyBroadphase
+	{
+		// Node of the compact tree, half a cache line; the children of a node are contiguous and the ones holding no
+		// entities are left out
+		struct Node
+		{
+			vector3 v3Center = vector3(0.0f);
+			float fHalfSize = 0.0f;
+			uint uFirstChild = 0; // first child in m_lNode, the others follow it in octant order
+			uint uEntityStart = 0; // first entry of a leaf in m_lGroupEntity
+			uint uEntityCount = 0; // entries of a leaf in m_lGroupEntity, 0 for inner nodes
+			unsigned char uChildMask = 0; // bit i is set when child octant i is in the tree, 0 for leaves
+		};
+		static_assert(sizeof(Node) == 32, "The compact octree node is meant to fit in 32 bytes");
+
+		// Cold data of a node, only looked at when debugging or drawing so the queries never load it
+		struct NodeInfo
+		{
+			MyOctant* pOctant = nullptr; // octant the node was copied from
+			uint uLevel = 0; // depth of the node, 0 for the root
+			uint uLeaf = (uint)-1; // index in m_lLeaf, -1 for inner nodes and empty leaves
+		};
+
+		// Entities of a leaf sharing the same category, combinations of groups whose layers ignore each other are skipped whole
+		struct Group
+		{
+			uint uCategory = 0; // category of every entity in the group
+			uint uMask = 0; // union of the masks of the entities in the group
+			uint uStart = 0; // first entry in m_lGroupEntity
+			uint uEnd = 0; // one past the last entry in m_lGroupEntity
+		};
+
+		// Read only copy of the compact tree for the other threads, the parts an update did not change are shared
+		// with the copy before it
+		struct View
+		{
+			std::shared_ptr<std::vector<Node> const> pNode;
+			std::shared_ptr<std::vector<uint> const> pEntity; // entities of every leaf, the leaf nodes point to their range
+			std::shared_ptr<std::vector<uint> const> pCategory; // category of each entity
+			std::shared_ptr<std::vector<vector3> const> pMin; // global minimum of each entity
+			std::shared_ptr<std::vector<vector3> const> pMax; // global maximum of each entity
+		};
+
+		static constexpr float REBUILD_FACTOR = 2.0f; // growth of the pair tests in the leaves that makes a refit rebuild
+		static constexpr uint MAX_GROWTH = 32; // doublings of the root a refit tries before rebuilding
+		static constexpr float CANCEL_CHECK = 1000.0f; // microseconds the worker builds between two looks at its cancel flag
+
+		std::atomic<MyOctant*> m_pRoot; // published tree, replaced whole when a rebuild is done
+		MyEpoch m_Epoch; // readers of the published tree, the replaced ones wait for them before being deleted
+		std::future<MyOctant*> m_Build; // rebuild running on the worker, not valid while there is none
+		std::shared_ptr<std::atomic<bool>> m_pCancel; // set to make the rebuild on the worker give up
+		std::vector<std::future<MyOctant*>> m_lAbandoned; // cancelled rebuilds still on the worker, deleted once done
+		std::vector<vector3> m_lBuildMin; // bounds the rebuild reads, left alone until it is published or the cancelled one is done
+		std::vector<vector3> m_lBuildMax;
+		MyOctantBuilder* m_pBuilder = nullptr; // rebuild sliced over the updates, nullptr while there is none
+		float m_fBuildBudget = 0.0f; // microseconds of rebuild per update, 0 runs the rebuilds on the worker
+		std::atomic<View*> m_pView; // copy the readers load, retired to m_Epoch when the next one replaces it
+		bool m_bShareView = false; // is a copy published after every update?
+		bool m_bViewTree = true; // the nodes or the leaves changed since the last copy
+		bool m_bViewBounds = true; // the bounds changed since the last copy
+		uint m_uMaxLevel = 0; // maximum level of subdivision
+		uint m_uIdealEntityCount = 5; // entities per octant before it subdivides
+		bool m_bDirty = true; // the tree has to be rebuilt on the next update
+		float m_fBuildCost = 0.0f; // pair tests in the leaves right after the last rebuild
+
+		std::vector<Node> m_lNode; // compact tree in breadth first order, the root is the first node
+		std::vector<NodeInfo> m_lNodeInfo; // cold side table, one entry per node
+		std::vector<MyOctant*> m_lLeaf; // leaves holding at least one entity
+		std::vector<uint> m_lLeafNode; // node of every leaf in m_lNode
+		std::vector<uint> m_lEntityLeafStart; // first entry of each entity in m_lEntityLeaf, one extra entry at the end
+		std::vector<uint> m_lEntityLeaf; // leaves of each entity in increasing order
+		std::vector<uint> m_lLeafGroupStart; // first group of each leaf in m_lGroup, one extra entry at the end
+		std::vector<Group> m_lGroup; // per layer sublists of every leaf
+		std::vector<uint> m_lGroupEntity; // entities of every leaf sorted by category, each group is a range
+		std::vector<uint> m_lStack; // traversal stack of node indices reused by the queries
+		std::vector<uint> m_lStamp; // query that last reported each entity, avoids duplicates from straddling entities
+		uint m_uStamp = 0; // current query
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyOctreeBroadphase(void);
+
+		/*
+		USAGE: Destructor
+		*/
+		~MyOctreeBroadphase(void);
+
+		/*
+		USAGE: Sets the maximum level of subdivision, the tree is rebuilt on the next update
+		ARGUMENTS:
+		- uint a_uMaxLevel -> maximum level
+		*/
+		void SetMaxLevel(uint a_uMaxLevel);
+
+		/*
+		USAGE: Gets the maximum level of subdivision
+		OUTPUT: maximum level
+		*/
+		uint GetMaxLevel(void);
+
+		/*
+		USAGE: Sets the number of entities an octant holds before it subdivides, the tree is rebuilt on the next update
+		ARGUMENTS:
+		- uint a_uIdealEntityCount -> ideal entity count
+		*/
+		void SetIdealEntityCount(uint a_uIdealEntityCount);
+
+		/*
+		USAGE: Gets the number of entities an octant holds before it subdivides
+		OUTPUT: ideal entity count
+		*/
+		uint GetIdealEntityCount(void);
+
+		/*
+		USAGE: Gets the number of leaves holding at least one entity
+		OUTPUT: leaf count
+		*/
+		uint GetLeafCount(void);
+
+		/*
+		USAGE: Counts the leaves holding entities by how many they hold, in power of two buckets
+		ARGUMENTS:
+		- uint* a_lBucket -> array to fill, bucket i counts the leaves with 2^i to 2^(i+1) - 1 entities and the
+		last one every leaf past it
+		- uint a_uBuckets -> size of the array
+		*/
+		void GetLeafHistogram(uint* a_lBucket, uint a_uBuckets);
+
+		/*
+		USAGE: Gets the average number of leaves an entity belongs to, entities straddling octants are in several
+		OUTPUT: leaves per entity, 1 when no entity straddles
+		*/
+		float GetDuplicationFactor(void);
+
+		/*
+		USAGE: Adds up the decisions of the split cost model over the octants holding entities
+		ARGUMENTS:
+		- uint& a_uSplit -> octants the model split
+		- uint& a_uKept -> octants the model kept whole although they held more than the ideal entity count
+		- float& a_fSaving -> pair tests the splits were expected to save
+		*/
+		void GetSplitStats(uint& a_uSplit, uint& a_uKept, float& a_fSaving);
+
+		/*
+		USAGE: Gets the number of nodes of the compact tree, octants holding no entities are not in it
+		OUTPUT: node count
+		*/
+		uint GetNodeCount(void);
+
+		/*
+		USAGE: Gets the octant a node of the compact tree was copied from
+		ARGUMENTS:
+		- uint a_uNode -> index of the node
+		OUTPUT: octant, nullptr if the index is out of range
+		*/
+		MyOctant* GetNodeOctant(uint a_uNode);
+
+		/*
+		USAGE: Gets the root of the octree; from another thread than the one updating, load it inside a read
+		section of GetEpoch so a rebuild does not delete it, the octants are only safe to walk between updates
+		OUTPUT: root octant, nullptr if the tree has not been built
+		*/
+		MyOctant* GetOctree(void);
+
+		/*
+		USAGE: Gets the epoch the replaced trees are retired to
+		OUTPUT: epoch
+		*/
+		MyEpoch* GetEpoch(void);
+
+		/*
+		USAGE: Asks if a rebuild is running, on the worker or sliced over the updates
+		OUTPUT: is it running?
+		*/
+		bool IsBuilding(void);
+
+		/*
+		USAGE: Sets the time the updates spend on a rebuild, the next rebuild is sliced with it instead of running
+		on the worker; one already sliced keeps going with the new budget. The update that swaps the rebuild in is
+		not budgeted, it reassigns the entities like an update where they moved
+		ARGUMENTS:
+		- float a_fBudget -> microseconds per update, 0 to rebuild on the worker
+		*/
+		void SetBuildBudget(float a_fBudget);
+
+		/*
+		USAGE: Gets the time the updates spend on a rebuild
+		OUTPUT: microseconds per update, 0 when the rebuilds run on the worker
+		*/
+		float GetBuildBudget(void);
+
+		/*
+		USAGE: Gets how far the running rebuild got, the worker does not report it so its rebuilds stay at 0
+		OUTPUT: fraction between 0 and 1, -1 if no rebuild is running
+		*/
+		float GetBuildProgress(void);
+
+		/*
+		USAGE: Rebuilds the octree around the entities right away, dropping any rebuild still on the worker
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) override;
+
+		/*
+		USAGE: Takes over a tree made for the entities elsewhere, like one read from a snapshot, in place of a
+		rebuild; the entities get their dimensions from it right away
+		ARGUMENTS:
+		- MyOctant* a_pRoot -> root of the tree, owned by the broadphase from here on; nullptr builds one
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void LoadTree(MyOctant* a_pRoot, std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax);
+
+		/*
+		USAGE: Rebuilds the octree on the worker, or a slice of it within the budget, if the settings changed or the
+		leaves got too crowded, and publishes the new one once it is done; until then moved, added and removed entities are assigned again to
+		the subdivisions of the old tree, with the root growing or shrinking to fit the scene; new filters only
+		regroup the leaves
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) override;
+
+		/*
+		USAGE: Appends every pair of entities with overlapping bounds whose filters let them collide, each pair is
+		reported by the first leaf both entities share
+		ARGUMENTS:
+		- MyPairList& a_lPairs -> list to append the pairs to
+		*/
+		void QueryPairs(MyPairList& a_lPairs) override;
+
+		/*
+		USAGE: Appends every entity whose bounds overlap the box
+		ARGUMENTS:
+		- vector3 const& a_v3Min, a_v3Max -> queried box in global space
+		- uint a_uMask -> layers to report
+		- std::vector<uint>& a_lEntities -> list to append the entity indices to
+		*/
+		void QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities) override;
+
+		/*
+		USAGE: Finds the closest entity on the queried layers whose bounds are hit by the ray, only the octants the
+		ray crosses are visited
+		ARGUMENTS:
+		- vector3 const& a_v3Origin -> origin of the ray
+		- vector3 const& a_v3Direction -> normalized direction of the ray
+		- float a_fMaxDistance -> length of the ray
+		- uint a_uMask -> layers the ray can hit
+		- uint& a_uEntity -> index of the entity hit
+		- float& a_fDistance -> distance along the ray to the hit
+		OUTPUT: was anything hit?
+		*/
+		bool Raycast(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float a_fMaxDistance, uint a_uMask,
+			uint& a_uEntity, float& a_fDistance) override;
+
+		/*
+		USAGE: Starts or stops publishing the read only copy the Shared queries use, to be called by the thread
+		updating
+		ARGUMENTS:
+		- bool a_bShare -> publish it?
+		*/
+		void SetSharedView(bool a_bShare);
+
+		/*
+		USAGE: Asks if the read only copy is published
+		OUTPUT: is it shared?
+		*/
+		bool IsSharedView(void);
+
+		/*
+		USAGE: QueryAABB on the last copy published, safe from any thread while the tree is updated; it never waits
+		on the update and the update never waits on it. The indices are the ones of the update that published it
+		ARGUMENTS:
+		- vector3 const& a_v3Min, a_v3Max -> queried box in global space
+		- uint a_uMask -> layers to report
+		- std::vector<uint>& a_lEntities -> list to append the entity indices to
+		*/
+		void QueryAABBShared(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities);
+
+		/*
+		USAGE: Raycast on the last copy published, safe from any thread while the tree is updated
+		ARGUMENTS:
+		- vector3 const& a_v3Origin -> origin of the ray
+		- vector3 const& a_v3Direction -> normalized direction of the ray
+		- float a_fMaxDistance -> length of the ray
+		- uint a_uMask -> layers the ray can hit
+		- uint& a_uEntity -> index of the entity hit
+		- float& a_fDistance -> distance along the ray to the hit
+		OUTPUT: was anything hit?
+		*/
+		bool RaycastShared(vector3 const& a_v3Origin, vector3 const& a_v3Direction, float a_fMaxDistance, uint a_uMask,
+			uint& a_uEntity, float& a_fDistance);
+
+		/*
+		USAGE: Finds the entities on the queried layers whose bounds are closest to a point, on the last copy
+		published; the octants are visited closest first and the search stops once none can hold anything closer.
+		Safe from any thread while the tree is updated
+		ARGUMENTS:
+		- vector3 const& a_v3Point -> point in global space
+		- uint a_uCount -> entities to find
+		- uint a_uMask -> layers to report
+		- std::vector<uint>& a_lEntities -> list to append the entity indices to, closest first
+		*/
+		void QueryNearestShared(vector3 const& a_v3Point, uint a_uCount, uint a_uMask, std::vector<uint>& a_lEntities);
+
+		/*
+		USAGE: Gets a readable name of the structure
+		OUTPUT: name
+		*/
+		String GetName(void) override;
+
+		/*
+		USAGE: Adds up the memory held by the structure
+		ARGUMENTS:
+		- MyMemoryReport& a_Report -> report to add to
+		*/
+		void GetMemoryReport(MyMemoryReport& a_Report) override;
+
+	private:
+		/*
+		USAGE: Publishes a new read only copy if sharing is on and the tree or the bounds changed, the old copy is
+		retired to the epoch
+		*/
+		void PublishView(void);
+
+		/*
+		USAGE: Updates the tree, Update without publishing the copy
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void UpdateTree(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax);
+
+		/*
+		USAGE: Starts a rebuild from a copy of the bounds, sliced if there is a budget and on the worker otherwise,
+		unless one is already running
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void StartBuild(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax);
+
+		/*
+		USAGE: Swaps in a finished rebuild and retires the old tree, then assigns the entities again if they
+		changed since the copy; the dimensions of the entities move to the new tree in the same step
+		ARGUMENTS:
+		- MyOctant* a_pRoot -> root of the rebuilt tree, built from m_lBuildMin and m_lBuildMax
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void PublishBuild(MyOctant* a_pRoot, std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax);
+
+		/*
+		USAGE: Drops the running rebuild, one on the worker is left to finish and deleted by a later update
+		*/
+		void CancelBuild(void);
+
+		/*
+		USAGE: Deletes the cancelled rebuilds the worker finished, without waiting for the others
+		OUTPUT: are some still running?
+		*/
+		bool CollectAbandoned(void);
+
+		/*
+		USAGE: Replaces the published tree, the old one is deleted once no reader can reach it
+		ARGUMENTS:
+		- MyOctant* a_pRoot -> new root, nullptr to leave the octree empty
+		*/
+		void SetRoot(MyOctant* a_pRoot);
+
+		/*
+		USAGE: Fits the root to the scene and assigns the entities to the leaves again, starting a rebuild if the
+		leaves hold too many pairs compared to the last one
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Refit(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax);
+
+		/*
+		USAGE: Gets the number of pairs the leaves holding entities would test without the layers
+		OUTPUT: pair count
+		*/
+		float GetLeafCost(void);
+
+		/*
+		USAGE: Copies the octree into the compact nodes, collecting the leaves holding entities and the list of
+		leaves of every entity
+		*/
+		void GatherLeaves(void);
+
+		/*
+		USAGE: Splits the entities of every leaf into per layer groups, the leaf nodes point to their range
+		*/
+		void GroupLeaves(void);
+
+		/*
+		USAGE: Gets the first leaf shared by two entities
+		ARGUMENTS:
+		- uint a_uA, a_uB -> indices of the entities
+		OUTPUT: index in m_lLeaf of the first shared leaf, -1 if they share none
+		*/
+		uint GetFirstSharedLeaf(uint a_uA, uint a_uB);
+	};
+}
+
+#endif //__MYOCTREEBROADPHASE_H_
@@ -0,0 +1,179 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyOctreeTuner.h"
+#include <algorithm>
+#include <chrono>
+using namespace Simplex;
+
+Simplex::MyOctreeTuner::MyOctreeTuner(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax, uint a_uLevels, uint a_uIdealCount)
+{
+	m_lMin = a_lMin;
+	m_lMax = a_lMax;
+
+	// The configuration in use goes first so the others are cut short against it from the start
+	static const uint lIdealCount[] = { 2, 4, 6, 8, 12, 16 };
+	MyOctreeTrial current;
+	current.uLevels = a_uLevels;
+	current.uIdealCount = a_uIdealCount;
+	m_lTrial.push_back(current);
+	for (uint uLevels = 0; uLevels <= MAX_LEVEL; uLevels++)
+	{
+		for (uint uIdealCount : lIdealCount)
+		{
+			// Without subdivisions the ideal count makes no difference
+			if (uLevels == 0 && uIdealCount != lIdealCount[0]) { continue; }
+			if (uLevels == a_uLevels && (uIdealCount == a_uIdealCount || uLevels == 0)) { continue; }
+
+			MyOctreeTrial trial;
+			trial.uLevels = uLevels;
+			trial.uIdealCount = uIdealCount;
+			m_lTrial.push_back(trial);
+		}
+	}
+	for (MyOctreeTrial& trial : m_lTrial)
+	{
+		trial.fBuildTime = FLT_MAX;
+		trial.fQueryTime = FLT_MAX;
+	}
+}
+
+Simplex::MyOctreeTuner::~MyOctreeTuner(void)
+{
+	SafeDelete(m_pBuilder);
+	SafeDelete(m_pRoot);
+}
+
+bool Simplex::MyOctreeTuner::Step(float a_fBudget)
+{
+	if (m_bDone) { return true; }
+
+	auto tStart = std::chrono::high_resolution_clock::now();
+	float fSpent = 0.0f;
+	do
+	{
+		// The builder gets what is left of the budget, the pairs are tested a chunk at a time
+		auto tChunk = std::chrono::high_resolution_clock::now();
+		if (m_pRoot == nullptr)
+		{
+			if (m_pBuilder == nullptr)
+			{
+				MyOctreeTrial const& trial = m_lTrial[m_uTrial];
+				m_pBuilder = new MyOctantBuilder(&m_lMin, &m_lMax, trial.uLevels, trial.uIdealCount);
+			}
+			bool bBuilt = m_pBuilder->Step(a_fBudget - fSpent);
+			m_fBuildTime += std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - tChunk).count();
+			if (bBuilt)
+			{
+				m_pRoot = m_pBuilder->TakeRoot();
+				SafeDelete(m_pBuilder);
+				m_lStack.push_back(m_pRoot);
+			}
+		}
+		else
+		{
+			bool bTested = StepQuery();
+			m_fQueryTime += std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - tChunk).count();
+			if (bTested) { FinishRound(false); }
+		}
+
+		// A round already slower than the best configuration cannot make this one win
+		if ((m_pBuilder != nullptr || m_pRoot != nullptr) && m_fBuildTime + m_fQueryTime > m_fBest)
+		{
+			FinishRound(true);
+		}
+
+		if (m_uTrial == m_lTrial.size())
+		{
+			std::sort(m_lTrial.begin(), m_lTrial.end(), [](MyOctreeTrial const& a, MyOctreeTrial const& b)
+				{ return a.fBuildTime + a.fQueryTime < b.fBuildTime + b.fQueryTime; });
+			m_bDone = true;
+			return true;
+		}
+		fSpent = std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - tStart).count();
+	} while (fSpent < a_fBudget);
+	return false;
+}
+
+float Simplex::MyOctreeTuner::GetProgress(void)
+{
+	if (m_bDone) { return 1.0f; }
+
+	return (m_uTrial + m_uRound / static_cast<float>(ROUNDS)) / m_lTrial.size();
+}
+
+std::vector<MyOctreeTrial> const& Simplex::MyOctreeTuner::GetTrials(void)
+{
+	return m_lTrial;
+}
+
+bool Simplex::MyOctreeTuner::StepQuery(void)
+{
+	MyOctant* pOctant = m_lStack.back();
+	if (!pOctant->IsLeaf())
+	{
+		m_lStack.pop_back();
+		for (uint i = 8; i > 0; i--)
+		{
+			m_lStack.push_back(pOctant->GetChild(i - 1));
+		}
+		return false;
+	}
+
+	// Same box test QueryPairs makes on the entities sharing a leaf, a row is never split between chunks
+	std::vector<uint> const& lEntity = pOctant->GetEntityList();
+	uint uCount = static_cast<uint>(lEntity.size());
+	if (m_uRow == 0 && uCount > 0) { m_uLeafCount++; }
+	uint uTests = 0;
+	while (m_uRow < uCount && uTests < PAIRS)
+	{
+		uint uA = lEntity[m_uRow];
+		for (uint b = m_uRow + 1; b < uCount; b++)
+		{
+			uint uB = lEntity[b];
+			if (glm::all(glm::lessThanEqual(m_lMin[uA], m_lMax[uB])) && glm::all(glm::lessThanEqual(m_lMin[uB], m_lMax[uA])))
+			{
+				m_uOverlaps++;
+			}
+		}
+		uTests += uCount - m_uRow;
+		m_uRow++;
+	}
+	if (m_uRow < uCount) { return false; }
+
+	m_lStack.pop_back();
+	m_uRow = 0;
+	return m_lStack.empty();
+}
+
+void Simplex::MyOctreeTuner::FinishRound(bool a_bCut)
+{
+	// A configuration cut short before any full round keeps the time it reached, enough to rank it last
+	MyOctreeTrial& trial = m_lTrial[m_uTrial];
+	bool bMeasured = trial.fBuildTime != FLT_MAX;
+	if (!a_bCut || !bMeasured)
+	{
+		trial.fBuildTime = glm::min(trial.fBuildTime, m_fBuildTime);
+		trial.fQueryTime = glm::min(trial.fQueryTime, m_fQueryTime);
+	}
+	if (!a_bCut)
+	{
+		trial.uLeafCount = m_uLeafCount;
+		m_fBest = glm::min(m_fBest, trial.fBuildTime + trial.fQueryTime);
+	}
+
+	SafeDelete(m_pBuilder);
+	SafeDelete(m_pRoot);
+	m_lStack.clear();
+	m_uRow = 0;
+	m_uLeafCount = 0;
+	m_fBuildTime = 0.0f;
+	m_fQueryTime = 0.0f;
+	if (a_bCut || ++m_uRound == ROUNDS)
+	{
+		m_uRound = 0;
+		m_uTrial++;
+	}
+}
@@ -0,0 +1,104 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYOCTREETUNER_H_
+#define __MYOCTREETUNER_H_
+
+#include "MyOctantBuilder.h"
+
+namespace Simplex
+{
+	// Times the octree configurations on a copy of the scene a slice at a time, so tuning never costs an update
+	// more than its budget; each candidate is built with a MyOctantBuilder and then its leaves test their pairs
+	class MyOctreeTuner
+	{
+		static constexpr uint MAX_LEVEL = 6; // deepest octree tried
+		static constexpr uint ROUNDS = 2; // times every configuration is measured, the best one counts
+		static constexpr uint PAIRS = 4096; // pair tests between two reads of the clock, an entity's row is never split
+
+		std::vector<vector3> m_lMin; // global minimum of each entity when the tuning started
+		std::vector<vector3> m_lMax; // global maximum of each entity when the tuning started
+		std::vector<MyOctreeTrial> m_lTrial; // every configuration, sorted cheapest first once done
+		uint m_uTrial = 0; // configuration being measured
+		uint m_uRound = 0; // round of the configuration being measured
+		float m_fBest = FLT_MAX; // cheapest build plus query time so far, slower rounds are cut short
+		float m_fBuildTime = 0.0f; // milliseconds the round spent building so far
+		float m_fQueryTime = 0.0f; // milliseconds the round spent testing pairs so far
+
+		MyOctantBuilder* m_pBuilder = nullptr; // tree of the round while it is built
+		MyOctant* m_pRoot = nullptr; // tree of the round once built, while its leaves test their pairs
+		std::vector<MyOctant*> m_lStack; // octants left to visit, the top one is in progress
+		uint m_uRow = 0; // next entity of the leaf on top of the stack whose pairs are tested
+		uint m_uLeafCount = 0; // leaves holding entities visited so far
+		uint m_uOverlaps = 0; // pairs found overlapping, kept so the tests are not optimized away
+		bool m_bDone = false;
+
+	public:
+		/*
+		USAGE: Constructor, copies the bounds; nothing is measured until Step
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		- uint a_uLevels -> maximum level in use, its configuration is measured first
+		- uint a_uIdealCount -> ideal entity count in use
+		OUTPUT: class object
+		*/
+		MyOctreeTuner(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax, uint a_uLevels, uint a_uIdealCount);
+
+		/*
+		USAGE: Destructor, deletes the tree of the round in progress
+		*/
+		~MyOctreeTuner(void);
+
+		/*
+		USAGE: Measures until the time runs out or every configuration is done; the clock is read after every
+		chunk of octants or pairs, so the step overruns the budget by about one chunk
+		ARGUMENTS:
+		- float a_fBudget -> microseconds to spend, at least one chunk is done
+		OUTPUT: is the tuning done?
+		*/
+		bool Step(float a_fBudget);
+
+		/*
+		USAGE: Gets how many configurations were measured
+		OUTPUT: fraction between 0 and 1, 1 once the tuning is done
+		*/
+		float GetProgress(void);
+
+		/*
+		USAGE: Gets the measured configurations, a configuration cut short for being slower than the best one
+		keeps the time it had reached
+		OUTPUT: trials sorted by build plus query time once done, in measuring order before
+		*/
+		std::vector<MyOctreeTrial> const& GetTrials(void);
+
+	private:
+		/*
+		USAGE: Visits one chunk of the tree of the round, testing the pairs of its leaves
+		OUTPUT: are all the pairs tested?
+		*/
+		bool StepQuery(void);
+
+		/*
+		USAGE: Keeps the times of the round and moves to the next round or configuration
+		ARGUMENTS:
+		- bool a_bCut -> was the round cut short for being slower than the best one? the configuration is not
+		measured again
+		*/
+		void FinishRound(bool a_bCut);
+
+		/*
+		USAGE: Copy constructor
+		*/
+		MyOctreeTuner(MyOctreeTuner const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyOctreeTuner& operator=(MyOctreeTuner const& a_pOther);
+	};
+}
+
+#endif //__MYOCTREETUNER_H_
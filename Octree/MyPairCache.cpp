@@ -0,0 +1,155 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyPairCache.h"
+using namespace Simplex;
+
+Simplex::MyPairCache::MyPairCache(void)
+{
+	m_uFrame = 0;
+	m_uPairCount = 0;
+	m_lEntry.resize(64);
+	m_uHashShift = 58;
+}
+
+void Simplex::MyPairCache::BeginFrame(void)
+{
+	m_uFrame++;
+}
+
+MyPairCache::Entry& Simplex::MyPairCache::Touch(uint a_uA, uint a_uB, bool& a_bNew)
+{
+	if (a_uA > a_uB) { std::swap(a_uA, a_uB); }
+	unsigned long long uKey = ((unsigned long long)a_uA << 32) | a_uB;
+
+	// Keep the table at most half full so the probe sequences stay short
+	if ((m_uPairCount + 1) * 2 > m_lEntry.size()) { Grow(); }
+
+	uint uMask = static_cast<uint>(m_lEntry.size()) - 1;
+	uint uSlot = Hash(uKey);
+	while (m_lEntry[uSlot].uKey != uKey && m_lEntry[uSlot].uKey != EMPTY_KEY)
+	{
+		uSlot = (uSlot + 1) & uMask;
+	}
+
+	Entry& entry = m_lEntry[uSlot];
+	a_bNew = entry.uKey == EMPTY_KEY;
+	if (a_bNew)
+	{
+		entry.uKey = uKey;
+		entry.bColliding = false;
+		m_uPairCount++;
+	}
+	entry.uFrame = m_uFrame;
+	return entry;
+}
+
+void Simplex::MyPairCache::EndFrame(std::vector<char> const& a_lActive, MyEventList& a_lEvents)
+{
+	uint uSlot = 0;
+	while (uSlot < m_lEntry.size())
+	{
+		Entry const& entry = m_lEntry[uSlot];
+		if (entry.uKey == EMPTY_KEY || entry.uFrame == m_uFrame)
+		{
+			uSlot++;
+			continue;
+		}
+
+		uint uA = static_cast<uint>(entry.uKey >> 32);
+		uint uB = static_cast<uint>(entry.uKey & 0xFFFFFFFF);
+		if (!a_lActive[uA] && !a_lActive[uB])
+		{
+			uSlot++;
+			continue;
+		}
+
+		if (entry.bColliding)
+		{
+			MyCollisionEvent event;
+			event.uA = uA;
+			event.uB = uB;
+			event.eType = CE_END;
+			a_lEvents.push_back(event);
+		}
+
+		// The slot may receive an entry from further down the probe sequence, look at it again
+		RemoveSlot(uSlot);
+	}
+}
+
+void Simplex::MyPairCache::Clear(MyEventList& a_lEvents)
+{
+	for (uint uSlot = 0; uSlot < m_lEntry.size(); uSlot++)
+	{
+		Entry& entry = m_lEntry[uSlot];
+		if (entry.uKey != EMPTY_KEY && entry.bColliding)
+		{
+			MyCollisionEvent event;
+			event.uA = static_cast<uint>(entry.uKey >> 32);
+			event.uB = static_cast<uint>(entry.uKey & 0xFFFFFFFF);
+			event.eType = CE_END;
+			a_lEvents.push_back(event);
+		}
+		entry = Entry();
+	}
+	m_uPairCount = 0;
+}
+
+uint Simplex::MyPairCache::GetPairCount(void)
+{
+	return m_uPairCount;
+}
+
+void Simplex::MyPairCache::Grow(void)
+{
+	std::vector<Entry> lOld;
+	lOld.swap(m_lEntry);
+	m_lEntry.resize(lOld.size() * 2);
+	m_uHashShift--;
+
+	uint uMask = static_cast<uint>(m_lEntry.size()) - 1;
+	for (uint i = 0; i < lOld.size(); i++)
+	{
+		if (lOld[i].uKey == EMPTY_KEY) { continue; }
+
+		uint uSlot = Hash(lOld[i].uKey);
+		while (m_lEntry[uSlot].uKey != EMPTY_KEY)
+		{
+			uSlot = (uSlot + 1) & uMask;
+		}
+		m_lEntry[uSlot] = lOld[i];
+	}
+}
+
+void Simplex::MyPairCache::RemoveSlot(uint a_uSlot)
+{
+	uint uMask = static_cast<uint>(m_lEntry.size()) - 1;
+	uint uHole = a_uSlot;
+	uint uSlot = a_uSlot;
+
+	// Backward shift deletion, an entry moves into the hole unless its home slot lies between the hole and it
+	while (true)
+	{
+		uSlot = (uSlot + 1) & uMask;
+		if (m_lEntry[uSlot].uKey == EMPTY_KEY) { break; }
+
+		uint uHome = Hash(m_lEntry[uSlot].uKey);
+		bool bStays = uHole <= uSlot ? (uHole < uHome && uHome <= uSlot) : (uHole < uHome || uHome <= uSlot);
+		if (bStays) { continue; }
+
+		m_lEntry[uHole] = m_lEntry[uSlot];
+		uHole = uSlot;
+	}
+
+	m_lEntry[uHole] = Entry();
+	m_uPairCount--;
+}
+
+uint Simplex::MyPairCache::Hash(unsigned long long a_uKey)
+{
+	// Fibonacci hashing, only the top log2(size) bits of the product see both entity indices
+	return static_cast<uint>((a_uKey * 0x9E3779B97F4A7C15ull) >> m_uHashShift);
+}
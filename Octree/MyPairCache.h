@@ -0,0 +1,118 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYPAIRCACHE_H_
+#define __MYPAIRCACHE_H_
+
+#include "MyBroadphase.h"
+
+namespace Simplex
+{
+	// Change in the contact state of a pair between two updates
+	enum MY_COLLISION_EVENT
+	{
+		CE_BEGIN = 0, // The pair started colliding on this update
+		CE_STAY = 1, // The pair was colliding and still is
+		CE_END = 2 // The pair stopped colliding, or one of them left the broadphase
+	};
+
+	// Event reported for a pair of entity indices, uA is always smaller than uB
+	struct MyCollisionEvent
+	{
+		uint uA = 0;
+		uint uB = 0;
+		MY_COLLISION_EVENT eType = CE_BEGIN;
+	};
+
+	typedef std::vector<MyCollisionEvent> MyEventList;
+
+	// Open addressing table of the pairs reported by the broadphase, kept across updates
+	class MyPairCache
+	{
+		static constexpr unsigned long long EMPTY_KEY = ~0ull; // key of an unused slot
+
+	public:
+		// Entry of the table, the result of the last narrowphase test is kept with the pair
+		struct Entry
+		{
+			unsigned long long uKey = EMPTY_KEY;
+			uint uFrame = 0; // last update that reported the pair
+			bool bColliding = false;
+		};
+
+	private:
+		uint m_uFrame = 0; // current update
+		uint m_uPairCount = 0; // slots in use
+		std::vector<Entry> m_lEntry; // table, the size is a power of two kept at least twice the pair count
+		uint m_uHashShift = 58; // 64 minus log2 of the table size
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyPairCache(void);
+
+		/*
+		USAGE: Starts a new update, the pairs of active entities not touched before EndFrame are removed
+		*/
+		void BeginFrame(void);
+
+		/*
+		USAGE: Finds the entry of the pair, inserting it if it is not in the table; the reference is valid until
+		the next call to Touch
+		ARGUMENTS:
+		- uint a_uA, a_uB -> indices of the entities
+		- bool& a_bNew -> was the pair inserted by this call?
+		OUTPUT: entry of the pair
+		*/
+		Entry& Touch(uint a_uA, uint a_uB, bool& a_bNew);
+
+		/*
+		USAGE: Removes the pairs with an active entity that were not touched on this update, the ones that were
+		colliding report an end event; pairs between inactive entities were not looked for and are kept
+		ARGUMENTS:
+		- std::vector<char> const& a_lActive -> was each entity processed on this update?
+		- MyEventList& a_lEvents -> list to append the end events to
+		*/
+		void EndFrame(std::vector<char> const& a_lActive, MyEventList& a_lEvents);
+
+		/*
+		USAGE: Removes every pair, the ones that were colliding report an end event
+		ARGUMENTS:
+		- MyEventList& a_lEvents -> list to append the end events to
+		*/
+		void Clear(MyEventList& a_lEvents);
+
+		/*
+		USAGE: Gets the number of pairs in the table
+		OUTPUT: pair count
+		*/
+		uint GetPairCount(void);
+
+	private:
+		/*
+		USAGE: Doubles the table and inserts every pair again
+		*/
+		void Grow(void);
+
+		/*
+		USAGE: Empties the slot, moving back the entries after it so the probe sequences stay unbroken
+		ARGUMENTS:
+		- uint a_uSlot -> slot to empty
+		*/
+		void RemoveSlot(uint a_uSlot);
+
+		/*
+		USAGE: Hashes the key into the first slot to probe
+		ARGUMENTS:
+		- unsigned long long a_uKey -> key of the pair
+		OUTPUT: slot index
+		*/
+		uint Hash(unsigned long long a_uKey);
+	};
+}
+
+#endif //__MYPAIRCACHE_H_
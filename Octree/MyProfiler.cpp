@@ -0,0 +1,358 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MyProfiler.h"
+#include <chrono>
+#include <map>
+using namespace Simplex;
+
+MyProfiler* MyProfiler::m_pInstance = nullptr;
+std::atomic<uint> MyProfiler::m_uGenerationCount(0);
+
+Simplex::MyProfileBuffer::MyProfileBuffer(uint a_uThread)
+{
+	m_uHead.store(0, std::memory_order_relaxed);
+	m_uTail.store(0, std::memory_order_relaxed);
+	m_uDropped.store(0, std::memory_order_relaxed);
+	m_uDepth = 0;
+	m_uThread = a_uThread;
+	m_sName = nullptr;
+}
+
+void Simplex::MyProfileBuffer::SetName(const char* a_sName)
+{
+	m_sName = a_sName;
+}
+
+void Simplex::MyProfileBuffer::Push(MyProfileEvent const& a_Event)
+{
+	unsigned long long uHead = m_uHead.load(std::memory_order_relaxed);
+	if (uHead - m_uTail.load(std::memory_order_acquire) >= CAPACITY)
+	{
+		m_uDropped.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+	m_lEvent[uHead & (CAPACITY - 1)] = a_Event;
+	m_uHead.store(uHead + 1, std::memory_order_release);
+}
+
+MyProfiler* Simplex::MyProfiler::GetInstance(void)
+{
+	if (m_pInstance == nullptr)
+	{
+		m_pInstance = new MyProfiler();
+	}
+	return m_pInstance;
+}
+
+void Simplex::MyProfiler::ReleaseInstance(void)
+{
+	if (m_pInstance != nullptr)
+	{
+		delete m_pInstance;
+		m_pInstance = nullptr;
+	}
+}
+
+unsigned long long Simplex::MyProfiler::GetTicks(void)
+{
+	auto tNow = std::chrono::high_resolution_clock::now().time_since_epoch();
+	return static_cast<unsigned long long>(std::chrono::duration_cast<std::chrono::nanoseconds>(tNow).count());
+}
+
+void Simplex::MyProfiler::RecordCounter(const char* a_sName, double a_dValue)
+{
+	MyProfileBuffer* pBuffer = GetInstance()->GetThreadBuffer();
+
+	MyProfileEvent event;
+	event.sName = a_sName;
+	event.uStart = GetTicks();
+	event.uEnd = event.uStart;
+	event.dValue = a_dValue;
+	event.uDepth = pBuffer->m_uDepth;
+	event.eType = PE_COUNTER;
+	pBuffer->Push(event);
+}
+
+MyProfileBuffer* Simplex::MyProfiler::GetThreadBuffer(void)
+{
+	// The lock is only taken the first time a thread opens a zone; a buffer of a profiler released since then was
+	// deleted with it, the thread makes a new one for this profiler
+	static thread_local MyProfileBuffer* pBuffer = nullptr;
+	static thread_local uint uGeneration = 0;
+	if (pBuffer == nullptr || uGeneration != m_uGeneration)
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		pBuffer = new MyProfileBuffer(static_cast<uint>(m_lBuffer.size()));
+		uGeneration = m_uGeneration;
+		m_lBuffer.push_back(pBuffer);
+	}
+	return pBuffer;
+}
+
+void Simplex::MyProfiler::EndFrame(void)
+{
+	unsigned long long uNow = GetTicks();
+	Frame& frame = m_lFrame[m_uFrameCount % FRAME_HISTORY];
+	frame.uStart = m_uFrameStart;
+	frame.uEnd = uNow;
+	frame.lEvent.clear();
+
+	// Only the drain needs the list of buffers, StopCapture takes the lock again
+	{
+		std::lock_guard<std::mutex> lock(m_Mutex);
+		for (uint i = 0; i < m_lBuffer.size(); i++)
+		{
+			MyProfileBuffer* pBuffer = m_lBuffer[i];
+			unsigned long long uHead = pBuffer->m_uHead.load(std::memory_order_acquire);
+			unsigned long long uTail = pBuffer->m_uTail.load(std::memory_order_relaxed);
+			for (; uTail < uHead; uTail++)
+			{
+				MyProfileEvent event = pBuffer->m_lEvent[uTail & (MyProfileBuffer::CAPACITY - 1)];
+				event.uThread = pBuffer->m_uThread;
+				frame.lEvent.push_back(event);
+			}
+
+			// The slots are handed back to the writer only once they are copied, it never writes over one being read
+			pBuffer->m_uTail.store(uTail, std::memory_order_release);
+			m_uDropped += pBuffer->m_uDropped.exchange(0, std::memory_order_relaxed);
+		}
+	}
+
+	m_uFrameStart = uNow;
+	m_uFrameCount++;
+
+	if (m_CaptureFile.is_open())
+	{
+		CaptureFrame(frame);
+		if (m_uCaptureFrames > 0 && --m_uCaptureFrames == 0)
+		{
+			StopCapture();
+		}
+	}
+}
+
+uint Simplex::MyProfiler::GetFrameCount(void)
+{
+	return m_uFrameCount < FRAME_HISTORY ? m_uFrameCount : FRAME_HISTORY;
+}
+
+MyProfiler::Frame const& Simplex::MyProfiler::GetFrame(uint a_uAge)
+{
+	return m_lFrame[(m_uFrameCount + FRAME_HISTORY - 1 - a_uAge) % FRAME_HISTORY];
+}
+
+unsigned long long Simplex::MyProfiler::GetDroppedCount(void)
+{
+	return m_uDropped;
+}
+
+void Simplex::MyProfiler::GetZoneStats(std::vector<ZoneStats>& a_lStats)
+{
+	a_lStats.clear();
+
+	// Total time of every zone in every frame, the names are compared by content as each translation unit has its own literals
+	std::map<String, std::vector<float>> lTimes;
+	uint uFrames = GetFrameCount();
+	for (uint uAge = 0; uAge < uFrames; uAge++)
+	{
+		std::map<String, float> lFrameTime;
+		std::vector<MyProfileEvent> const& lEvent = GetFrame(uAge).lEvent;
+		for (uint i = 0; i < lEvent.size(); i++)
+		{
+			if (lEvent[i].eType != PE_ZONE) { continue; }
+			lFrameTime[lEvent[i].sName] += (lEvent[i].uEnd - lEvent[i].uStart) / 1000000.0f;
+		}
+		for (auto const& time : lFrameTime)
+		{
+			lTimes[time.first].push_back(time.second);
+		}
+	}
+
+	for (auto& times : lTimes)
+	{
+		std::vector<float>& lTime = times.second;
+		std::sort(lTime.begin(), lTime.end());
+
+		ZoneStats stats;
+		stats.sName = times.first;
+		stats.uFrames = static_cast<uint>(lTime.size());
+		stats.fMin = lTime.front();
+		stats.fP99 = lTime[(lTime.size() - 1) * 99 / 100];
+		for (uint i = 0; i < lTime.size(); i++)
+		{
+			stats.fAverage += lTime[i];
+		}
+		stats.fAverage /= lTime.size();
+		a_lStats.push_back(stats);
+	}
+}
+
+bool Simplex::MyProfiler::StartCapture(String a_sFileName, uint a_uFrames)
+{
+	StopCapture();
+
+	m_CaptureFile.open(a_sFileName, std::ios::out | std::ios::trunc);
+	if (!m_CaptureFile.is_open()) { return false; }
+
+	m_sCaptureName = a_sFileName;
+	m_sCaptureChunk = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	m_uCaptureFrames = a_uFrames;
+	m_uCaptureOrigin = m_uFrameStart;
+	m_bCaptureFirst = true;
+	return true;
+}
+
+void Simplex::MyProfiler::StopCapture(void)
+{
+	if (!m_CaptureFile.is_open()) { return; }
+
+	// Thread names go last, by then every thread that recorded something has a buffer
+	char sEvent[256];
+	CaptureEvent("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"Frames\"}}");
+	std::lock_guard<std::mutex> lock(m_Mutex);
+	for (uint i = 0; i < m_lBuffer.size(); i++)
+	{
+		String sName = m_lBuffer[i]->m_sName != nullptr ? EscapeName(m_lBuffer[i]->m_sName) : "Thread " + std::to_string(i);
+		snprintf(sEvent, sizeof(sEvent), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+			i + 1, sName.c_str());
+		CaptureEvent(sEvent);
+	}
+
+	m_sCaptureChunk += "\n]}\n";
+	m_CaptureFile.write(m_sCaptureChunk.data(), m_sCaptureChunk.size());
+	m_CaptureFile.close();
+	m_sCaptureChunk.clear();
+	m_sCaptureChunk.shrink_to_fit();
+	m_uCaptureFrames = 0;
+}
+
+bool Simplex::MyProfiler::IsCapturing(void)
+{
+	return m_CaptureFile.is_open();
+}
+
+String Simplex::MyProfiler::GetCaptureName(void)
+{
+	return m_sCaptureName;
+}
+
+void Simplex::MyProfiler::CaptureFrame(Frame const& a_Frame)
+{
+	char sEvent[512];
+	auto ToMicroseconds = [this](unsigned long long a_uTicks) { return (a_uTicks - m_uCaptureOrigin) / 1000.0; };
+
+	// The frames get their own track so the zones line up under them
+	snprintf(sEvent, sizeof(sEvent), "{\"name\":\"Frame %u\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":0}",
+		m_uFrameCount, ToMicroseconds(a_Frame.uStart), (a_Frame.uEnd - a_Frame.uStart) / 1000.0);
+	CaptureEvent(sEvent);
+
+	std::vector<MyProfileEvent> const& lEvent = a_Frame.lEvent;
+	std::vector<uint> lCounter;
+	for (uint i = 0; i < lEvent.size(); i++)
+	{
+		MyProfileEvent const& event = lEvent[i];
+		if (event.eType != PE_COUNTER) { continue; }
+
+		snprintf(sEvent, sizeof(sEvent), "{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{\"value\":%g}}",
+			EscapeName(event.sName).c_str(), ToMicroseconds(event.uStart), event.uThread + 1, event.dValue);
+		CaptureEvent(sEvent);
+		lCounter.push_back(i);
+	}
+
+	for (uint i = 0; i < lEvent.size(); i++)
+	{
+		MyProfileEvent const& event = lEvent[i];
+		if (event.eType != PE_ZONE) { continue; }
+
+		// The counters recorded directly inside the zone become its arguments
+		String sArgs = "";
+		for (uint j = 0; j < lCounter.size(); j++)
+		{
+			MyProfileEvent const& counter = lEvent[lCounter[j]];
+			if (counter.uThread != event.uThread || counter.uDepth != event.uDepth + 1) { continue; }
+			if (counter.uStart < event.uStart || counter.uStart > event.uEnd) { continue; }
+
+			char sArg[128];
+			snprintf(sArg, sizeof(sArg), "%s\"%s\":%g", sArgs.empty() ? "" : ",", EscapeName(counter.sName).c_str(), counter.dValue);
+			sArgs += sArg;
+		}
+
+		snprintf(sEvent, sizeof(sEvent), "{\"name\":\"%s\",\"cat\":\"zone\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u,\"args\":{",
+			EscapeName(event.sName).c_str(), ToMicroseconds(event.uStart), (event.uEnd - event.uStart) / 1000.0, event.uThread + 1);
+		CaptureEvent(sEvent + sArgs + "}}");
+	}
+
+	// Only a chunk of the trace is kept in memory, the rest is already on disk
+	if (m_sCaptureChunk.size() >= CAPTURE_CHUNK)
+	{
+		m_CaptureFile.write(m_sCaptureChunk.data(), m_sCaptureChunk.size());
+		m_sCaptureChunk.clear();
+	}
+}
+
+void Simplex::MyProfiler::CaptureEvent(String const& a_sEvent)
+{
+	if (!m_bCaptureFirst)
+	{
+		m_sCaptureChunk += ",\n";
+	}
+	m_sCaptureChunk += a_sEvent;
+	m_bCaptureFirst = false;
+}
+
+String Simplex::MyProfiler::EscapeName(const char* a_sName)
+{
+	String sName = "";
+	for (const char* c = a_sName; *c != '\0'; c++)
+	{
+		if (*c == '"' || *c == '\\') { sName += '\\'; }
+		if (static_cast<unsigned char>(*c) >= 0x20) { sName += *c; }
+	}
+	return sName;
+}
+
+Simplex::MyProfiler::MyProfiler(void)
+{
+	m_lFrame.resize(FRAME_HISTORY);
+	m_uFrameCount = 0;
+	m_uFrameStart = GetTicks();
+	m_uDropped = 0;
+	m_uGeneration = ++m_uGenerationCount;
+}
+
+Simplex::MyProfiler::MyProfiler(MyProfiler const& a_pOther) { }
+
+MyProfiler& Simplex::MyProfiler::operator=(MyProfiler const& a_pOther) { return *this; }
+
+Simplex::MyProfiler::~MyProfiler(void)
+{
+	StopCapture();
+
+	// The buffers are owned by the profiler, the threads only keep a pointer to theirs
+	for (uint i = 0; i < m_lBuffer.size(); i++)
+	{
+		SafeDelete(m_lBuffer[i]);
+	}
+	m_lBuffer.clear();
+}
+
+Simplex::MyProfileZone::MyProfileZone(const char* a_sName)
+{
+	m_pBuffer = MyProfiler::GetInstance()->GetThreadBuffer();
+	m_sName = a_sName;
+	m_pBuffer->m_uDepth++;
+	m_uStart = MyProfiler::GetTicks();
+}
+
+Simplex::MyProfileZone::~MyProfileZone(void)
+{
+	MyProfileEvent event;
+	event.sName = m_sName;
+	event.uStart = m_uStart;
+	event.uEnd = MyProfiler::GetTicks();
+	event.uDepth = --m_pBuffer->m_uDepth;
+	m_pBuffer->Push(event);
+}
@@ -0,0 +1,311 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYPROFILER_H_
+#define __MYPROFILER_H_
+
+#include "Simplex\Simplex.h"
+#include <atomic>
+#include <fstream>
+#include <mutex>
+
+// Define MY_PROFILE as 0 in the project settings to compile every zone out
+#ifndef MY_PROFILE
+#define MY_PROFILE 1
+#endif
+
+#define MY_PROFILE_CONCAT_(a, b) a##b
+#define MY_PROFILE_CONCAT(a, b) MY_PROFILE_CONCAT_(a, b)
+
+#if MY_PROFILE
+// Times the rest of the enclosing scope, zones nest; the name has to be a string literal
+#define MY_PROFILE_ZONE(name) Simplex::MyProfileZone MY_PROFILE_CONCAT(profileZone, __LINE__)(name)
+// Records a value inside the innermost open zone, captures attach it to that zone and plot it as a counter track
+#define MY_PROFILE_COUNTER(name, value) Simplex::MyProfiler::RecordCounter(name, static_cast<double>(value))
+// Names the calling thread in the captures
+#define MY_PROFILE_THREAD(name) Simplex::MyProfiler::GetInstance()->GetThreadBuffer()->SetName(name)
+// Closes the current frame, the zones recorded since the last call on every thread are collected into it
+#define MY_PROFILE_FRAME() Simplex::MyProfiler::GetInstance()->EndFrame()
+#else
+#define MY_PROFILE_ZONE(name)
+#define MY_PROFILE_COUNTER(name, value)
+#define MY_PROFILE_THREAD(name)
+#define MY_PROFILE_FRAME()
+#endif
+
+namespace Simplex
+{
+	// Kind of the events recorded by the profiler
+	enum MY_PROFILE_EVENT
+	{
+		PE_ZONE = 0, // Scoped timer, from uStart to uEnd
+		PE_COUNTER = 1 // Value sampled at uStart
+	};
+
+	// Zone closed or counter recorded on some thread, times are in nanoseconds from an arbitrary origin
+	struct MyProfileEvent
+	{
+		const char* sName = nullptr;
+		unsigned long long uStart = 0;
+		unsigned long long uEnd = 0;
+		double dValue = 0.0; // value of a counter
+		uint uDepth = 0; // zones open around it on the same thread
+		uint uThread = 0; // index of the buffer that recorded it
+		MY_PROFILE_EVENT eType = PE_ZONE;
+	};
+
+	// Ring buffer of the zones of one thread, written by its thread and drained by EndFrame without locks
+	class MyProfileBuffer
+	{
+		friend class MyProfiler;
+		friend class MyProfileZone;
+
+		static constexpr uint CAPACITY = 4096; // power of two, zones past it before a drain are lost
+
+		MyProfileEvent m_lEvent[CAPACITY];
+		std::atomic<unsigned long long> m_uHead; // events written, only the owning thread stores it
+		std::atomic<unsigned long long> m_uTail; // events drained, only EndFrame stores it once it copied them
+		std::atomic<unsigned long long> m_uDropped; // events the owning thread dropped because the ring was full
+		uint m_uDepth = 0; // zones currently open on the owning thread
+		uint m_uThread = 0; // index in the profiler
+		const char* m_sName = nullptr; // name of the owning thread in the captures
+
+	public:
+		/*
+		USAGE: Constructor
+		ARGUMENTS:
+		- uint a_uThread -> index of the buffer in the profiler
+		OUTPUT: class object
+		*/
+		MyProfileBuffer(uint a_uThread);
+
+		/*
+		USAGE: Names the owning thread in the captures
+		ARGUMENTS:
+		- const char* a_sName -> name of the thread, has to outlive the profiler
+		*/
+		void SetName(const char* a_sName);
+
+	private:
+		/*
+		USAGE: Appends an event, the slot is filled before the head is published so the reader never sees it half written;
+		with the ring full the event is dropped instead of overwriting one the reader may be copying
+		ARGUMENTS:
+		- MyProfileEvent const& a_Event -> event to append
+		*/
+		void Push(MyProfileEvent const& a_Event);
+	};
+
+	// Profiler collecting the zones of every thread into a rolling history of frames
+	class MyProfiler
+	{
+	public:
+		static constexpr uint FRAME_HISTORY = 120; // frames kept for the timeline and the statistics
+		static constexpr uint CAPTURE_CHUNK = 1 << 18; // bytes of JSON buffered before a capture writes to disk
+
+		// Zones recorded between two calls to EndFrame
+		struct Frame
+		{
+			unsigned long long uStart = 0;
+			unsigned long long uEnd = 0;
+			std::vector<MyProfileEvent> lEvent;
+		};
+
+		// Time spent in a zone per frame over the history, in milliseconds
+		struct ZoneStats
+		{
+			String sName = "";
+			float fMin = 0.0f;
+			float fAverage = 0.0f;
+			float fP99 = 0.0f;
+			uint uFrames = 0; // frames of the history the zone appeared in
+		};
+
+	private:
+		static MyProfiler* m_pInstance; // Singleton pointer
+		static std::atomic<uint> m_uGenerationCount; // profilers made so far
+		uint m_uGeneration = 0; // tells the threads whether the buffer they point at belongs to this profiler
+
+		std::mutex m_Mutex; // guards the list of buffers, taken once by every thread that opens a zone
+		std::vector<MyProfileBuffer*> m_lBuffer; // one per thread that ever opened a zone
+
+		std::vector<Frame> m_lFrame; // ring of the last FRAME_HISTORY frames
+		uint m_uFrameCount = 0; // frames closed so far
+		unsigned long long m_uFrameStart = 0; // time the current frame started
+		unsigned long long m_uDropped = 0; // events dropped because a ring was full, summed from the buffers
+
+		std::ofstream m_CaptureFile; // trace being written, open while capturing
+		String m_sCaptureName = ""; // name of the trace file
+		String m_sCaptureChunk = ""; // JSON not yet written to the file
+		uint m_uCaptureFrames = 0; // frames left to capture, 0 captures until StopCapture
+		unsigned long long m_uCaptureOrigin = 0; // time the capture started, the trace times are relative to it
+		bool m_bCaptureFirst = true; // is the next event the first one of the trace?
+
+	public:
+		/*
+		USAGE: Gets the singleton pointer
+		OUTPUT: singleton pointer
+		*/
+		static MyProfiler* GetInstance(void);
+
+		/*
+		USAGE: Releases the content of the singleton, to be called once no thread opens zones anymore
+		*/
+		static void ReleaseInstance(void);
+
+		/*
+		USAGE: Reads the high resolution clock
+		OUTPUT: nanoseconds from an arbitrary origin
+		*/
+		static unsigned long long GetTicks(void);
+
+		/*
+		USAGE: Records a counter on the calling thread
+		ARGUMENTS:
+		- const char* a_sName -> name of the counter, has to outlive the profiler
+		- double a_dValue -> value
+		*/
+		static void RecordCounter(const char* a_sName, double a_dValue);
+
+		/*
+		USAGE: Gets the buffer of the calling thread, creating it on the first call from that thread; buffers are
+		kept until the profiler is released so zones are meant for long lived threads
+		OUTPUT: buffer of the thread
+		*/
+		MyProfileBuffer* GetThreadBuffer(void);
+
+		/*
+		USAGE: Closes the current frame, draining the buffers of every thread into the history
+		*/
+		void EndFrame(void);
+
+		/*
+		USAGE: Gets the number of frames in the history
+		OUTPUT: frame count, at most FRAME_HISTORY
+		*/
+		uint GetFrameCount(void);
+
+		/*
+		USAGE: Gets a frame of the history
+		ARGUMENTS:
+		- uint a_uAge -> 0 for the last closed frame, 1 for the one before it and so on
+		OUTPUT: frame
+		*/
+		Frame const& GetFrame(uint a_uAge);
+
+		/*
+		USAGE: Gets the number of events lost because a buffer filled up between two frames
+		OUTPUT: event count
+		*/
+		unsigned long long GetDroppedCount(void);
+
+		/*
+		USAGE: Computes the minimum, average and 99th percentile time of every zone over the history, zones with
+		the same name add up within a frame
+		ARGUMENTS:
+		- std::vector<ZoneStats>& a_lStats -> list to fill, sorted by name
+		*/
+		void GetZoneStats(std::vector<ZoneStats>& a_lStats);
+
+		/*
+		USAGE: Starts writing the frames to a Chrome trace event file, viewable in chrome://tracing or Perfetto; the
+		JSON is written in chunks as the frames close so long captures do not stay in memory
+		ARGUMENTS:
+		- String a_sFileName -> path of the trace file
+		- uint a_uFrames = 0 -> frames to capture before stopping on its own, 0 captures until StopCapture
+		OUTPUT: could the file be opened?
+		*/
+		bool StartCapture(String a_sFileName, uint a_uFrames = 0);
+
+		/*
+		USAGE: Finishes the trace file, does nothing if there is no capture running
+		*/
+		void StopCapture(void);
+
+		/*
+		USAGE: Asks if a capture is running
+		OUTPUT: is it capturing?
+		*/
+		bool IsCapturing(void);
+
+		/*
+		USAGE: Gets the name of the trace file of the running or last capture
+		OUTPUT: file name
+		*/
+		String GetCaptureName(void);
+
+	private:
+		/*
+		USAGE: Appends the events of the frame to the trace, counters are attached to the zone they were recorded in
+		ARGUMENTS:
+		- Frame const& a_Frame -> frame to write
+		*/
+		void CaptureFrame(Frame const& a_Frame);
+
+		/*
+		USAGE: Appends one event object to the trace
+		ARGUMENTS:
+		- String const& a_sEvent -> JSON object of the event
+		*/
+		void CaptureEvent(String const& a_sEvent);
+
+		/*
+		USAGE: Escapes the quotes and backslashes of a zone, counter or thread name for the trace, control
+		characters are dropped
+		ARGUMENTS:
+		- const char* a_sName -> name
+		OUTPUT: JSON string contents
+		*/
+		static String EscapeName(const char* a_sName);
+
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MyProfiler(void);
+
+		/*
+		USAGE: Copy constructor
+		*/
+		MyProfiler(MyProfiler const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MyProfiler& operator=(MyProfiler const& a_pOther);
+
+		/*
+		USAGE: Destructor
+		*/
+		~MyProfiler(void);
+	};
+
+	// Scoped timer opened by MY_PROFILE_ZONE, the event is recorded when it goes out of scope
+	class MyProfileZone
+	{
+		MyProfileBuffer* m_pBuffer = nullptr;
+		const char* m_sName = nullptr;
+		unsigned long long m_uStart = 0;
+
+	public:
+		/*
+		USAGE: Opens the zone
+		ARGUMENTS:
+		- const char* a_sName -> name of the zone, has to outlive the profiler
+		OUTPUT: class object
+		*/
+		MyProfileZone(const char* a_sName);
+
+		/*
+		USAGE: Closes the zone and records it
+		*/
+		~MyProfileZone(void);
+
+		MyProfileZone(MyProfileZone const& a_pOther) = delete;
+		MyProfileZone& operator=(MyProfileZone const& a_pOther) = delete;
+	};
+}
+
+#endif //__MYPROFILER_H_
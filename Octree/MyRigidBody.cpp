@@ -25,6 +25,7 @@ void MyRigidBody::Init(void)
 	m_v3ARBBSize = ZERO_V3;
 
 	m_m4ToWorld = IDENTITY_M4;
+	m_bDirty = true;
 
 	m_nCollidingCount = 0;
 	m_CollidingArray = nullptr;
@@ -53,6 +54,7 @@ void MyRigidBody::Swap(MyRigidBody& other)
 	std::swap(m_v3ARBBSize, other.m_v3ARBBSize);
 
 	std::swap(m_m4ToWorld, other.m_m4ToWorld);
+	std::swap(m_bDirty, other.m_bDirty);
 
 	std::swap(m_nCollidingCount, other.m_nCollidingCount);
 	std::swap(m_CollidingArray, other.m_CollidingArray);
@@ -82,6 +84,9 @@ vector3 MyRigidBody::GetMinGlobal(void) { return m_v3MinG; }
 vector3 MyRigidBody::GetMaxGlobal(void) { return m_v3MaxG; }
 vector3 MyRigidBody::GetHalfWidth(void) { return m_v3HalfWidth; }
 matrix4 MyRigidBody::GetModelMatrix(void) { return m_m4ToWorld; }
+bool MyRigidBody::IsDirty(void) { return m_bDirty; }
+void MyRigidBody::ClearDirty(void) { m_bDirty = false; }
+uint MyRigidBody::GetCollidingCount(void) { return m_nCollidingCount; }
 void MyRigidBody::SetModelMatrix(matrix4 a_m4ModelMatrix)
 {
 	//to save some calculations if the model matrix is the same there is nothing to do here
@@ -90,6 +95,22 @@ void MyRigidBody::SetModelMatrix(matrix4 a_m4ModelMatrix)
 
 	//Assign the model matrix
 	m_m4ToWorld = a_m4ModelMatrix;
+	UpdateGlobalBounds();
+}
+void MyRigidBody::SetLocalBounds(vector3 a_v3MinL, vector3 a_v3MaxL)
+{
+	m_v3MinL = a_v3MinL;
+	m_v3MaxL = a_v3MaxL;
+	m_v3CenterL = (m_v3MaxL + m_v3MinL) / 2.0f;
+	m_v3HalfWidth = (m_v3MaxL - m_v3MinL) / 2.0f;
+	m_fRadius = glm::distance(m_v3CenterL, m_v3MinL);
+
+	//the model matrix stays, the global box is taken again around the new corners
+	UpdateGlobalBounds();
+}
+void MyRigidBody::UpdateGlobalBounds(void)
+{
+	m_bDirty = true;
 
 	m_v3CenterG = vector3(m_m4ToWorld * vector4(m_v3CenterL, 1.0f));
 
@@ -132,6 +153,15 @@ void MyRigidBody::SetModelMatrix(matrix4 a_m4ModelMatrix)
 	//we calculate the distance between min and max vectors
 	m_v3ARBBSize = m_v3MaxG - m_v3MinG;
 }
+void MyRigidBody::Translate(vector3 a_v3Offset)
+{
+	//a translation keeps the size of the box, only the corners move
+	m_m4ToWorld[3] += vector4(a_v3Offset, 0.0f);
+	m_v3CenterG += a_v3Offset;
+	m_v3MinG += a_v3Offset;
+	m_v3MaxG += a_v3Offset;
+	m_bDirty = true;
+}
 //The big 3
 MyRigidBody::MyRigidBody(std::vector<vector3> a_pointList)
 {
@@ -197,6 +227,7 @@ MyRigidBody::MyRigidBody(MyRigidBody const& other)
 	m_v3ARBBSize = other.m_v3ARBBSize;
 
 	m_m4ToWorld = other.m_m4ToWorld;
+	m_bDirty = other.m_bDirty;
 
 	m_nCollidingCount = other.m_nCollidingCount;
 	m_CollidingArray = other.m_CollidingArray;
@@ -255,7 +286,7 @@ void MyRigidBody::RemoveCollisionWith(MyRigidBody* other)
 			pTemp = new PRigidBody[m_nCollidingCount - 1];
 			if (m_CollidingArray)
 			{
-				memcpy(pTemp, m_CollidingArray, sizeof(uint) * (m_nCollidingCount - 1));
+				memcpy(pTemp, m_CollidingArray, sizeof(PRigidBody) * (m_nCollidingCount - 1));
 				delete[] m_CollidingArray;
 				m_CollidingArray = nullptr;
 			}
@@ -292,6 +323,21 @@ uint MyRigidBody::SAT(MyRigidBody* const a_pOther)
 	return 0;
 }
 bool MyRigidBody::IsColliding(MyRigidBody* const a_pOther)
+{
+	bool bColliding = IsIntersecting(a_pOther);
+	if (bColliding) //they are colliding with bounding box also
+	{
+		this->AddCollisionWith(a_pOther);
+		a_pOther->AddCollisionWith(this);
+	}
+	else //they are not colliding with bounding box
+	{
+		this->RemoveCollisionWith(a_pOther);
+		a_pOther->RemoveCollisionWith(this);
+	}
+	return bColliding;
+}
+bool MyRigidBody::IsIntersecting(MyRigidBody* const a_pOther)
 {
 	//check if spheres are colliding
 	bool bColliding = true;
@@ -313,48 +359,37 @@ bool MyRigidBody::IsColliding(MyRigidBody* const a_pOther)
 			bColliding = false;
 		if (this->m_v3MinG.z > a_pOther->m_v3MaxG.z) //this in front of other
 			bColliding = false;
-
-		if (bColliding) //they are colliding with bounding box also
-		{
-			this->AddCollisionWith(a_pOther);
-			a_pOther->AddCollisionWith(this);
-		}
-		else //they are not colliding with bounding box
-		{
-			this->RemoveCollisionWith(a_pOther);
-			a_pOther->RemoveCollisionWith(this);
-		}
-	}
-	else //they are not colliding with bounding sphere
-	{
-		this->RemoveCollisionWith(a_pOther);
-		a_pOther->RemoveCollisionWith(this);
 	}
 	return bColliding;
 }
 
 void MyRigidBody::AddToRenderList(void)
+{
+	AddToRenderList(m_m4ToWorld, m_v3MinG, m_v3MaxG, m_nCollidingCount > 0);
+}
+void MyRigidBody::AddToRenderList(matrix4 a_m4ToWorld, vector3 a_v3MinG, vector3 a_v3MaxG, bool a_bColliding)
 {
 	if (m_bVisibleBS)
 	{
-		if (m_nCollidingCount > 0)
-			m_pMeshMngr->AddWireSphereToRenderList(glm::translate(m_m4ToWorld, m_v3CenterL) * glm::scale(vector3(m_fRadius)), C_BLUE_CORNFLOWER);
+		if (a_bColliding)
+			m_pMeshMngr->AddWireSphereToRenderList(glm::translate(a_m4ToWorld, m_v3CenterL) * glm::scale(vector3(m_fRadius)), C_BLUE_CORNFLOWER);
 		else
-			m_pMeshMngr->AddWireSphereToRenderList(glm::translate(m_m4ToWorld, m_v3CenterL) * glm::scale(vector3(m_fRadius)), C_BLUE_CORNFLOWER);
+			m_pMeshMngr->AddWireSphereToRenderList(glm::translate(a_m4ToWorld, m_v3CenterL) * glm::scale(vector3(m_fRadius)), C_BLUE_CORNFLOWER);
 	}
 	if (m_bVisibleOBB)
 	{
-		if (m_nCollidingCount > 0)
-			m_pMeshMngr->AddWireCubeToRenderList(glm::translate(m_m4ToWorld, m_v3CenterL) * glm::scale(m_v3HalfWidth * 2.0f), m_v3ColorColliding);
+		if (a_bColliding)
+			m_pMeshMngr->AddWireCubeToRenderList(glm::translate(a_m4ToWorld, m_v3CenterL) * glm::scale(m_v3HalfWidth * 2.0f), m_v3ColorColliding);
 		else
-			m_pMeshMngr->AddWireCubeToRenderList(glm::translate(m_m4ToWorld, m_v3CenterL) * glm::scale(m_v3HalfWidth * 2.0f), m_v3ColorNotColliding);
+			m_pMeshMngr->AddWireCubeToRenderList(glm::translate(a_m4ToWorld, m_v3CenterL) * glm::scale(m_v3HalfWidth * 2.0f), m_v3ColorNotColliding);
 	}
 	if (m_bVisibleARBB)
 	{
-		if (m_nCollidingCount > 0)
-			m_pMeshMngr->AddWireCubeToRenderList(glm::translate(m_v3CenterG) * glm::scale(m_v3ARBBSize), C_YELLOW);
+		//the global box is centered on the global center
+		if (a_bColliding)
+			m_pMeshMngr->AddWireCubeToRenderList(glm::translate((a_v3MinG + a_v3MaxG) * 0.5f) * glm::scale(a_v3MaxG - a_v3MinG), C_YELLOW);
 		else
-			m_pMeshMngr->AddWireCubeToRenderList(glm::translate(m_v3CenterG) * glm::scale(m_v3ARBBSize), C_YELLOW);
+			m_pMeshMngr->AddWireCubeToRenderList(glm::translate((a_v3MinG + a_v3MaxG) * 0.5f) * glm::scale(a_v3MaxG - a_v3MinG), C_YELLOW);
 	}
 }
 bool MyRigidBody::IsInCollidingArray(MyRigidBody* a_pEntry)
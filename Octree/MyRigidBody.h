@@ -38,6 +38,7 @@ namespace Simplex
 		vector3 m_v3ARBBSize = ZERO_V3;// size of the Axis (Re)Alligned Bounding Box
 
 		matrix4 m_m4ToWorld = IDENTITY_M4; //Matrix that will take us from local to world coordinate
+		bool m_bDirty = true; //did the global bounds change since the last ClearDirty?
 
 		uint m_nCollidingCount = 0; //size of the colliding set
 		PRigidBody* m_CollidingArray = nullptr; //array of rigid bodies this one is colliding with
@@ -80,6 +81,16 @@ namespace Simplex
 		OUTPUT: ---
 		*/
 		void AddToRenderList(void);
+		/*
+		USAGE: Will render the Rigid Body at the model to world matrix given, for states copied to another thread
+		ARGUMENTS:
+		-	matrix4 a_m4ToWorld -> model to world matrix
+		-	vector3 a_v3MinG -> minimum of the global bounds
+		-	vector3 a_v3MaxG -> maximum of the global bounds
+		-	bool a_bColliding -> is it colliding?
+		OUTPUT: ---
+		*/
+		void AddToRenderList(matrix4 a_m4ToWorld, vector3 a_v3MinG, vector3 a_v3MaxG, bool a_bColliding);
 
 		/*
 		USAGE: Clears the colliding list
@@ -108,6 +119,13 @@ namespace Simplex
 		OUTPUT: are they colliding?
 		*/
 		bool IsColliding(MyRigidBody* const other);
+
+		/*
+		USAGE: Tells if the object intersects the incoming one without changing the colliding lists
+		ARGUMENTS: MyRigidBody* const other -> inspected rigid body
+		OUTPUT: are they intersecting?
+		*/
+		bool IsIntersecting(MyRigidBody* const other);
 #pragma region Accessors
 		/*
 		Usage: Gets visibility of bounding sphere
@@ -229,6 +247,38 @@ namespace Simplex
 		Output: ---
 		*/
 		void SetModelMatrix(matrix4 a_m4ModelMatrix);
+		/*
+		Usage: Moves the model matrix and the global bounds without recomputing the corners
+		Arguments: vector3 a_v3Offset -> displacement in global space
+		Output: ---
+		*/
+		void Translate(vector3 a_v3Offset);
+		/*
+		Usage: Replaces the box in local space, the sphere and the global box follow it
+		Arguments:
+		-	vector3 a_v3MinL -> minimum in local space
+		-	vector3 a_v3MaxL -> maximum in local space
+		Output: ---
+		*/
+		void SetLocalBounds(vector3 a_v3MinL, vector3 a_v3MaxL);
+		/*
+		Usage: Asks if the model matrix changed since the last ClearDirty
+		Arguments: ---
+		Output: is it dirty?
+		*/
+		bool IsDirty(void);
+		/*
+		Usage: Marks the current bounds as seen
+		Arguments: ---
+		Output: ---
+		*/
+		void ClearDirty(void);
+		/*
+		Usage: Gets the number of rigid bodies this one is colliding with
+		Arguments: ---
+		Output: size of the colliding set
+		*/
+		uint GetCollidingCount(void);
 #pragma endregion
 		/*
 		USAGE: Checks if the input is in the colliding array
@@ -251,6 +301,12 @@ namespace Simplex
 		*/
 		void Init(void);
 		/*
+		Usage: Places the corners of the local box with the model matrix and takes the global box around them
+		Arguments: ---
+		Output: ---
+		*/
+		void UpdateGlobalBounds(void);
+		/*
 		USAGE: This will apply the Separation Axis Test
 		ARGUMENTS: MyRigidBody* const a_pOther -> other rigid body to test against
 		OUTPUT: 0 for colliding, all other first axis that succeeds test
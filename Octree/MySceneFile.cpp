@@ -0,0 +1,229 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MySceneFile.h"
+using namespace Simplex;
+
+Simplex::MySceneFile::MySceneFile(void)
+{
+	m_pHeader = nullptr;
+}
+
+Simplex::MySceneFile::~MySceneFile(void)
+{
+	Close();
+}
+
+bool Simplex::MySceneFile::Save(String a_sFileName, MySceneData const& a_Data)
+{
+	uint uEntityCount = static_cast<uint>(a_Data.lMatrix.size());
+
+	// The strings are written back to back, each one with its 0
+	std::vector<char> lModelName;
+	for (String const& sName : a_Data.lModelName)
+	{
+		lModelName.insert(lModelName.end(), sName.c_str(), sName.c_str() + sName.size() + 1);
+	}
+	std::vector<char> lUniqueID;
+	for (String const& sID : a_Data.lUniqueID)
+	{
+		lUniqueID.insert(lUniqueID.end(), sID.c_str(), sID.c_str() + sID.size() + 1);
+	}
+
+	void const* lData[SS_COUNT] = {};
+	MySceneHeader header;
+	header.uVersion = VERSION;
+	header.uEntityCount = uEntityCount;
+	header.uModelCount = static_cast<uint>(a_Data.lModelName.size());
+	header.uOctantCount = static_cast<uint>(a_Data.lOctant.size());
+	header.uOctreeIDCount = a_Data.uOctreeIDCount;
+	header.uOctreeMaxLevel = a_Data.uOctreeMaxLevel;
+	header.uOctreeIdealCount = a_Data.uOctreeIdealCount;
+	header.lSection[SS_MODEL_NAME].uSize = lModelName.size();
+	header.lSection[SS_UNIQUE_ID].uSize = lUniqueID.size();
+	header.lSection[SS_MODEL_INDEX].uSize = a_Data.lModelIndex.size() * sizeof(uint);
+	header.lSection[SS_MATRIX].uSize = a_Data.lMatrix.size() * sizeof(matrix4);
+	header.lSection[SS_LOCAL_MIN].uSize = a_Data.lLocalMin.size() * sizeof(vector3);
+	header.lSection[SS_LOCAL_MAX].uSize = a_Data.lLocalMax.size() * sizeof(vector3);
+	header.lSection[SS_FILTER].uSize = a_Data.lFilter.size() * sizeof(uint);
+	header.lSection[SS_FLAG].uSize = a_Data.lFlag.size() * sizeof(uint);
+	header.lSection[SS_OCTANT].uSize = a_Data.lOctant.size() * sizeof(MyOctantRecord);
+	header.lSection[SS_OCTANT_ENTITY].uSize = a_Data.lOctantEntity.size() * sizeof(uint);
+	lData[SS_MODEL_NAME] = lModelName.data();
+	lData[SS_UNIQUE_ID] = lUniqueID.data();
+	lData[SS_MODEL_INDEX] = a_Data.lModelIndex.data();
+	lData[SS_MATRIX] = a_Data.lMatrix.data();
+	lData[SS_LOCAL_MIN] = a_Data.lLocalMin.data();
+	lData[SS_LOCAL_MAX] = a_Data.lLocalMax.data();
+	lData[SS_FILTER] = a_Data.lFilter.data();
+	lData[SS_FLAG] = a_Data.lFlag.data();
+	lData[SS_OCTANT] = a_Data.lOctant.data();
+	lData[SS_OCTANT_ENTITY] = a_Data.lOctantEntity.data();
+
+	// Every array starts aligned so the reader can point straight into the mapping
+	unsigned long long uOffset = sizeof(MySceneHeader);
+	for (uint i = 0; i < SS_COUNT; i++)
+	{
+		uOffset = (uOffset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+		header.lSection[i].uOffset = uOffset;
+		uOffset += header.lSection[i].uSize;
+	}
+
+	FILE* pFile = nullptr;
+	fopen_s(&pFile, a_sFileName.c_str(), "wb");
+	if (pFile == nullptr)
+		return false;
+
+	bool bWritten = fwrite(&header, sizeof(MySceneHeader), 1, pFile) == 1;
+	unsigned long long uWritten = sizeof(MySceneHeader);
+	char const lPadding[SECTION_ALIGNMENT] = {};
+	for (uint i = 0; i < SS_COUNT && bWritten; i++)
+	{
+		size_t uPadding = static_cast<size_t>(header.lSection[i].uOffset - uWritten);
+		size_t uSize = static_cast<size_t>(header.lSection[i].uSize);
+		bWritten = fwrite(lPadding, 1, uPadding, pFile) == uPadding && fwrite(lData[i], 1, uSize, pFile) == uSize;
+		uWritten = header.lSection[i].uOffset + header.lSection[i].uSize;
+	}
+	bWritten = fclose(pFile) == 0 && bWritten;
+	return bWritten;
+}
+
+bool Simplex::MySceneFile::Open(String a_sFileName)
+{
+	Close();
+	if (!m_File.Open(a_sFileName)) { return false; }
+
+	MySceneHeader const* pHeader = m_File.GetArray<MySceneHeader>(0, 1);
+	MySceneHeader expected;
+	if (pHeader == nullptr || memcmp(pHeader->lMagic, expected.lMagic, sizeof(expected.lMagic)) != 0 || pHeader->uVersion != VERSION)
+	{
+		Close();
+		return false;
+	}
+	m_pHeader = pHeader;
+
+	// Every per entity array has to be complete, and every entity has to name a model of the file
+	uint uEntityCount = m_pHeader->uEntityCount;
+	uint const* pModelIndex = GetSection<uint>(SS_MODEL_INDEX, uEntityCount);
+	bool bValid = pModelIndex != nullptr && GetSection<matrix4>(SS_MATRIX, uEntityCount) != nullptr &&
+		GetSection<vector3>(SS_LOCAL_MIN, uEntityCount) != nullptr && GetSection<vector3>(SS_LOCAL_MAX, uEntityCount) != nullptr &&
+		GetSection<uint>(SS_FILTER, uEntityCount * 2ull) != nullptr && GetSection<uint>(SS_FLAG, uEntityCount) != nullptr &&
+		ReadStrings(SS_MODEL_NAME, m_pHeader->uModelCount, &m_lModelName) && ReadStrings(SS_UNIQUE_ID, uEntityCount, nullptr);
+	for (uint i = 0; i < uEntityCount && bValid; i++)
+	{
+		bValid = pModelIndex[i] < m_pHeader->uModelCount;
+	}
+
+	// The octree is only made if it is a single tree naming entities of the file
+	if (bValid && m_pHeader->uOctantCount > 0)
+	{
+		MyFileSection const& entities = m_pHeader->lSection[SS_OCTANT_ENTITY];
+		uint uEntryCount = static_cast<uint>(entities.uSize / sizeof(uint));
+		MyOctantRecord const* pRecord = GetSection<MyOctantRecord>(SS_OCTANT, m_pHeader->uOctantCount);
+		uint const* pEntry = GetSection<uint>(SS_OCTANT_ENTITY, uEntryCount);
+		bValid = pRecord != nullptr && pEntry != nullptr && entities.uSize % sizeof(uint) == 0 &&
+			MyOctant::IsRecordListValid(pRecord, m_pHeader->uOctantCount, pEntry, uEntryCount, uEntityCount, m_pHeader->uOctreeIDCount);
+	}
+
+	if (!bValid)
+	{
+		Close();
+		return false;
+	}
+	return true;
+}
+
+void Simplex::MySceneFile::Close(void)
+{
+	m_pHeader = nullptr;
+	m_lModelName.clear();
+	m_File.Close();
+}
+
+bool Simplex::MySceneFile::IsOpen(void)
+{
+	return m_pHeader != nullptr;
+}
+
+uint Simplex::MySceneFile::GetEntityCount(void)
+{
+	return m_pHeader != nullptr ? m_pHeader->uEntityCount : 0;
+}
+
+std::vector<String> const& Simplex::MySceneFile::GetModelNameList(void)
+{
+	return m_lModelName;
+}
+
+char const* Simplex::MySceneFile::GetUniqueIDList(void)
+{
+	MyFileSection const& section = m_pHeader->lSection[SS_UNIQUE_ID];
+	return m_File.GetArray<char>(static_cast<size_t>(section.uOffset), static_cast<size_t>(section.uSize));
+}
+
+uint const* Simplex::MySceneFile::GetModelIndexList(void)
+{
+	return GetSection<uint>(SS_MODEL_INDEX, m_pHeader->uEntityCount);
+}
+
+matrix4 const* Simplex::MySceneFile::GetMatrixList(void)
+{
+	return GetSection<matrix4>(SS_MATRIX, m_pHeader->uEntityCount);
+}
+
+void Simplex::MySceneFile::GetLocalBoundsList(vector3 const*& a_pMin, vector3 const*& a_pMax)
+{
+	a_pMin = GetSection<vector3>(SS_LOCAL_MIN, m_pHeader->uEntityCount);
+	a_pMax = GetSection<vector3>(SS_LOCAL_MAX, m_pHeader->uEntityCount);
+}
+
+uint const* Simplex::MySceneFile::GetFilterList(void)
+{
+	return GetSection<uint>(SS_FILTER, m_pHeader->uEntityCount * 2ull);
+}
+
+uint const* Simplex::MySceneFile::GetFlagList(void)
+{
+	return GetSection<uint>(SS_FLAG, m_pHeader->uEntityCount);
+}
+
+bool Simplex::MySceneFile::HasOctree(void)
+{
+	return m_pHeader != nullptr && m_pHeader->uOctantCount > 0;
+}
+
+MyOctant* Simplex::MySceneFile::LoadOctree(void)
+{
+	if (!HasOctree()) { return nullptr; }
+
+	MyFileSection const& entities = m_pHeader->lSection[SS_OCTANT_ENTITY];
+	MyOctantRecord const* pRecord = GetSection<MyOctantRecord>(SS_OCTANT, m_pHeader->uOctantCount);
+	uint const* pEntry = GetSection<uint>(SS_OCTANT_ENTITY, static_cast<size_t>(entities.uSize / sizeof(uint)));
+	return new MyOctant(pRecord, pEntry, m_pHeader->uOctreeIDCount, m_pHeader->uOctreeMaxLevel, m_pHeader->uOctreeIdealCount);
+}
+
+void Simplex::MySceneFile::GetOctreeSettings(uint& a_uMaxLevel, uint& a_uIdealCount)
+{
+	a_uMaxLevel = m_pHeader->uOctreeMaxLevel;
+	a_uIdealCount = m_pHeader->uOctreeIdealCount;
+}
+
+bool Simplex::MySceneFile::ReadStrings(MY_SCENE_SECTION a_eSection, uint a_uCount, std::vector<String>* a_pList)
+{
+	MyFileSection const& section = m_pHeader->lSection[a_eSection];
+	char const* pData = m_File.GetArray<char>(static_cast<size_t>(section.uOffset), static_cast<size_t>(section.uSize));
+	if (pData == nullptr) { return false; }
+
+	// The section has to end right after the last string
+	char const* pEnd = pData + section.uSize;
+	for (uint i = 0; i < a_uCount; i++)
+	{
+		char const* pZero = static_cast<char const*>(memchr(pData, 0, pEnd - pData));
+		if (pZero == nullptr) { return false; }
+		if (a_pList != nullptr) { a_pList->push_back(String(pData, pZero)); }
+		pData = pZero + 1;
+	}
+	return pData == pEnd;
+}
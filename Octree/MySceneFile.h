@@ -0,0 +1,228 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYSCENEFILE_H_
+#define __MYSCENEFILE_H_
+
+#include "MyMappedFile.h"
+#include "MyOctant.h"
+
+namespace Simplex
+{
+	// Arrays of a scene snapshot, the per entity ones have one entry per entity
+	enum MY_SCENE_SECTION
+	{
+		SS_MODEL_NAME = 0, // file names of the models, each ending with a 0
+		SS_UNIQUE_ID = 1, // unique IDs of the entities, each ending with a 0
+		SS_MODEL_INDEX = 2, // model of each entity, uint
+		SS_MATRIX = 3, // model matrix of each entity, matrix4
+		SS_LOCAL_MIN = 4, // local box of each entity, vector3
+		SS_LOCAL_MAX = 5,
+		SS_FILTER = 6, // collision category then mask of each entity, 2 uint
+		SS_FLAG = 7, // SF_ flags of each entity, uint
+		SS_OCTANT = 8, // octree depth first, MyOctantRecord, empty if it was not saved
+		SS_OCTANT_ENTITY = 9, // entities of the octants, uint
+		SS_COUNT = 10
+	};
+
+	// Flags of an entity in a snapshot
+	enum MY_SCENE_FLAG
+	{
+		SF_STATIC = 1 // declared static
+	};
+
+	// First bytes of a snapshot, the arrays follow it at the offsets of the section table
+	struct MySceneHeader
+	{
+		char lMagic[4] = { 'M', 'Y', 'S', 'N' };
+		uint uVersion = 0;
+		uint uEntityCount = 0;
+		uint uModelCount = 0;
+		uint uOctantCount = 0; // records in SS_OCTANT, 0 if the octree was not saved
+		uint uOctreeIDCount = 0; // IDs handed out by the saved octree
+		uint uOctreeMaxLevel = 0;
+		uint uOctreeIdealCount = 0;
+		MyFileSection lSection[SS_COUNT];
+	};
+
+	// Scene gathered to be saved, the per entity lists have one entry per entity
+	struct MySceneData
+	{
+		std::vector<String> lModelName; // one entry per model
+		std::vector<String> lUniqueID;
+		std::vector<uint> lModelIndex; // entry of lModelName
+		std::vector<matrix4> lMatrix;
+		std::vector<vector3> lLocalMin;
+		std::vector<vector3> lLocalMax;
+		std::vector<uint> lFilter; // category then mask
+		std::vector<uint> lFlag; // MY_SCENE_FLAG bits
+		std::vector<MyOctantRecord> lOctant; // empty to leave the octree out
+		std::vector<uint> lOctantEntity;
+		uint uOctreeIDCount = 0;
+		uint uOctreeMaxLevel = 0;
+		uint uOctreeIdealCount = 0;
+	};
+
+	// Binary snapshot of a scene; the arrays are read in place from the mapped file, so opening one costs no parsing
+	// and the pages load as they are used. The layout is that of the machine that wrote it, little endian on ours
+	class MySceneFile
+	{
+		static constexpr uint VERSION = 1; // bumped whenever the layout changes, other versions are refused
+		static constexpr uint SECTION_ALIGNMENT = 16;
+
+		MyMappedFile m_File;
+		MySceneHeader const* m_pHeader = nullptr; // nullptr while no valid snapshot is open
+		std::vector<String> m_lModelName;
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MySceneFile(void);
+
+		/*
+		USAGE: Destructor, closes the snapshot
+		*/
+		~MySceneFile(void);
+
+		/*
+		USAGE: Writes a snapshot
+		ARGUMENTS:
+		- String a_sFileName -> file to write
+		- MySceneData const& a_Data -> scene to write, the per entity lists all the same size
+		OUTPUT: was it written?
+		*/
+		static bool Save(String a_sFileName, MySceneData const& a_Data);
+
+		/*
+		USAGE: Maps a snapshot and checks its version and that every array fits, the octree included
+		ARGUMENTS:
+		- String a_sFileName -> file to read
+		OUTPUT: is it a valid snapshot?
+		*/
+		bool Open(String a_sFileName);
+
+		/*
+		USAGE: Unmaps the snapshot, the arrays it handed out are no longer valid
+		*/
+		void Close(void);
+
+		/*
+		USAGE: Asks if a valid snapshot is open
+		OUTPUT: is it open?
+		*/
+		bool IsOpen(void);
+
+		/*
+		USAGE: Gets the number of entities in the snapshot
+		OUTPUT: entity count
+		*/
+		uint GetEntityCount(void);
+
+		/*
+		USAGE: Gets the file names of the models the entities use
+		OUTPUT: one entry per model
+		*/
+		std::vector<String> const& GetModelNameList(void);
+
+		/*
+		USAGE: Gets the unique IDs of the entities, one after the other
+		OUTPUT: first ID; every one ends with a 0 and the next one starts right after it
+		*/
+		char const* GetUniqueIDList(void);
+
+		/*
+		USAGE: Gets the model of each entity
+		OUTPUT: entry of GetModelNameList per entity
+		*/
+		uint const* GetModelIndexList(void);
+
+		/*
+		USAGE: Gets the model matrix of each entity
+		OUTPUT: one matrix per entity
+		*/
+		matrix4 const* GetMatrixList(void);
+
+		/*
+		USAGE: Gets the local box of each entity
+		ARGUMENTS:
+		- vector3 const*& a_pMin -> local minimum per entity
+		- vector3 const*& a_pMax -> local maximum per entity
+		*/
+		void GetLocalBoundsList(vector3 const*& a_pMin, vector3 const*& a_pMax);
+
+		/*
+		USAGE: Gets the collision filter of each entity
+		OUTPUT: category then mask per entity
+		*/
+		uint const* GetFilterList(void);
+
+		/*
+		USAGE: Gets the flags of each entity
+		OUTPUT: MY_SCENE_FLAG bits per entity
+		*/
+		uint const* GetFlagList(void);
+
+		/*
+		USAGE: Asks if the snapshot holds the octree
+		OUTPUT: was it saved?
+		*/
+		bool HasOctree(void);
+
+		/*
+		USAGE: Makes the saved octree, the entities are read from the entity manager until the bounds list of the
+		root is set
+		OUTPUT: root, nullptr if the octree was not saved
+		*/
+		MyOctant* LoadOctree(void);
+
+		/*
+		USAGE: Gets the settings the saved octree was built with
+		ARGUMENTS:
+		- uint& a_uMaxLevel -> maximum level of subdivision
+		- uint& a_uIdealCount -> entities per octant before it subdivides
+		*/
+		void GetOctreeSettings(uint& a_uMaxLevel, uint& a_uIdealCount);
+
+	private:
+		/*
+		USAGE: Gets a section of the file as an array
+		ARGUMENTS:
+		- MY_SCENE_SECTION a_eSection -> section to read
+		- size_t a_uCount -> entries it has to hold
+		OUTPUT: first entry, nullptr if the section is not exactly that size or does not fit in the file
+		*/
+		template <class T> T const* GetSection(MY_SCENE_SECTION a_eSection, size_t a_uCount)
+		{
+			MyFileSection const& section = m_pHeader->lSection[a_eSection];
+			if (section.uSize != a_uCount * sizeof(T)) { return nullptr; }
+
+			return m_File.GetArray<T>(static_cast<size_t>(section.uOffset), a_uCount);
+		}
+
+		/*
+		USAGE: Reads the strings of a section, checking they all end inside it
+		ARGUMENTS:
+		- MY_SCENE_SECTION a_eSection -> section to read
+		- uint a_uCount -> strings it has to hold
+		- std::vector<String>* a_pList -> list to fill, nullptr to only check them
+		OUTPUT: does it hold that many strings?
+		*/
+		bool ReadStrings(MY_SCENE_SECTION a_eSection, uint a_uCount, std::vector<String>* a_pList);
+
+		/*
+		USAGE: Copy constructor
+		*/
+		MySceneFile(MySceneFile const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MySceneFile& operator=(MySceneFile const& a_pOther);
+	};
+}
+
+#endif //__MYSCENEFILE_H_
@@ -0,0 +1,193 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MySimulation.h"
+#include "MyOctant.h"
+#include "MyProfiler.h"
+#include <chrono>
+using namespace Simplex;
+
+Simplex::MySimulation::MySimulation(MyEntityManager* a_pEntityMngr)
+{
+	m_pEntityMngr = a_pEntityMngr;
+	m_bRunning = false;
+	m_uMiddle = 1;
+	m_uBack = 0;
+	m_uFront = 2;
+	m_bShowOctree = true;
+	m_uOctantID = -1;
+	m_uStepTicks = static_cast<unsigned long long>(m_pEntityMngr->GetTimeStep() * 1e9);
+}
+
+Simplex::MySimulation::~MySimulation(void)
+{
+	Stop();
+}
+
+void Simplex::MySimulation::Start(void)
+{
+	if (m_bRunning) { return; }
+
+	m_bRunning = true;
+	m_Thread = std::thread(&MySimulation::Loop, this);
+}
+
+void Simplex::MySimulation::Stop(void)
+{
+	m_bRunning = false;
+	if (m_Thread.joinable()) { m_Thread.join(); }
+}
+
+bool Simplex::MySimulation::IsRunning(void)
+{
+	return m_bRunning;
+}
+
+void Simplex::MySimulation::Step(void)
+{
+	std::unique_lock<std::mutex> lock(m_Mutex);
+	RunStep(MyProfiler::GetTicks());
+}
+
+std::unique_lock<std::mutex> Simplex::MySimulation::Lock(void)
+{
+	return std::unique_lock<std::mutex>(m_Mutex);
+}
+
+MySimulationSnapshot const& Simplex::MySimulation::AcquireSnapshot(void)
+{
+	// Take the middle slot only if it holds something new, otherwise keep drawing the one we have
+	if (m_uMiddle.load(std::memory_order_relaxed) & FRESH)
+	{
+		m_uFront = m_uMiddle.exchange(m_uFront, std::memory_order_acq_rel) & ~FRESH;
+	}
+	return m_Snapshot[m_uFront];
+}
+
+float Simplex::MySimulation::GetInterpolation(MySimulationSnapshot const& a_Snapshot)
+{
+	if (!m_bRunning || m_uStepTicks == 0) { return 1.0f; }
+
+	unsigned long long uNow = MyProfiler::GetTicks();
+	if (uNow <= a_Snapshot.uTime) { return 0.0f; }
+	return glm::min(static_cast<float>(uNow - a_Snapshot.uTime) / m_uStepTicks, 1.0f);
+}
+
+void Simplex::MySimulation::AddToRenderList(MySimulationSnapshot const& a_Snapshot, float a_fInterpolation, bool a_bRigidBody)
+{
+	// The matrices are blended entry by entry, exact for the translations and scales of the entities
+	for (MyEntitySnapshot const& entity : a_Snapshot.lEntity)
+	{
+		matrix4 m4ToWorld = entity.m4Previous + (entity.m4Current - entity.m4Previous) * a_fInterpolation;
+		vector3 v3Min = glm::mix(entity.v3MinPrevious, entity.v3Min, a_fInterpolation);
+		vector3 v3Max = glm::mix(entity.v3MaxPrevious, entity.v3Max, a_fInterpolation);
+		entity.pEntity->AddToRenderList(m4ToWorld, v3Min, v3Max, entity.bColliding, a_bRigidBody);
+	}
+}
+
+void Simplex::MySimulation::SetOctreeDisplay(bool a_bShow, uint a_uOctantID)
+{
+	m_bShowOctree = a_bShow;
+	m_uOctantID = a_uOctantID;
+}
+
+void Simplex::MySimulation::Loop(void)
+{
+	MY_PROFILE_THREAD("Simulation");
+
+	unsigned long long uNext = MyProfiler::GetTicks();
+	while (m_bRunning)
+	{
+		unsigned long long uNow = MyProfiler::GetTicks();
+		if (uNow < uNext)
+		{
+			std::this_thread::sleep_for(std::chrono::nanoseconds(uNext - uNow));
+			continue;
+		}
+
+		// Catch up on the steps that are due, a few at most so a slow scene slows down instead of spiraling
+		uint uSteps = 0;
+		while (uNow >= uNext && uSteps < MAX_CATCH_UP && m_bRunning)
+		{
+			{
+				std::unique_lock<std::mutex> lock(m_Mutex);
+				RunStep(uNext);
+			}
+			uNext += m_uStepTicks;
+			uSteps++;
+			uNow = MyProfiler::GetTicks();
+		}
+		if (uNow >= uNext)
+		{
+			m_uDroppedSteps += static_cast<uint>((uNow - uNext) / m_uStepTicks) + 1;
+			uNext = uNow + m_uStepTicks;
+		}
+	}
+}
+
+void Simplex::MySimulation::RunStep(unsigned long long a_uTime)
+{
+	MY_PROFILE_ZONE("MySimulation::Step");
+	auto tStart = std::chrono::high_resolution_clock::now();
+	m_pEntityMngr->Update();
+	auto tEnd = std::chrono::high_resolution_clock::now();
+	m_uStep++;
+	Publish(a_uTime, std::chrono::duration<float, std::milli>(tEnd - tStart).count());
+}
+
+void Simplex::MySimulation::Publish(unsigned long long a_uTime, float a_fUpdateTime)
+{
+	MY_PROFILE_ZONE("Publish");
+	MySimulationSnapshot& snapshot = m_Snapshot[m_uBack];
+	uint uEntityCount = m_pEntityMngr->GetEntityCount();
+
+	// Entities added since the last step start where they are, removed ones drop their previous state
+	m_lPrevious.resize(uEntityCount);
+	snapshot.lEntity.resize(uEntityCount);
+	for (uint i = 0; i < uEntityCount; i++)
+	{
+		MyEntity* pEntity = m_pEntityMngr->GetEntity(i);
+		MyRigidBody* pRigidBody = pEntity->GetRigidBody();
+		MyEntitySnapshot& entity = snapshot.lEntity[i];
+		MyEntitySnapshot& previous = m_lPrevious[i];
+		entity.pEntity = pEntity;
+		entity.m4Current = pEntity->GetModelMatrix();
+		entity.v3Min = pRigidBody->GetMinGlobal();
+		entity.v3Max = pRigidBody->GetMaxGlobal();
+		entity.bColliding = pRigidBody->GetCollidingCount() > 0;
+		if (previous.pEntity != pEntity)
+			previous = entity;
+		entity.m4Previous = previous.m4Current;
+		entity.v3MinPrevious = previous.v3Min;
+		entity.v3MaxPrevious = previous.v3Max;
+		previous = entity;
+	}
+
+	snapshot.lOctant.clear();
+	MyOctant* pRoot = m_pEntityMngr->GetOctree();
+	if (m_bShowOctree && pRoot != nullptr)
+		pRoot->GetDisplayList(snapshot.lOctant, m_uOctantID);
+
+	snapshot.uStep = m_uStep;
+	snapshot.uTime = a_uTime;
+	snapshot.sBroadphase = m_pEntityMngr->GetBroadphaseName();
+	snapshot.fUpdateTime = a_fUpdateTime;
+	snapshot.uCachedPairs = m_pEntityMngr->GetCachedPairCount();
+	snapshot.uNarrowphaseCount = m_pEntityMngr->GetNarrowphaseCount();
+	snapshot.uActiveCount = m_pEntityMngr->GetActiveCount();
+	snapshot.uBodyCount = m_pEntityMngr->GetBodyCount();
+	snapshot.uOctreeLevels = m_pEntityMngr->GetOctreeLevels();
+	snapshot.uOctreeIdealCount = m_pEntityMngr->GetOctreeIdealCount();
+	snapshot.uOctantCount = pRoot != nullptr ? pRoot->GetOctantCount() : 0;
+	snapshot.fOctreeBuildProgress = m_pEntityMngr->GetOctreeBuildProgress();
+	snapshot.uDroppedSteps = m_uDroppedSteps;
+	snapshot.Stats = m_pEntityMngr->GetCollisionStats();
+	snapshot.lTrial = m_pEntityMngr->GetOctreeTrials();
+	snapshot.Memory = MyMemoryReport();
+	m_pEntityMngr->GetMemoryReport(snapshot.Memory);
+
+	// The slot just written becomes the middle one, the old middle one is written next
+	m_uBack = m_uMiddle.exchange(m_uBack | FRESH, std::memory_order_acq_rel) & ~FRESH;
+}
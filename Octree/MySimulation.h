@@ -0,0 +1,185 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYSIMULATION_H_
+#define __MYSIMULATION_H_
+
+#include "MyEntityManager.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace Simplex
+{
+	// State of an entity at the last two steps, the render thread draws it in between
+	struct MyEntitySnapshot
+	{
+		MyEntity* pEntity = nullptr;
+		matrix4 m4Previous = IDENTITY_M4; // model matrix one step before the current one
+		matrix4 m4Current = IDENTITY_M4;
+		vector3 v3MinPrevious = ZERO_V3; // global bounds one step before the current ones
+		vector3 v3MaxPrevious = ZERO_V3;
+		vector3 v3Min = ZERO_V3;
+		vector3 v3Max = ZERO_V3;
+		bool bColliding = false;
+	};
+
+	// Everything the render thread reads from the simulation, copied after every step
+	struct MySimulationSnapshot
+	{
+		std::vector<MyEntitySnapshot> lEntity;
+		std::vector<matrix4> lOctant; // wire cubes of the octree display, empty when it is hidden
+		unsigned long long uStep = 0; // steps taken when it was published
+		unsigned long long uTime = 0; // time the current state belongs to, in MyProfiler ticks
+
+		String sBroadphase = ""; // counters shown by the GUI
+		float fUpdateTime = 0.0f; // milliseconds spent by the entity manager on the step
+		uint uCachedPairs = 0;
+		uint uNarrowphaseCount = 0;
+		uint uActiveCount = 0;
+		uint uBodyCount = 0;
+		uint uOctreeLevels = 0;
+		uint uOctreeIdealCount = 0;
+		uint uOctantCount = 0;
+		float fOctreeBuildProgress = -1.0f; // fraction of the running rebuild, -1 if there is none
+		uint uDroppedSteps = 0; // steps skipped so far because the simulation could not keep up
+		MyCollisionStats Stats;
+		std::vector<MyOctreeTrial> lTrial;
+		MyMemoryReport Memory;
+	};
+
+	// Runs the entity manager at a fixed time step on its own thread, the transforms reach the render thread
+	// through a triple buffer so neither ever waits for the other
+	class MySimulation
+	{
+		static constexpr uint MAX_CATCH_UP = 4; // steps run back to back before the late ones are dropped
+		static constexpr uint FRESH = 4; // flag of the middle slot, set while it holds a snapshot not yet read
+
+		MyEntityManager* m_pEntityMngr = nullptr;
+		std::thread m_Thread;
+		std::atomic<bool> m_bRunning; // does the thread keep stepping?
+		std::mutex m_Mutex; // held by the thread during a step, and by whoever edits the entity manager
+
+		MySimulationSnapshot m_Snapshot[3]; // triple buffer: written, published and read slots
+		std::atomic<uint> m_uMiddle; // published slot, with FRESH while the reader has not taken it
+		uint m_uBack = 0; // slot being written, only the simulation touches it
+		uint m_uFront = 2; // slot being read, only the render thread touches it
+
+		std::vector<MyEntitySnapshot> m_lPrevious; // state of the last step, the previous half of the next snapshot
+		unsigned long long m_uStep = 0; // steps taken
+		unsigned long long m_uStepTicks = 0; // length of a step in MyProfiler ticks
+		std::atomic<bool> m_bShowOctree; // does the snapshot carry the octree display?
+		std::atomic<uint> m_uOctantID; // octant displayed, -1 for the whole tree
+		uint m_uDroppedSteps = 0;
+
+	public:
+		/*
+		USAGE: Constructor, the step is the one the entity manager integrates the bodies with
+		ARGUMENTS:
+		- MyEntityManager* a_pEntityMngr -> entity manager to run
+		OUTPUT: class object
+		*/
+		MySimulation(MyEntityManager* a_pEntityMngr);
+
+		/*
+		USAGE: Destructor, stops the thread
+		*/
+		~MySimulation(void);
+
+		/*
+		USAGE: Starts stepping on the simulation thread, the first step is due right away
+		*/
+		void Start(void);
+
+		/*
+		USAGE: Stops the thread and waits for the step it is running
+		*/
+		void Stop(void);
+
+		/*
+		USAGE: Asks if the thread is stepping
+		OUTPUT: is it running?
+		*/
+		bool IsRunning(void);
+
+		/*
+		USAGE: Runs one step on the calling thread and publishes it, for when the thread is not running
+		*/
+		void Step(void);
+
+		/*
+		USAGE: Locks the entity manager against the simulation thread, edits made while holding it land between two
+		steps so they wait at most one step
+		OUTPUT: lock, released when it goes out of scope
+		*/
+		std::unique_lock<std::mutex> Lock(void);
+
+		/*
+		USAGE: Takes the latest snapshot published, to be called from the render thread only; the snapshot stays
+		valid until the next call
+		OUTPUT: snapshot
+		*/
+		MySimulationSnapshot const& AcquireSnapshot(void);
+
+		/*
+		USAGE: Computes how far between the previous and the current state of a snapshot the render thread is; the
+		render thread shows the simulation one step late so it always has both ends
+		ARGUMENTS:
+		- MySimulationSnapshot const& a_Snapshot -> snapshot acquired
+		OUTPUT: 0 at the previous state, 1 at the current one; always 1 while the thread is not running
+		*/
+		float GetInterpolation(MySimulationSnapshot const& a_Snapshot);
+
+		/*
+		USAGE: Adds the entities of a snapshot to the render list, blended between their last two states
+		ARGUMENTS:
+		- MySimulationSnapshot const& a_Snapshot -> snapshot acquired
+		- float a_fInterpolation -> 0 for the previous state, 1 for the current one
+		- bool a_bRigidBody -> draw the rigid bodies too?
+		*/
+		void AddToRenderList(MySimulationSnapshot const& a_Snapshot, float a_fInterpolation, bool a_bRigidBody);
+
+		/*
+		USAGE: Chooses what the snapshots carry of the octree display
+		ARGUMENTS:
+		- bool a_bShow -> carry it at all?
+		- uint a_uOctantID -> octant displayed, -1 for the whole tree
+		*/
+		void SetOctreeDisplay(bool a_bShow, uint a_uOctantID);
+
+	private:
+		/*
+		USAGE: Body of the thread, steps on a fixed schedule and sleeps until the next step is due
+		*/
+		void Loop(void);
+
+		/*
+		USAGE: Updates the entity manager and publishes the result
+		ARGUMENTS:
+		- unsigned long long a_uTime -> time the new state belongs to, in MyProfiler ticks
+		*/
+		void RunStep(unsigned long long a_uTime);
+
+		/*
+		USAGE: Fills the back slot from the entity manager and swaps it with the middle one
+		ARGUMENTS:
+		- unsigned long long a_uTime -> time the new state belongs to, in MyProfiler ticks
+		- float a_fUpdateTime -> milliseconds the entity manager took
+		*/
+		void Publish(unsigned long long a_uTime, float a_fUpdateTime);
+
+		/*
+		USAGE: Copy constructor
+		*/
+		MySimulation(MySimulation const& a_pOther);
+
+		/*
+		USAGE: Copy assignment operator
+		*/
+		MySimulation& operator=(MySimulation const& a_pOther);
+	};
+}
+
+#endif //__MYSIMULATION_H_
@@ -0,0 +1,288 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MySpatialHashGrid.h"
+using namespace Simplex;
+
+Simplex::MySpatialHashGrid::MySpatialHashGrid(void)
+{
+	m_uEntityCount = 0;
+	m_uOccupiedCells = 0;
+	m_fCellSize = 1.0f;
+	m_v3MaxHalfWidth = ZERO_V3;
+}
+
+void Simplex::MySpatialHashGrid::Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	CopyBounds(a_lMin, a_lMax);
+	m_uOccupiedCells = 0;
+	m_v3MaxHalfWidth = ZERO_V3;
+
+	if (m_uEntityCount == 0) { return; }
+
+	// The cell size is the median of the largest extent of each entity, so most entities only reach their neighbor cells
+	std::vector<float> lExtent(m_uEntityCount);
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		vector3 v3Size = m_lMax[i] - m_lMin[i];
+		lExtent[i] = std::max({ v3Size.x, v3Size.y, v3Size.z });
+		m_v3MaxHalfWidth = glm::max(m_v3MaxHalfWidth, v3Size / 2.0f);
+	}
+	std::nth_element(lExtent.begin(), lExtent.begin() + m_uEntityCount / 2, lExtent.end());
+	m_fCellSize = std::max(lExtent[m_uEntityCount / 2], 0.001f);
+
+	// Size the table to a power of two at least twice the entity count to keep the probe sequences short
+	uint uSlots = 16;
+	m_uHashShift = 60;
+	while (uSlots < m_uEntityCount * 2) { uSlots <<= 1; m_uHashShift--; }
+	m_lSlotKey.assign(uSlots, EMPTY_CELL);
+	m_lSlotCount.assign(uSlots, 0);
+	m_lSlotStart.resize(uSlots);
+	m_lEntitySlot.resize(m_uEntityCount);
+	m_lCellEntity.resize(m_uEntityCount);
+
+	// Count the entities of each cell, every entity lives in the cell of its center
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		vector3 v3Center = (m_lMin[i] + m_lMax[i]) / 2.0f;
+		uint uSlot = FindOrInsert(PackKey(ToCell(v3Center.x), ToCell(v3Center.y), ToCell(v3Center.z)));
+		m_lEntitySlot[i] = uSlot;
+		m_lSlotCount[uSlot]++;
+	}
+
+	// Prefix sum of the counts gives each cell its range in the sorted entity array
+	uint uRunning = 0;
+	for (uint uSlot = 0; uSlot < uSlots; uSlot++)
+	{
+		m_lSlotStart[uSlot] = uRunning;
+		uRunning += m_lSlotCount[uSlot];
+	}
+
+	// Scatter the entities into their ranges, the counts are rebuilt as the fill cursor
+	std::fill(m_lSlotCount.begin(), m_lSlotCount.end(), 0);
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		uint uSlot = m_lEntitySlot[i];
+		m_lCellEntity[m_lSlotStart[uSlot] + m_lSlotCount[uSlot]] = i;
+		m_lSlotCount[uSlot]++;
+	}
+}
+
+void Simplex::MySpatialHashGrid::Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	Build(a_lMin, a_lMax);
+}
+
+void Simplex::MySpatialHashGrid::QueryPairs(MyPairList& a_lPairs)
+{
+	uint uSlots = static_cast<uint>(m_lSlotKey.size());
+	MyBroadphaseStats stats;
+
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		// An entity that collides with no layer has no neighbors to look for
+		if (m_lMask[i] == 0) { continue; }
+
+		vector3 v3Min = m_lMin[i];
+		vector3 v3Max = m_lMax[i];
+
+		// Any entity overlapping this one has its center within the bounds grown by the largest half extent
+		int nMinX = ToCell(v3Min.x - m_v3MaxHalfWidth.x), nMaxX = ToCell(v3Max.x + m_v3MaxHalfWidth.x);
+		int nMinY = ToCell(v3Min.y - m_v3MaxHalfWidth.y), nMaxY = ToCell(v3Max.y + m_v3MaxHalfWidth.y);
+		int nMinZ = ToCell(v3Min.z - m_v3MaxHalfWidth.z), nMaxZ = ToCell(v3Max.z + m_v3MaxHalfWidth.z);
+
+		// A few huge entities can make the neighborhood larger than the whole table, walk the table instead
+		double dNeighbors = double(nMaxX - nMinX + 1) * double(nMaxY - nMinY + 1) * double(nMaxZ - nMinZ + 1);
+		if (dNeighbors > double(m_uOccupiedCells))
+		{
+			for (uint uSlot = 0; uSlot < uSlots; uSlot++)
+			{
+				TestCell(i, uSlot, a_lPairs, stats);
+			}
+			continue;
+		}
+
+		for (int x = nMinX; x <= nMaxX; x++)
+		{
+			for (int y = nMinY; y <= nMaxY; y++)
+			{
+				for (int z = nMinZ; z <= nMaxZ; z++)
+				{
+					uint uSlot = Find(PackKey(x, y, z));
+					if (uSlot != (uint)-1)
+					{
+						TestCell(i, uSlot, a_lPairs, stats);
+					}
+				}
+			}
+		}
+	}
+	m_Stats += stats;
+}
+
+void Simplex::MySpatialHashGrid::QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities)
+{
+	if (m_uEntityCount == 0) { return; }
+
+	MyBroadphaseStats stats;
+
+	// Same neighborhood as the pairs, the centers of the overlapping entities are within the box grown by the largest half extent
+	int nMinX = ToCell(a_v3Min.x - m_v3MaxHalfWidth.x), nMaxX = ToCell(a_v3Max.x + m_v3MaxHalfWidth.x);
+	int nMinY = ToCell(a_v3Min.y - m_v3MaxHalfWidth.y), nMaxY = ToCell(a_v3Max.y + m_v3MaxHalfWidth.y);
+	int nMinZ = ToCell(a_v3Min.z - m_v3MaxHalfWidth.z), nMaxZ = ToCell(a_v3Max.z + m_v3MaxHalfWidth.z);
+
+	double dNeighbors = double(nMaxX - nMinX + 1) * double(nMaxY - nMinY + 1) * double(nMaxZ - nMinZ + 1);
+	if (dNeighbors > double(m_uOccupiedCells))
+	{
+		for (uint uSlot = 0; uSlot < m_lSlotKey.size(); uSlot++)
+		{
+			CollectCell(uSlot, a_v3Min, a_v3Max, a_uMask, a_lEntities, stats);
+		}
+		m_Stats += stats;
+		return;
+	}
+
+	for (int x = nMinX; x <= nMaxX; x++)
+	{
+		for (int y = nMinY; y <= nMaxY; y++)
+		{
+			for (int z = nMinZ; z <= nMaxZ; z++)
+			{
+				uint uSlot = Find(PackKey(x, y, z));
+				if (uSlot != (uint)-1)
+				{
+					CollectCell(uSlot, a_v3Min, a_v3Max, a_uMask, a_lEntities, stats);
+				}
+			}
+		}
+	}
+	m_Stats += stats;
+}
+
+String Simplex::MySpatialHashGrid::GetName(void)
+{
+	return "Hash Grid";
+}
+
+void Simplex::MySpatialHashGrid::GetMemoryReport(MyMemoryReport& a_Report)
+{
+	MyBroadphase::GetMemoryReport(a_Report);
+	a_Report.uNodeCount += m_uOccupiedCells;
+	a_Report.AddList(m_lSlotKey, a_Report.uNodeBytes);
+	a_Report.AddList(m_lSlotStart, a_Report.uNodeBytes);
+	a_Report.AddList(m_lSlotCount, a_Report.uNodeBytes);
+	a_Report.AddList(m_lEntitySlot, a_Report.uIndexBytes);
+	a_Report.AddList(m_lCellEntity, a_Report.uIndexBytes);
+}
+
+float Simplex::MySpatialHashGrid::GetCellSize(void)
+{
+	return m_fCellSize;
+}
+
+uint Simplex::MySpatialHashGrid::GetOccupiedCellCount(void)
+{
+	return m_uOccupiedCells;
+}
+
+MySpatialHashGrid::CellKey Simplex::MySpatialHashGrid::PackKey(int a_nX, int a_nY, int a_nZ)
+{
+	// 21 bits per axis, coordinates wrap around which only costs extra AABB tests for far away cells
+	return ((CellKey)(a_nX & 0x1FFFFF) << 42) | ((CellKey)(a_nY & 0x1FFFFF) << 21) | (CellKey)(a_nZ & 0x1FFFFF);
+}
+
+int Simplex::MySpatialHashGrid::ToCell(float a_fValue)
+{
+	return static_cast<int>(std::floor(a_fValue / m_fCellSize));
+}
+
+uint Simplex::MySpatialHashGrid::FindOrInsert(CellKey a_uKey)
+{
+	uint uMask = static_cast<uint>(m_lSlotKey.size()) - 1;
+	uint uSlot = Hash(a_uKey);
+
+	// Linear probing, the table is never more than half full so there is always a free slot
+	while (m_lSlotKey[uSlot] != a_uKey)
+	{
+		if (m_lSlotKey[uSlot] == EMPTY_CELL)
+		{
+			m_lSlotKey[uSlot] = a_uKey;
+			m_uOccupiedCells++;
+			break;
+		}
+		uSlot = (uSlot + 1) & uMask;
+	}
+	return uSlot;
+}
+
+uint Simplex::MySpatialHashGrid::Find(CellKey a_uKey)
+{
+	uint uMask = static_cast<uint>(m_lSlotKey.size()) - 1;
+	uint uSlot = Hash(a_uKey);
+
+	while (m_lSlotKey[uSlot] != a_uKey)
+	{
+		if (m_lSlotKey[uSlot] == EMPTY_CELL) { return (uint)-1; }
+		uSlot = (uSlot + 1) & uMask;
+	}
+	return uSlot;
+}
+
+void Simplex::MySpatialHashGrid::TestCell(uint a_uEntity, uint a_uSlot, MyPairList& a_lPairs, MyBroadphaseStats& a_Stats)
+{
+	vector3 v3Min = m_lMin[a_uEntity];
+	vector3 v3Max = m_lMax[a_uEntity];
+
+	uint uStart = m_lSlotStart[a_uSlot];
+	uint uEnd = uStart + m_lSlotCount[a_uSlot];
+	a_Stats.uNodesVisited++;
+	for (uint k = uStart; k < uEnd; k++)
+	{
+		uint j = m_lCellEntity[k];
+		if (j <= a_uEntity) { continue; } // every pair is reported once, from its lowest index
+		a_Stats.uCandidatePairs++;
+		if (!IsPairPassing(a_uEntity, j))
+		{
+			a_Stats.uLayerCulled++;
+			continue;
+		}
+		a_Stats.uBoundsTests++;
+		if (!IsBoxOverlapping(v3Min, v3Max, m_lMin[j], m_lMax[j])) { continue; }
+
+		MyEntityPair pair;
+		pair.uA = a_uEntity;
+		pair.uB = j;
+		a_lPairs.push_back(pair);
+	}
+}
+
+void Simplex::MySpatialHashGrid::CollectCell(uint a_uSlot, vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities,
+	MyBroadphaseStats& a_Stats)
+{
+	uint uStart = m_lSlotStart[a_uSlot];
+	uint uEnd = uStart + m_lSlotCount[a_uSlot];
+	a_Stats.uNodesVisited++;
+	a_Stats.uCandidatePairs += uEnd - uStart;
+	for (uint k = uStart; k < uEnd; k++)
+	{
+		uint j = m_lCellEntity[k];
+		if (!(m_lCategory[j] & a_uMask))
+		{
+			a_Stats.uLayerCulled++;
+			continue;
+		}
+		a_Stats.uBoundsTests++;
+		if (IsBoxOverlapping(a_v3Min, a_v3Max, m_lMin[j], m_lMax[j]))
+		{
+			a_lEntities.push_back(j);
+		}
+	}
+}
+
+uint Simplex::MySpatialHashGrid::Hash(CellKey a_uKey)
+{
+	// Fibonacci hashing, the top bits of the product depend on every axis of the key so they index the table
+	return static_cast<uint>((a_uKey * 0x9E3779B97F4A7C15ull) >> m_uHashShift);
+}
@@ -0,0 +1,159 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYSPATIALHASHGRID_H_
+#define __MYSPATIALHASHGRID_H_
+
+#include "MyBroadphase.h"
+
+namespace Simplex
+{
+	class MySpatialHashGrid : public MyBroadphase
+	{
+		typedef unsigned long long CellKey;
+		static constexpr CellKey EMPTY_CELL = ~0ull; // key of an unused slot in the cell table
+
+		uint m_uOccupiedCells = 0; // slots of the cell table in use this frame
+		float m_fCellSize = 1.0f; // side of a cell, derived from the median entity extent
+		vector3 m_v3MaxHalfWidth = ZERO_V3; // largest half extent of any entity
+
+		std::vector<CellKey> m_lSlotKey; // open addressing cell table, EMPTY_CELL if not used
+		uint m_uHashShift = 60; // 64 minus log2 of the table size, Hash keeps the bits above it
+		std::vector<uint> m_lSlotStart; // first entry of the slot in m_lCellEntity
+		std::vector<uint> m_lSlotCount; // number of entities whose center is in the slot's cell
+
+		std::vector<uint> m_lEntitySlot; // slot of the cell that holds the center of each entity
+		std::vector<uint> m_lCellEntity; // entity indices sorted by cell (counting sort)
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MySpatialHashGrid(void);
+
+		/*
+		USAGE: Rebuilds the grid from the global bounds of the entities
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) override;
+
+		/*
+		USAGE: The grid keeps nothing between frames, rebuilds it
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) override;
+
+		/*
+		USAGE: Appends every pair of entities with overlapping bounds by looking in the neighbor cells
+		ARGUMENTS:
+		- MyPairList& a_lPairs -> list to append the pairs to
+		*/
+		void QueryPairs(MyPairList& a_lPairs) override;
+
+		/*
+		USAGE: Appends every entity whose bounds overlap the box by looking in the cells it covers
+		ARGUMENTS:
+		- vector3 const& a_v3Min, a_v3Max -> queried box in global space
+		- uint a_uMask -> layers to report
+		- std::vector<uint>& a_lEntities -> list to append the entity indices to
+		*/
+		void QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities) override;
+
+		/*
+		USAGE: Gets a readable name of the structure
+		OUTPUT: name
+		*/
+		String GetName(void) override;
+
+		/*
+		USAGE: Adds up the memory held by the structure
+		ARGUMENTS:
+		- MyMemoryReport& a_Report -> report to add to
+		*/
+		void GetMemoryReport(MyMemoryReport& a_Report) override;
+
+		/*
+		USAGE: Gets the side of the cells used in the last build
+		OUTPUT: cell size
+		*/
+		float GetCellSize(void);
+
+		/*
+		USAGE: Gets the number of non empty cells of the last build
+		OUTPUT: cell count
+		*/
+		uint GetOccupiedCellCount(void);
+
+	private:
+		/*
+		USAGE: Packs the integer coordinates of a cell into a key
+		ARGUMENTS:
+		- int a_nX, a_nY, a_nZ -> coordinates of the cell
+		OUTPUT: key of the cell
+		*/
+		static CellKey PackKey(int a_nX, int a_nY, int a_nZ);
+
+		/*
+		USAGE: Gets the integer coordinate of the cell containing the value
+		ARGUMENTS:
+		- float a_fValue -> coordinate in global space
+		OUTPUT: cell coordinate
+		*/
+		int ToCell(float a_fValue);
+
+		/*
+		USAGE: Finds the slot of the key in the table, claiming a free slot if it is not in it
+		ARGUMENTS:
+		- CellKey a_uKey -> key of the cell
+		OUTPUT: slot index
+		*/
+		uint FindOrInsert(CellKey a_uKey);
+
+		/*
+		USAGE: Finds the slot of the key in the table
+		ARGUMENTS:
+		- CellKey a_uKey -> key of the cell
+		OUTPUT: slot index, -1 if the cell is empty
+		*/
+		uint Find(CellKey a_uKey);
+
+		/*
+		USAGE: Appends the pairs between the entity and the entities of the cell
+		ARGUMENTS:
+		- uint a_uEntity -> index of the queried entity
+		- uint a_uSlot -> slot of the cell to test against
+		- MyPairList& a_lPairs -> list to append the pairs to
+		- MyBroadphaseStats& a_Stats -> counters of the running query
+		*/
+		void TestCell(uint a_uEntity, uint a_uSlot, MyPairList& a_lPairs, MyBroadphaseStats& a_Stats);
+
+		/*
+		USAGE: Appends the entities of the cell on the queried layers that overlap the box
+		ARGUMENTS:
+		- uint a_uSlot -> slot of the cell to test
+		- vector3 const& a_v3Min, a_v3Max -> queried box
+		- uint a_uMask -> layers to report
+		- std::vector<uint>& a_lEntities -> list to append the entity indices to
+		- MyBroadphaseStats& a_Stats -> counters of the running query
+		*/
+		void CollectCell(uint a_uSlot, vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities,
+			MyBroadphaseStats& a_Stats);
+
+		/*
+		USAGE: Hashes the key into the first slot to probe
+		ARGUMENTS:
+		- CellKey a_uKey -> key of the cell
+		OUTPUT: slot index
+		*/
+		uint Hash(CellKey a_uKey);
+	};
+}
+
+#endif //__MYSPATIALHASHGRID_H_
@@ -0,0 +1,299 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#include "MySweepAndPrune.h"
+using namespace Simplex;
+
+Simplex::MySweepAndPrune::MySweepAndPrune(void)
+{
+	m_bMultiAxis = false;
+	m_bDirty = true;
+	m_uAxis = 0;
+	m_uEntityCount = 0;
+}
+
+void Simplex::MySweepAndPrune::SetMultiAxis(bool a_bMultiAxis)
+{
+	if (m_bMultiAxis == a_bMultiAxis) { return; }
+
+	m_bMultiAxis = a_bMultiAxis;
+	m_bDirty = true;
+}
+
+bool Simplex::MySweepAndPrune::IsMultiAxis(void)
+{
+	return m_bMultiAxis;
+}
+
+uint Simplex::MySweepAndPrune::GetAxis(void)
+{
+	return m_uAxis;
+}
+
+void Simplex::MySweepAndPrune::Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	m_bDirty = true;
+	Update(a_lMin, a_lMax);
+}
+
+void Simplex::MySweepAndPrune::Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax)
+{
+	// Adding or removing entities changes the indices, start over
+	if (a_lMin.size() != m_uEntityCount)
+	{
+		m_bDirty = true;
+	}
+
+	CopyBounds(a_lMin, a_lMax);
+
+	if (!m_bMultiAxis)
+	{
+		// Only switch the swept axis when another one is clearly better, so noise does not cause rebuilds
+		vector3 v3Variance = GetCenterVariance();
+		uint uAxis = 0;
+		if (v3Variance.y > v3Variance[uAxis]) { uAxis = 1; }
+		if (v3Variance.z > v3Variance[uAxis]) { uAxis = 2; }
+		if (m_bDirty || v3Variance[uAxis] > v3Variance[m_uAxis] * 1.5f)
+		{
+			m_bDirty = m_bDirty || uAxis != m_uAxis;
+			m_uAxis = uAxis;
+		}
+	}
+
+	if (m_bDirty)
+	{
+		Rebuild();
+		return;
+	}
+
+	// Refresh the values of the endpoints, their order is the one from the last update
+	for (uint uAxis = 0; uAxis < 3; uAxis++)
+	{
+		if (!m_bMultiAxis && uAxis != m_uAxis) { continue; }
+
+		std::vector<Endpoint>& lEndpoint = m_lEndpoint[uAxis];
+		for (uint i = 0; i < lEndpoint.size(); i++)
+		{
+			uint uEntity = lEndpoint[i].uData >> 1;
+			lEndpoint[i].fValue = (lEndpoint[i].uData & 1) ? m_lMax[uEntity][uAxis] : m_lMin[uEntity][uAxis];
+		}
+		SortAxis(uAxis);
+	}
+}
+
+void Simplex::MySweepAndPrune::QueryPairs(MyPairList& a_lPairs)
+{
+	MyBroadphaseStats stats;
+	stats.uCandidatePairs = static_cast<uint>(m_PairSet.size());
+
+	for (unsigned long long uKey : m_PairSet)
+	{
+		MyEntityPair pair;
+		pair.uA = static_cast<uint>(uKey >> 32);
+		pair.uB = static_cast<uint>(uKey & 0xFFFFFFFF);
+
+		// The set follows the geometry only, pairs on layers that ignore each other are dropped here
+		if (!IsPairPassing(pair.uA, pair.uB))
+		{
+			stats.uLayerCulled++;
+			continue;
+		}
+
+		// With a single sorted axis the set holds the pairs overlapping on that axis, finish the test on the other two
+		if (!m_bMultiAxis)
+		{
+			stats.uBoundsTests++;
+			if (!IsBoxOverlapping(m_lMin[pair.uA], m_lMax[pair.uA], m_lMin[pair.uB], m_lMax[pair.uB])) { continue; }
+		}
+
+		a_lPairs.push_back(pair);
+	}
+	m_Stats += stats;
+}
+
+void Simplex::MySweepAndPrune::QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities)
+{
+	uint uAxis = m_bMultiAxis ? 0 : m_uAxis;
+	std::vector<Endpoint> const& lEndpoint = m_lEndpoint[uAxis];
+	MyBroadphaseStats stats;
+
+	// Entities starting after the end of the box cannot overlap it, every other start is tested on the three axes
+	for (uint i = 0; i < lEndpoint.size(); i++)
+	{
+		if (lEndpoint[i].fValue > a_v3Max[uAxis]) { break; }
+		stats.uNodesVisited++;
+		if (lEndpoint[i].uData & 1) { continue; }
+
+		uint uEntity = lEndpoint[i].uData >> 1;
+		stats.uCandidatePairs++;
+		if (!(m_lCategory[uEntity] & a_uMask))
+		{
+			stats.uLayerCulled++;
+			continue;
+		}
+		stats.uBoundsTests++;
+		if (IsBoxOverlapping(a_v3Min, a_v3Max, m_lMin[uEntity], m_lMax[uEntity]))
+		{
+			a_lEntities.push_back(uEntity);
+		}
+	}
+	m_Stats += stats;
+}
+
+String Simplex::MySweepAndPrune::GetName(void)
+{
+	return m_bMultiAxis ? "Sweep and Prune (3 axes)" : "Sweep and Prune";
+}
+
+void Simplex::MySweepAndPrune::Rebuild(void)
+{
+	m_bDirty = false;
+	m_PairSet.clear();
+
+	for (uint uAxis = 0; uAxis < 3; uAxis++)
+	{
+		std::vector<Endpoint>& lEndpoint = m_lEndpoint[uAxis];
+		if (!m_bMultiAxis && uAxis != m_uAxis)
+		{
+			lEndpoint.clear();
+			continue;
+		}
+
+		lEndpoint.resize(m_uEntityCount * 2);
+		for (uint i = 0; i < m_uEntityCount; i++)
+		{
+			lEndpoint[i * 2].fValue = m_lMin[i][uAxis];
+			lEndpoint[i * 2].uData = i << 1;
+			lEndpoint[i * 2 + 1].fValue = m_lMax[i][uAxis];
+			lEndpoint[i * 2 + 1].uData = (i << 1) | 1;
+		}
+		std::sort(lEndpoint.begin(), lEndpoint.end(),
+			[](Endpoint const& a, Endpoint const& b) { return GoesAfter(b, a); });
+	}
+
+	// Sweep the primary axis keeping the list of open intervals, every new interval overlaps the open ones on this axis
+	uint uSweepAxis = m_bMultiAxis ? 0 : m_uAxis;
+	std::vector<Endpoint>& lEndpoint = m_lEndpoint[uSweepAxis];
+	std::vector<uint> lActive;
+	std::vector<uint> lActiveSlot(m_uEntityCount, 0);
+	for (uint i = 0; i < lEndpoint.size(); i++)
+	{
+		uint uEntity = lEndpoint[i].uData >> 1;
+		if (lEndpoint[i].uData & 1)
+		{
+			// Close the interval, swap with the last open one to remove it
+			uint uSlot = lActiveSlot[uEntity];
+			lActive[uSlot] = lActive.back();
+			lActiveSlot[lActive[uSlot]] = uSlot;
+			lActive.pop_back();
+		}
+		else
+		{
+			for (uint j = 0; j < lActive.size(); j++)
+			{
+				if (IsOverlapping(uEntity, lActive[j]))
+				{
+					m_PairSet.insert(PairKey(uEntity, lActive[j]));
+				}
+			}
+			lActiveSlot[uEntity] = static_cast<uint>(lActive.size());
+			lActive.push_back(uEntity);
+		}
+	}
+}
+
+vector3 Simplex::MySweepAndPrune::GetCenterVariance(void)
+{
+	if (m_uEntityCount == 0) { return ZERO_V3; }
+
+	vector3 v3Sum = ZERO_V3;
+	vector3 v3SumSquared = ZERO_V3;
+	for (uint i = 0; i < m_uEntityCount; i++)
+	{
+		vector3 v3Center = (m_lMin[i] + m_lMax[i]) / 2.0f;
+		v3Sum += v3Center;
+		v3SumSquared += v3Center * v3Center;
+	}
+	float fCount = static_cast<float>(m_uEntityCount);
+	return v3SumSquared / fCount - (v3Sum / fCount) * (v3Sum / fCount);
+}
+
+void Simplex::MySweepAndPrune::SortAxis(uint a_uAxis)
+{
+	std::vector<Endpoint>& lEndpoint = m_lEndpoint[a_uAxis];
+
+	for (uint i = 1; i < lEndpoint.size(); i++)
+	{
+		Endpoint key = lEndpoint[i];
+		uint uKeyEntity = key.uData >> 1;
+		uint j = i;
+
+		while (j > 0 && GoesAfter(lEndpoint[j - 1], key))
+		{
+			Endpoint const& other = lEndpoint[j - 1];
+			uint uOtherEntity = other.uData >> 1;
+			bool bKeyIsMax = (key.uData & 1) != 0;
+			bool bOtherIsMax = (other.uData & 1) != 0;
+
+			if (!bKeyIsMax && bOtherIsMax)
+			{
+				// A start moved before an end, the intervals begin to overlap on this axis
+				if (IsOverlapping(uKeyEntity, uOtherEntity))
+				{
+					m_PairSet.insert(PairKey(uKeyEntity, uOtherEntity));
+				}
+			}
+			else if (bKeyIsMax && !bOtherIsMax)
+			{
+				// An end moved before a start, the intervals stopped overlapping on this axis
+				m_PairSet.erase(PairKey(uKeyEntity, uOtherEntity));
+			}
+
+			lEndpoint[j] = other;
+			j--;
+		}
+		lEndpoint[j] = key;
+	}
+}
+
+void Simplex::MySweepAndPrune::GetMemoryReport(MyMemoryReport& a_Report)
+{
+	MyBroadphase::GetMemoryReport(a_Report);
+	for (uint uAxis = 0; uAxis < 3; uAxis++)
+	{
+		a_Report.uNodeCount += static_cast<uint>(m_lEndpoint[uAxis].size());
+		a_Report.AddList(m_lEndpoint[uAxis], a_Report.uNodeBytes);
+	}
+
+	// Each pair of the set is a node with the key and the link to the next one, plus the bucket array
+	a_Report.uIndexBytes += m_PairSet.size() * (sizeof(unsigned long long) + sizeof(void*));
+	a_Report.uAuxiliaryBytes += m_PairSet.bucket_count() * sizeof(void*);
+}
+
+bool Simplex::MySweepAndPrune::IsOverlapping(uint a_uA, uint a_uB)
+{
+	for (uint uAxis = 0; uAxis < 3; uAxis++)
+	{
+		if (!m_bMultiAxis && uAxis != m_uAxis) { continue; }
+
+		if (m_lMax[a_uA][uAxis] < m_lMin[a_uB][uAxis]) { return false; }
+		if (m_lMin[a_uA][uAxis] > m_lMax[a_uB][uAxis]) { return false; }
+	}
+	return true;
+}
+
+bool Simplex::MySweepAndPrune::GoesAfter(Endpoint const& a_First, Endpoint const& a_Second)
+{
+	if (a_First.fValue != a_Second.fValue) { return a_First.fValue > a_Second.fValue; }
+
+	// On ties starts go before ends, so touching intervals count as overlapping like in the AABB test
+	return (a_First.uData & 1) > (a_Second.uData & 1);
+}
+
+unsigned long long Simplex::MySweepAndPrune::PairKey(uint a_uA, uint a_uB)
+{
+	if (a_uA > a_uB) { std::swap(a_uA, a_uB); }
+	return ((unsigned long long)a_uA << 32) | a_uB;
+}
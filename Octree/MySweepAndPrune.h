@@ -0,0 +1,148 @@
+/*----------------------------------------------------
+Programmer: Israel Anthony (israelanthonyjr@gmail.com)
+Date: 10/2026
+----------------------------------------------------*/
+
+#ifndef __MYSWEEPANDPRUNE_H_
+#define __MYSWEEPANDPRUNE_H_
+
+#include "MyBroadphase.h"
+#include <unordered_set>
+
+namespace Simplex
+{
+	class MySweepAndPrune : public MyBroadphase
+	{
+		// Start or end of the interval of an entity on one axis, uData holds the entity index shifted left and 1 for an end
+		struct Endpoint
+		{
+			float fValue = 0.0f;
+			uint uData = 0;
+		};
+
+		bool m_bMultiAxis = false; // keep the three axes sorted instead of only the axis of greatest variance
+		bool m_bDirty = true; // the endpoint lists need to be rebuilt from scratch
+		uint m_uAxis = 0; // axis of greatest variance, the one swept in single axis mode
+
+		std::vector<Endpoint> m_lEndpoint[3]; // sorted endpoints of each axis, persistent across updates
+
+		std::unordered_set<unsigned long long> m_PairSet; // pairs overlapping on every sorted axis
+
+	public:
+		/*
+		USAGE: Constructor
+		OUTPUT: class object
+		*/
+		MySweepAndPrune(void);
+
+		/*
+		USAGE: Sets whether the three axes are kept sorted, changing it rebuilds the lists
+		ARGUMENTS:
+		- bool a_bMultiAxis -> sort the three axes?
+		*/
+		void SetMultiAxis(bool a_bMultiAxis);
+
+		/*
+		USAGE: Are the three axes kept sorted?
+		OUTPUT: multi axis mode
+		*/
+		bool IsMultiAxis(void);
+
+		/*
+		USAGE: Gets the axis swept in single axis mode
+		OUTPUT: 0 for x, 1 for y and 2 for z
+		*/
+		uint GetAxis(void);
+
+		/*
+		USAGE: Sorts the endpoint lists from scratch
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Build(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) override;
+
+		/*
+		USAGE: Updates the endpoint lists with the new bounds of the entities, insertion sort keeps this near
+		linear when the entities move little between updates
+		ARGUMENTS:
+		- std::vector<vector3> const& a_lMin -> global minimum of each entity
+		- std::vector<vector3> const& a_lMax -> global maximum of each entity
+		*/
+		void Update(std::vector<vector3> const& a_lMin, std::vector<vector3> const& a_lMax) override;
+
+		/*
+		USAGE: Appends every pair of entities with overlapping bounds
+		ARGUMENTS:
+		- MyPairList& a_lPairs -> list to append the pairs to
+		*/
+		void QueryPairs(MyPairList& a_lPairs) override;
+
+		/*
+		USAGE: Appends every entity whose bounds overlap the box, walking the sorted axis up to the end of the box
+		ARGUMENTS:
+		- vector3 const& a_v3Min, a_v3Max -> queried box in global space
+		- uint a_uMask -> layers to report
+		- std::vector<uint>& a_lEntities -> list to append the entity indices to
+		*/
+		void QueryAABB(vector3 const& a_v3Min, vector3 const& a_v3Max, uint a_uMask, std::vector<uint>& a_lEntities) override;
+
+		/*
+		USAGE: Gets a readable name of the structure
+		OUTPUT: name
+		*/
+		String GetName(void) override;
+
+		/*
+		USAGE: Adds up the memory held by the structure
+		ARGUMENTS:
+		- MyMemoryReport& a_Report -> report to add to
+		*/
+		void GetMemoryReport(MyMemoryReport& a_Report) override;
+
+	private:
+		/*
+		USAGE: Sorts the endpoints from scratch and finds the overlapping pairs with a sweep
+		*/
+		void Rebuild(void);
+
+		/*
+		USAGE: Gets the variance of the centers of the entities along each axis
+		OUTPUT: variance per axis
+		*/
+		vector3 GetCenterVariance(void);
+
+		/*
+		USAGE: Sorts the axis with insertion sort, adding and removing pairs as endpoints swap
+		ARGUMENTS:
+		- uint a_uAxis -> axis to sort
+		*/
+		void SortAxis(uint a_uAxis);
+
+		/*
+		USAGE: Checks if the entities overlap on every sorted axis
+		ARGUMENTS:
+		- uint a_uA, a_uB -> indices of the entities
+		OUTPUT: are they overlapping?
+		*/
+		bool IsOverlapping(uint a_uA, uint a_uB);
+
+		/*
+		USAGE: Checks if the first endpoint has to be placed after the second one
+		ARGUMENTS:
+		- Endpoint const& a_First, a_Second -> endpoints to compare
+		OUTPUT: goes after?
+		*/
+		static bool GoesAfter(Endpoint const& a_First, Endpoint const& a_Second);
+
+		/*
+		USAGE: Packs the indices of two entities into a pair key, smallest index first
+		ARGUMENTS:
+		- uint a_uA, a_uB -> indices of the entities
+		OUTPUT: key of the pair
+		*/
+		static unsigned long long PairKey(uint a_uA, uint a_uB);
+	};
+}
+
+#endif //__MYSWEEPANDPRUNE_H_